@@ -0,0 +1,103 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file BenchData.h
+ * @author Edward Martinez
+ * @brief Synthetic order data shared by the microbenchmarks.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#ifndef BENCH_MAX_ORDERS
+#define BENCH_MAX_ORDERS 10000000 /**< Largest book size benchmarked. Override with -DMERKLEREX_BENCH_MAX_ORDERS. */
+#endif
+#define BENCH_MIN_ORDERS 1000
+#define BENCH_ORDERS_PER_FRAME 100
+#define BENCH_SEED 20200317
+/********************************************//**
+ *  Function Definitions
+ ***********************************************/
+namespace bench
+{
+    /**
+     * @brief Timestamp of the i-th synthetic timeframe, one millisecond apart from 17:00:00.
+     */
+    inline std::string frameTime(std::size_t i)
+    {
+        std::uint64_t ms = (std::uint64_t)i;
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "2020/03/17 %02u:%02u:%02u.%06u",
+                      (unsigned)(17 + ms / 3600000), (unsigned)((ms / 60000) % 60),
+                      (unsigned)((ms / 1000) % 60), (unsigned)((ms % 1000) * 1000));
+        return buf;
+    }
+
+    /**
+     * @brief Products used by the synthetic books.
+     */
+    inline const std::vector<std::string> & products()
+    {
+        static const std::vector<std::string> p{"BTC/USDT", "DOGE/BTC", "ETH/BTC"};
+        return p;
+    }
+
+    /**
+     * @brief Deterministic book of n orders, BENCH_ORDERS_PER_FRAME per timeframe, in time order.
+     *
+     * Asks and bids straddle a common price so matching produces sales.
+     */
+    inline std::vector<OrderBookEntry> makeOrders(std::size_t n)
+    {
+        std::mt19937_64 rng(BENCH_SEED);
+        std::uniform_real_distribution<double> price(0.95, 1.05);
+        std::uniform_real_distribution<double> amount(0.1, 10.0);
+
+        std::vector<OrderBookEntry> orders;
+        orders.reserve(n);
+        std::string ts;
+        for(std::size_t i = 0; i < n; i++)
+        {
+            if(0 == i % BENCH_ORDERS_PER_FRAME) ts = frameTime(i / BENCH_ORDERS_PER_FRAME);
+            OrderBookType type = (rng() & 1) ? OrderBookType::ask : OrderBookType::bid;
+            orders.emplace_back(ts, products()[i % products().size()], type, 0.02 * price(rng), amount(rng));
+        }
+        return orders;
+    }
+
+    /**
+     * @brief Number of timeframes in a book made by makeOrders(n).
+     */
+    inline std::size_t frameCount(std::size_t n)
+    {
+        return (n + BENCH_ORDERS_PER_FRAME - 1) / BENCH_ORDERS_PER_FRAME;
+    }
+}
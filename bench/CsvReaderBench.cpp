@@ -0,0 +1,93 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file CsvReaderBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for CSV loading and parsing of orderbook entries.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "BenchData.h"
+#include "CsvReader.h"
+/** @cond STDINCLUDES */
+#include <cstdio>
+#include <fstream>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define BENCH_CSV_LINE "2020/03/17 17:01:24.884492,ETH/BTC,bid,0.02187308,7.44564869"
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+/**
+ *  Load a data set file of the given number of rows.
+ */
+static void BM_CsvReader_ReadCSV(benchmark::State & state)
+{
+    std::size_t n = (std::size_t)state.range(0);
+    std::string path = "/tmp/MerkleRex_bench_" + std::to_string(n) + ".csv";
+    {
+        std::ofstream out{path};
+        for(const OrderBookEntry & e : bench::makeOrders(n))
+        {
+            out << e._timestamp << ',' << e._product << ','
+                << ((OrderBookType::ask == e._OrderType) ? "ask" : "bid") << ','
+                << e._price << ',' << e._amount << '\n';
+        }
+    }
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(CsvReader::readCSV(path));
+    }
+    std::remove(path.c_str());
+    state.SetItemsProcessed((int64_t)state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_CsvReader_ReadCSV)->RangeMultiplier(10)->Range(BENCH_MIN_ORDERS, BENCH_MAX_ORDERS)
+                               ->Complexity()->Unit(benchmark::kMillisecond);
+
+/**
+ *  Split one data set line into tokens.
+ */
+static void BM_CsvReader_Tokenise(benchmark::State & state)
+{
+    std::string line{BENCH_CSV_LINE};
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(CsvReader::tokenise(line, ','));
+    }
+}
+BENCHMARK(BM_CsvReader_Tokenise);
+
+/**
+ *  Convert tokens of one line into an OrderBookEntry.
+ */
+static void BM_OrderBookEntry_StringsToOBE(benchmark::State & state)
+{
+    std::vector<std::string> tokens = CsvReader::tokenise(BENCH_CSV_LINE, ',');
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(OrderBookEntry::stringsToOBE(tokens));
+    }
+}
+BENCHMARK(BM_OrderBookEntry_StringsToOBE);
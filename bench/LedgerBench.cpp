@@ -0,0 +1,133 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LedgerBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for settling a tick of fills per fill versus netted in a SettlementBatch.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "Ledger.h"
+#include "SettlementBatch.h"
+#include "ConcurrentLedger.h"
+/** @cond STDINCLUDES */
+#include <mutex>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LEDGER_BENCH_FILLS 4096 /**< Fills per simulated tick. */
+#define LEDGER_BENCH_ACCOUNTS 4096 /**< Accounts shared by the threaded benchmarks. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief One tick of sales between n accounts; few accounts means dense market-maker fills.
+     */
+    std::vector<OrderBookEntry> tickSales(std::size_t accounts)
+    {
+        std::vector<OrderBookEntry> sales;
+        for(std::size_t i = 0; i < LEDGER_BENCH_FILLS; i++)
+        {
+            sales.emplace_back("2020/03/17 17:01:24.884492", "ETH/BTC", OrderBookType::ask, 0.02, 1.0);
+            sales.back().buyer  = (AccountId)(i % accounts);
+            sales.back().seller = (AccountId)((i * 7 + 1) % accounts);
+        }
+        return sales;
+    }
+
+    /**
+     * @brief Sales of one thread's tick, spread over every account so threads overlap.
+     */
+    std::vector<OrderBookEntry> threadSales(int thread)
+    {
+        std::vector<OrderBookEntry> sales = tickSales(LEDGER_BENCH_ACCOUNTS);
+        for(OrderBookEntry & s : sales) s.buyer = (AccountId)((s.buyer + 131u * (unsigned)thread) % LEDGER_BENCH_ACCOUNTS);
+        return sales;
+    }
+
+    void accountCounts(benchmark::internal::Benchmark * b)
+    {
+        b->RangeMultiplier(16)->Range(4, 65536);
+    }
+}
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+static void BM_Ledger_SettleEachFill(benchmark::State & state)
+{
+    std::vector<OrderBookEntry> sales = tickSales((std::size_t)state.range(0));
+    Ledger ledger;
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(ledger.settleAll(sales));
+    }
+    state.SetItemsProcessed((std::int64_t)(state.iterations() * sales.size()));
+}
+BENCHMARK(BM_Ledger_SettleEachFill)->Apply(accountCounts);
+
+static void BM_Ledger_SettleNetted(benchmark::State & state)
+{
+    std::vector<OrderBookEntry> sales = tickSales((std::size_t)state.range(0));
+    Ledger ledger;
+    SettlementBatch batch;
+    for(auto _ : state)
+    {
+        batch.addAll(sales);
+        benchmark::DoNotOptimize(batch.apply(ledger));
+    }
+    state.SetItemsProcessed((std::int64_t)(state.iterations() * sales.size()));
+}
+BENCHMARK(BM_Ledger_SettleNetted)->Apply(accountCounts);
+
+static void BM_Ledger_SettleSharedMutex(benchmark::State & state)
+{
+    static Ledger ledger;
+    static std::mutex lock;
+    std::vector<OrderBookEntry> sales = threadSales(state.thread_index());
+    for(auto _ : state)
+    {
+        for(const OrderBookEntry & sale : sales)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            ledger.settle(sale);
+        }
+    }
+    state.SetItemsProcessed((std::int64_t)(state.iterations() * sales.size()));
+}
+BENCHMARK(BM_Ledger_SettleSharedMutex)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ConcurrentLedger_Settle(benchmark::State & state)
+{
+    SymbolTable::instance().product("ETH/BTC");
+    static ConcurrentLedger ledger(LEDGER_BENCH_ACCOUNTS, SymbolTable::instance().currencyCount());
+    std::vector<OrderBookEntry> sales = threadSales(state.thread_index());
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(ledger.settleAll(sales));
+    }
+    state.SetItemsProcessed((std::int64_t)(state.iterations() * sales.size()));
+}
+BENCHMARK(BM_ConcurrentLedger_Settle)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,53 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LoggerBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for the asynchronous logger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <fstream>
+/** @endcond */
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+/**
+ * Cost to the logging thread of one per-sale record; formatting happens on the writer thread.
+ */
+static void BM_Logger_WriteSale(benchmark::State & state)
+{
+    std::ofstream devNull{"/dev/null"};
+    Logger::instance().setSink(&devNull);
+    double price = 0.02;
+    for(auto _ : state)
+    {
+        MRX_LOG_INFO("   Sale price: {} amount {}", price, 1.5);
+        price += 1e-9;
+    }
+    Logger::instance().flush();
+    Logger::instance().setSink(nullptr);
+    state.SetItemsProcessed((std::int64_t)state.iterations());
+}
+BENCHMARK(BM_Logger_WriteSale);
@@ -0,0 +1,74 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MarketDataBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for the shared-memory market data feed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "MarketDataFeed.h"
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define BENCH_FEED_NAME "merklerex_bench_feed"
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+/**
+ * Cost to the engine of publishing one trade.
+ */
+static void BM_Feed_Publish(benchmark::State & state)
+{
+    MarketDataPublisher feed;
+    feed.open(BENCH_FEED_NAME);
+    FeedMessage m{};
+    m.type = FeedMsgType::trade;
+    for(auto _ : state)
+    {
+        m.price += 1e-9;
+        feed.publish(m);
+    }
+    state.SetItemsProcessed((std::int64_t)state.iterations());
+}
+BENCHMARK(BM_Feed_Publish);
+
+/**
+ * Publishing and reading back one message through the same ring, as a reader that keeps up does.
+ */
+static void BM_Feed_PublishRead(benchmark::State & state)
+{
+    MarketDataPublisher feed;
+    feed.open(BENCH_FEED_NAME);
+    MarketDataReader reader;
+    reader.open(BENCH_FEED_NAME);
+    FeedMessage m{};
+    FeedMessage out;
+    m.type = FeedMsgType::trade;
+    for(auto _ : state)
+    {
+        feed.publish(m);
+        benchmark::DoNotOptimize(reader.next(out));
+    }
+    state.SetItemsProcessed((std::int64_t)state.iterations());
+}
+BENCHMARK(BM_Feed_PublishRead);
@@ -0,0 +1,154 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file OrderBookBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for OrderBook lookups, inserts and matching over growing book sizes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "BenchData.h"
+#include "OrderBook.h"
+/** @cond STDINCLUDES */
+#include <memory>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Book of n synthetic orders. Only the most recent size is kept to bound memory use.
+     */
+    const OrderBook & bookOfSize(std::size_t n)
+    {
+        static std::size_t cachedSize = 0;
+        static std::unique_ptr<OrderBook> cached;
+        if((nullptr == cached) || (cachedSize != n))
+        {
+            cached.reset();
+            cached.reset(new OrderBook());
+            cached->restore(bench::makeOrders(n));
+            cachedSize = n;
+        }
+        return *cached;
+    }
+
+    void bookSizes(benchmark::internal::Benchmark * b)
+    {
+        b->RangeMultiplier(10)->Range(BENCH_MIN_ORDERS, BENCH_MAX_ORDERS)->Complexity();
+    }
+}
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+/**
+ *  One product's asks in the middle timeframe of the book.
+ */
+static void BM_OrderBook_GetOrders(benchmark::State & state)
+{
+    OrderBook book = bookOfSize((std::size_t)state.range(0));
+    std::string ts = bench::frameTime(bench::frameCount((std::size_t)state.range(0)) / 2);
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(book.getOrders(OrderBookType::ask, "ETH/BTC", ts));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_OrderBook_GetOrders)->Apply(bookSizes);
+
+/**
+ *  Insert into existing timeframes spread over the book.
+ */
+static void BM_OrderBook_InsertOrder(benchmark::State & state)
+{
+    std::size_t n = (std::size_t)state.range(0);
+    std::size_t frames = bench::frameCount(n);
+    std::vector<OrderBookEntry> inserts;
+    for(std::size_t i = 0; i < 1024; i++)
+    {
+        inserts.emplace_back(bench::frameTime((i * 7919) % frames), "ETH/BTC", OrderBookType::bid, 0.02, 1.0);
+    }
+
+    OrderBook book = bookOfSize(n);
+    book.insertOrder(inserts[0]); //Detach from the shared copy outside the timed loop.
+    std::size_t i = 0;
+    for(auto _ : state)
+    {
+        book.insertOrder(inserts[i++ & 1023]);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_OrderBook_InsertOrder)->Apply(bookSizes);
+
+/**
+ *  Match every product's asks and bids in the middle timeframe of the book.
+ */
+static void BM_OrderBook_MatchAsksToBids(benchmark::State & state)
+{
+    OrderBook book = bookOfSize((std::size_t)state.range(0));
+    std::string ts = bench::frameTime(bench::frameCount((std::size_t)state.range(0)) / 2);
+    for(auto _ : state)
+    {
+        for(const std::string & p : bench::products())
+        {
+            benchmark::DoNotOptimize(book.matchAsksToBids(p, ts));
+        }
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_OrderBook_MatchAsksToBids)->Apply(bookSizes);
+
+/**
+ *  Matching cost against the size of a single timeframe.
+ */
+static void BM_OrderBook_MatchFrameSize(benchmark::State & state)
+{
+    std::vector<OrderBookEntry> orders = bench::makeOrders((std::size_t)state.range(0) * BENCH_ORDERS_PER_FRAME);
+    std::string ts = orders.front()._timestamp;
+    for(OrderBookEntry & e : orders) e._timestamp = ts;
+    OrderBook book;
+    book.restore(std::move(orders));
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(book.matchAsksToBids("ETH/BTC", ts));
+    }
+    state.SetComplexityN(state.range(0) * BENCH_ORDERS_PER_FRAME);
+}
+BENCHMARK(BM_OrderBook_MatchFrameSize)->RangeMultiplier(10)->Range(1, 100)->Complexity();
+
+/**
+ *  Advance the simulation clock from every timeframe in turn.
+ */
+static void BM_OrderBook_GetNextTime(benchmark::State & state)
+{
+    OrderBook book = bookOfSize((std::size_t)state.range(0));
+    std::string ts = book.getEarliestTime();
+    for(auto _ : state)
+    {
+        ts = book.getNextTime(ts);
+        benchmark::DoNotOptimize(ts.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_OrderBook_GetNextTime)->Apply(bookSizes);
@@ -0,0 +1,132 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file WalletBench.cpp
+ * @author Edward Martinez
+ * @brief Microbenchmarks for Wallet operations over growing numbers of currencies.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <benchmark/benchmark.h>
+#include "Wallet.h"
+/** @cond STDINCLUDES */
+#include <string>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Wallet holding BTC, ETH and n - 2 filler currencies.
+     */
+    Wallet walletOfSize(std::size_t n)
+    {
+        Wallet w;
+        w.insertCurrency("BTC", 1e9);
+        w.insertCurrency("ETH", 1e9);
+        for(std::size_t i = 2; i < n; i++) w.insertCurrency("C" + std::to_string(i), 1.0);
+        return w;
+    }
+
+    void walletSizes(benchmark::internal::Benchmark * b)
+    {
+        b->RangeMultiplier(8)->Range(2, 4096)->Complexity();
+    }
+
+}
+/********************************************//**
+ *  Benchmarks
+ ***********************************************/
+static void BM_Wallet_InsertCurrency(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    for(auto _ : state)
+    {
+        w.insertCurrency("ETH", 1.0);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_InsertCurrency)->Apply(walletSizes);
+
+static void BM_Wallet_ContainsCurrency(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(w.containsCurrency("ETH", 1.0));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_ContainsCurrency)->Apply(walletSizes);
+
+static void BM_Wallet_RemoveCurrency(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(w.removeCurrency("ETH", 1e-9));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_RemoveCurrency)->Apply(walletSizes);
+
+static void BM_Wallet_ContainsCurrencyId(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    CurrencyId eth = SymbolTable::instance().currency("ETH");
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(w.containsCurrency(eth, 1.0));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_ContainsCurrencyId)->Apply(walletSizes);
+
+static void BM_Wallet_CanFulfillOrder(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    OrderBookEntry bid{"2020/03/17 17:01:24.884492", "ETH/BTC", OrderBookType::bid, 0.02, 1.0};
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(w.canFulfillOrder(bid));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_CanFulfillOrder)->Apply(walletSizes);
+
+/**
+ *  Alternating buy and sell fills so balances stay bounded.
+ */
+static void BM_Wallet_ProcessSale(benchmark::State & state)
+{
+    Wallet w = walletOfSize((std::size_t)state.range(0));
+    OrderBookEntry buy{"2020/03/17 17:01:24.884492", "ETH/BTC", OrderBookType::bidsale, 0.02, 1.0};
+    OrderBookEntry sell{"2020/03/17 17:01:24.884492", "ETH/BTC", OrderBookType::asksale, 0.02, 1.0};
+    bool flip = false;
+    for(auto _ : state)
+    {
+        w.processSale(flip ? buy : sell);
+        flip = !flip;
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Wallet_ProcessSale)->Apply(walletSizes);
@@ -0,0 +1,276 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file AgentSimulator.cpp
+ * @author Edward Martinez
+ * @brief Source file for the agent-based order flow simulator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "AgentSimulator.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define AGENT_CANDLE_RESOLUTION 0   /**< 1s candles of the default CandleBuilder give the last price. */
+#define AGENT_ROLLING_WINDOW    0   /**< 1m window of the default RollingStats gives the trailing VWAP. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    double secondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double perSecond(std::size_t count, double seconds)
+    {
+        return (seconds > 0.0) ? (double)count / seconds : 0.0;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Creates and funds the agents.
+ *
+ * Agents are numbered market makers first, then momentum, then noise traders, and agent i
+ * trades product i modulo the number of products. The opening price of each product is the
+ * mid of its first timeframe's book.
+ * @param app Engine with a loaded data set, initialised (MerkelMain::init()) and not yet stepped.
+ * @param options Population and behaviour.
+ */
+AgentSimulator::AgentSimulator(MerkelMain & app, const AgentSimOptions & options)
+: app(app),
+  options(options),
+  pool(options.threads)
+{
+    if(MerkelState::READY != app.getCurrentState())
+    {
+        throw std::runtime_error(std::string("AgentSimulator::AgentSimulator - Engine has no data set."));
+    }
+    OrderBook book = app.getOrders();
+    market.products = book.getKnownProducts();
+    if(market.products.empty())
+    {
+        throw std::runtime_error(std::string("AgentSimulator::AgentSimulator - Data set has no products."));
+    }
+    std::vector<std::string> currencies;
+    for(const std::string & p : market.products)
+    {
+        ProductPair pair = SymbolTable::instance().product(p);
+        market.pairs.push_back(pair);
+        currencies.push_back(SymbolTable::instance().currencyName(pair.base));
+        currencies.push_back(SymbolTable::instance().currencyName(pair.quote));
+
+        OrderBookDepth depth;
+        double mid = 0.0;
+        if(book.getBookAt(p, app.getCurrentTime(), depth))
+        {
+            if(!depth.asks.empty() && !depth.bids.empty()) mid = (depth.asks.front()._price + depth.bids.front()._price) / 2.0;
+            else if(!depth.asks.empty())                   mid = depth.asks.front()._price;
+            else if(!depth.bids.empty())                   mid = depth.bids.front()._price;
+        }
+        market.last.push_back(mid);
+        market.average.push_back(mid);
+    }
+    std::sort(currencies.begin(), currencies.end());
+    currencies.erase(std::unique(currencies.begin(), currencies.end()), currencies.end());
+    market.ledger = &app.getLedger();
+
+    std::size_t n = options.marketMakers + options.momentum + options.noise;
+    AccountId first = app.openAccounts(n, currencies, options.funds);
+    agents.reserve(n);
+    for(std::size_t i = 0; i < n; i++)
+    {
+        AccountId account   = first + (AccountId)i;
+        std::size_t product = i % market.products.size();
+        if(i < options.marketMakers)
+        {
+            agents.emplace_back(new MarketMakerAgent(account, product, options.seed, options.spread, options.size));
+        }
+        else if(i < options.marketMakers + options.momentum)
+        {
+            agents.emplace_back(new MomentumAgent(account, product, options.seed, options.threshold, options.size));
+        }
+        else
+        {
+            agents.emplace_back(new NoiseAgent(account, product, options.seed, options.width, options.size));
+        }
+    }
+    chunks.resize((n + AGENT_CHUNK - 1) / AGENT_CHUNK);
+}
+
+/**
+ * @brief Number of agents.
+ */
+std::size_t AgentSimulator::getAgentCount() const
+{
+    return agents.size();
+}
+
+/**
+ * @brief The market view agents acted on in the last timeframe.
+ */
+const AgentMarket & AgentSimulator::getMarket() const
+{
+    return this->market;
+}
+
+/**
+ * @brief Simulates timeframes until the data set wraps around or options.maxTicks is reached.
+ * @return Totals and the time spent generating, submitting and matching orders.
+ */
+AgentSimStats AgentSimulator::run()
+{
+    AgentSimStats stats;
+    stats.agents = agents.size();
+    Clock::time_point wallStart = Clock::now();
+    std::uint64_t stealsBefore = pool.getSteals();
+    std::string previous;
+    do
+    {
+        previous = app.getCurrentTime();
+        this->updateMarket();
+
+        Clock::time_point start = Clock::now();
+        pool.run(chunks.size(), [this](std::size_t task, unsigned)
+        {
+            std::vector<OrderBookEntry> & out = chunks[task];
+            out.clear();
+            std::size_t end = std::min(agents.size(), (task + 1) * AGENT_CHUNK);
+            for(std::size_t i = task * AGENT_CHUNK; i < end; i++) agents[i]->act(market, out);
+        });
+        stats.generateSeconds += secondsSince(start);
+
+        start = Clock::now();
+        for(std::vector<OrderBookEntry> & out : chunks)
+        {
+            stats.generated += out.size();
+            stats.accepted  += app.submitOrders(out);
+        }
+        stats.submitSeconds += secondsSince(start);
+
+        start = Clock::now();
+        TickStats tick = app.processNext();
+        stats.matchSeconds += secondsSince(start);
+        stats.orders += tick.orders;
+        stats.fills  += tick.sales;
+        stats.ticks++;
+    } while((app.getCurrentTime() > previous) && ((0 == options.maxTicks) || (stats.ticks < options.maxTicks)));
+    stats.steals = pool.getSteals() - stealsBefore;
+    stats.wallSeconds = secondsSince(wallStart);
+    return stats;
+}
+
+/**
+ * @brief Moves the market view to the current timeframe and refreshes the last price and
+ * trailing VWAP of every product that has traded.
+ */
+void AgentSimulator::updateMarket()
+{
+    market.timestamp = app.getCurrentTime();
+    const CandleBuilder & candles = app.getCandles();
+    const RollingStats & rolling  = app.getRollingStats();
+    for(std::size_t p = 0; p < market.products.size(); p++)
+    {
+        const Candle * candle = candles.getCurrent(market.products[p], AGENT_CANDLE_RESOLUTION);
+        if((nullptr != candle) && (candle->trades > 0)) market.last[p] = candle->close;
+        RollingSnapshot snap;
+        bool recent = rolling.get(market.products[p], AGENT_ROLLING_WINDOW, snap) && (snap.trades > 0);
+        market.average[p] = recent ? snap.vwap : market.last[p];
+    }
+}
+
+/**
+ * @brief Reads command line options.
+ * @return FALSE on an unknown option or a missing data set.
+ */
+bool AgentSimulator::parseArgs(int argc, char ** argv, AgentSimOptions & options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--market-makers" == arg)) options.marketMakers = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--momentum" == arg)) options.momentum     = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--noise" == arg))    options.noise        = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--seed" == arg))     options.seed         = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--threads" == arg))  options.threads      = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        else if(hasValue && ("--max-ticks" == arg)) options.maxTicks    = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--funds" == arg))    options.funds        = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--size" == arg))     options.size         = std::strtod(argv[++i], nullptr);
+        else if((arg.size() > 1) && ('-' == arg[0])) return false;
+        else options.dataset = arg;
+    }
+    return !options.dataset.empty();
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void AgentSimulator::printUsage(std::ostream & os, const char * program)
+{
+    AgentSimOptions d;
+    os << "Usage: " << program << " [options] <dataset.csv>\n"
+       << "   --market-makers N   Market maker agents (default " << d.marketMakers << ")\n"
+       << "   --momentum N        Momentum agents (default " << d.momentum << ")\n"
+       << "   --noise N           Noise trader agents (default " << d.noise << ")\n"
+       << "   --seed S            Random seed; a seed gives the same run on any thread count (default " << d.seed << ")\n"
+       << "   --threads N         Pool threads (default: all hardware threads)\n"
+       << "   --max-ticks N       Stop after N timeframes (default: the whole data set)\n"
+       << "   --funds F           Deposit in each currency per agent (default " << d.funds << ")\n"
+       << "   --size A            Typical order amount (default " << d.size << ")\n";
+}
+
+/**
+ * @brief Prints simulation totals and rates.
+ */
+void AgentSimulator::printStats(std::ostream & os, const AgentSimStats & stats)
+{
+    os << std::fixed << std::setprecision(3)
+       << "Agent simulation summary\n"
+       << "   Agents       : " << stats.agents << '\n'
+       << "   Ticks        : " << stats.ticks << '\n'
+       << "   Generated    : " << stats.generated << '\n'
+       << "   Accepted     : " << stats.accepted << '\n'
+       << "   Orders       : " << stats.orders << '\n'
+       << "   Fills        : " << stats.fills << '\n'
+       << "   Steals       : " << stats.steals << '\n'
+       << "   Generate     : " << stats.generateSeconds << " s\n"
+       << "   Submit       : " << stats.submitSeconds << " s\n"
+       << "   Match        : " << stats.matchSeconds << " s\n"
+       << "   Wall time    : " << stats.wallSeconds << " s\n"
+       << std::setprecision(0)
+       << "   Generated/s  : " << perSecond(stats.generated, stats.generateSeconds) << '\n'
+       << "   Orders/s     : " << perSecond(stats.orders, stats.wallSeconds) << '\n'
+       << "   Fills/s      : " << perSecond(stats.fills, stats.wallSeconds) << '\n';
+}
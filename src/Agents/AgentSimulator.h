@@ -0,0 +1,116 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file AgentSimulator.h
+ * @author Edward Martinez
+ * @brief Header file for the agent-based order flow simulator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "TradingAgents.h"
+#include "WorkStealingPool.h"
+#include "UserMenuIF.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define AGENT_CHUNK 256     /**< Agents per pool task. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct AgentSimOptions
+    @brief Population and behaviour of a simulation.
+*/
+struct AgentSimOptions
+{
+    std::string dataset;                /**< Data set providing the timeframes and the background order flow. */
+    std::size_t marketMakers = 1000;
+    std::size_t momentum     = 1000;
+    std::size_t noise        = 2000;
+    std::uint64_t seed       = 1;
+    unsigned threads         = 0;       /**< Pool threads; 0 uses every hardware thread. Results do not depend on it. */
+    std::size_t maxTicks     = 0;       /**< Timeframes to simulate; 0 runs the whole data set once. */
+    double funds             = 1000.0;  /**< Deposited in each traded currency of every agent account. */
+    double size              = 0.5;     /**< Typical order amount. */
+    double spread            = 0.002;   /**< Market maker quoted spread, relative to the last price. */
+    double threshold         = 0.001;   /**< Momentum trigger distance from the trailing average. */
+    double width             = 0.005;   /**< Largest noise order distance from the last price. */
+};
+
+/*! @struct AgentSimStats
+    @brief Totals of a simulation.
+*/
+struct AgentSimStats
+{
+    std::size_t agents    = 0;
+    std::size_t ticks     = 0;
+    std::size_t generated = 0;  /**< Orders produced by agents. */
+    std::size_t accepted  = 0;  /**< Agent orders that passed the ledger check and entered the book. */
+    std::size_t orders    = 0;  /**< Orders matched, data set orders included. */
+    std::size_t fills     = 0;
+    std::uint64_t steals  = 0;  /**< Pool tasks run by a thread other than the one they were dealt to. */
+    double generateSeconds = 0.0;
+    double submitSeconds   = 0.0;
+    double matchSeconds    = 0.0;
+    double wallSeconds     = 0.0;
+};
+
+/*! @class AgentSimulator
+    @brief Drives a MerkelMain with order flow from thousands of simulated traders.
+
+    Every agent gets its own ledger account, funded in the currencies of the data set's
+    products. Each timeframe:
+    - the market view (last price and trailing VWAP per product, from MerkelMain's candles and
+      rolling statistics) is refreshed;
+    - agents act in parallel on a WorkStealingPool, in chunks of AGENT_CHUNK agents that each
+      write to their own buffer;
+    - the buffers are submitted through MerkelMain::submitOrders() in chunk order, and
+      processNext() matches and settles the timeframe.
+    Agents draw from their own random streams and the buffers are merged in a fixed order, so
+    a simulation is deterministic for a given seed whatever the thread count.
+*/
+class AgentSimulator
+{
+    public:
+        AgentSimulator(MerkelMain & app, const AgentSimOptions & options);
+        std::size_t getAgentCount() const;
+        const AgentMarket & getMarket() const;
+        AgentSimStats run();
+        static bool parseArgs(int argc, char ** argv, AgentSimOptions & options);
+        static void printUsage(std::ostream & os, const char * program);
+        static void printStats(std::ostream & os, const AgentSimStats & stats);
+    private:
+        void updateMarket();
+        MerkelMain & app;
+        AgentSimOptions options;
+        AgentMarket market;
+        std::vector<std::unique_ptr<TradingAgent>> agents;
+        std::vector<std::vector<OrderBookEntry>> chunks;
+        WorkStealingPool pool;
+};
@@ -0,0 +1,201 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file TradingAgents.cpp
+ * @author Edward Martinez
+ * @brief Source file for simulated traders: market makers, momentum and noise traders.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "TradingAgents.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define AGENT_MIN_AMOUNT 1e-9       /**< Orders smaller than this are not placed. */
+#define AGENT_FUNDS_MARGIN 1e-9     /**< Share of a balance left unspent so rounding never overdraws it. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief SplitMix64 step, used to derive independent agent streams from the seed.
+     */
+    std::uint64_t splitMix(std::uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Seeds stream number stream of a simulation seeded with seed.
+ */
+AgentRng::AgentRng(std::uint64_t seed, std::uint64_t stream)
+: state(splitMix(seed ^ splitMix(stream)))
+{
+    if(0 == state) state = 0x9E3779B97F4A7C15ull;
+}
+
+/**
+ * @brief Constructor.
+ * @param account Ledger account the agent trades from.
+ * @param product Index of the traded product in AgentMarket::products.
+ * @param seed Seed of the agent's random stream.
+ */
+TradingAgent::TradingAgent(AccountId account, std::size_t product, std::uint64_t seed)
+: account(account),
+  product(product),
+  rng(seed, account)
+{
+}
+
+/**
+ * @brief Ledger account of the agent.
+ */
+AccountId TradingAgent::getAccount() const
+{
+    return this->account;
+}
+
+/**
+ * @brief The agent's base and quote balances in its product, as of the start of the timeframe.
+ */
+TradingAgent::Budget TradingAgent::budget(const AgentMarket & market) const
+{
+    const ProductPair & pair = market.pairs[product];
+    return Budget{market.ledger->getBalance(account, pair.base) * (1.0 - AGENT_FUNDS_MARGIN),
+                  market.ledger->getBalance(account, pair.quote) * (1.0 - AGENT_FUNDS_MARGIN)};
+}
+
+/**
+ * @brief Appends an ask or bid, cut down to what the remaining budget can pay for.
+ */
+void TradingAgent::place(const AgentMarket & market, Budget & funds, OrderBookType type, double price, double amount,
+                         std::vector<OrderBookEntry> & out) const
+{
+    if(price <= 0.0) return;
+    if(OrderBookType::ask == type)
+    {
+        amount = std::min(amount, funds.base);
+        if(amount < AGENT_MIN_AMOUNT) return;
+        funds.base -= amount;
+    }
+    else
+    {
+        amount = std::min(amount, funds.quote / price);
+        if(amount < AGENT_MIN_AMOUNT) return;
+        funds.quote -= amount * price;
+    }
+    out.emplace_back(market.timestamp, market.products[product], type, price, amount);
+    out.back().username = AGENT_USER_NAME;
+    out.back().account  = account;
+}
+
+/**
+ * @brief Constructor.
+ * @param spread Full quoted spread as a fraction of the last price.
+ * @param size Typical quote amount.
+ */
+MarketMakerAgent::MarketMakerAgent(AccountId account, std::size_t product, std::uint64_t seed, double spread, double size)
+: TradingAgent(account, product, seed),
+  halfSpread(spread / 2.0),
+  size(size)
+{
+}
+
+/**
+ * @brief Quotes both sides. Quotes shift down as the agent accumulates base currency and up as it sells it.
+ */
+void MarketMakerAgent::act(const AgentMarket & market, std::vector<OrderBookEntry> & out)
+{
+    double p = market.last[product];
+    if(p <= 0.0) return;
+    Budget funds = this->budget(market);
+    if(startBase < 0.0) startBase = funds.base;
+
+    double inventory = (startBase > 0.0) ? (funds.base - startBase) / startBase : 0.0;
+    double skew      = std::max(-halfSpread, std::min(halfSpread, inventory * halfSpread));
+    double jitter    = (rng.uniform() - 0.5) * halfSpread * 0.5;
+    double amount    = size * (0.5 + rng.uniform());
+    this->place(market, funds, OrderBookType::bid, p * (1.0 - halfSpread - skew + jitter), amount, out);
+    this->place(market, funds, OrderBookType::ask, p * (1.0 + halfSpread - skew + jitter), amount, out);
+}
+
+/**
+ * @brief Constructor.
+ * @param threshold Relative distance from the trailing average that triggers a trade.
+ * @param size Typical order amount.
+ */
+MomentumAgent::MomentumAgent(AccountId account, std::size_t product, std::uint64_t seed, double threshold, double size)
+: TradingAgent(account, product, seed),
+  threshold(threshold),
+  size(size)
+{
+}
+
+/**
+ * @brief Half of the time, follows a move of the last price away from the trailing average.
+ */
+void MomentumAgent::act(const AgentMarket & market, std::vector<OrderBookEntry> & out)
+{
+    double p   = market.last[product];
+    double avg = market.average[product];
+    if((p <= 0.0) || (rng.uniform() < 0.5)) return;
+    Budget funds  = this->budget(market);
+    double amount = size * (0.5 + rng.uniform());
+    if(p > avg * (1.0 + threshold))      this->place(market, funds, OrderBookType::bid, p * (1.0 + threshold), amount, out);
+    else if(p < avg * (1.0 - threshold)) this->place(market, funds, OrderBookType::ask, p * (1.0 - threshold), amount, out);
+}
+
+/**
+ * @brief Constructor.
+ * @param width Largest relative distance of an order from the last price.
+ * @param size Typical order amount.
+ */
+NoiseAgent::NoiseAgent(AccountId account, std::size_t product, std::uint64_t seed, double width, double size)
+: TradingAgent(account, product, seed),
+  width(width),
+  size(size)
+{
+}
+
+/**
+ * @brief Half of the time, sends an ask or bid priced uniformly within width of the last price.
+ */
+void NoiseAgent::act(const AgentMarket & market, std::vector<OrderBookEntry> & out)
+{
+    double p = market.last[product];
+    if((p <= 0.0) || (rng.uniform() < 0.5)) return;
+    Budget funds       = this->budget(market);
+    OrderBookType type = (rng.next() & 1) ? OrderBookType::bid : OrderBookType::ask;
+    double price       = p * (1.0 + (rng.uniform() - 0.5) * 2.0 * width);
+    double amount      = size * (0.5 + rng.uniform());
+    this->place(market, funds, type, price, amount, out);
+}
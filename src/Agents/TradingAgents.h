@@ -0,0 +1,146 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file TradingAgents.h
+ * @author Edward Martinez
+ * @brief Header file for simulated traders: market makers, momentum and noise traders.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "../OrderBookLib/OrderBookLib.h"
+#include "../OrderBookLib/SymbolTable.h"
+#include "../Ledger/Ledger.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define AGENT_USER_NAME "agent"   /**< username of agent orders. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct AgentRng
+    @brief Small per-agent random stream (xorshift64*), so agents draw independently of thread scheduling.
+*/
+struct AgentRng
+{
+    std::uint64_t state;
+    AgentRng(std::uint64_t seed, std::uint64_t stream);
+    inline std::uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+    /** Uniform in [0, 1). */
+    inline double uniform()
+    {
+        return (double)(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+};
+
+/*! @struct AgentMarket
+    @brief What agents see of the market at the start of a timeframe. Read-only while agents act.
+*/
+struct AgentMarket
+{
+    std::string timestamp;          /**< Timeframe the agents' orders are for. */
+    std::vector<std::string> products;
+    std::vector<ProductPair> pairs;
+    std::vector<double> last;       /**< Last trade price per product (the opening mid before any trade). */
+    std::vector<double> average;    /**< Trailing 1 minute VWAP per product, or last without recent trades. */
+    const Ledger * ledger = nullptr;
+};
+
+/*! @class TradingAgent
+    @brief A simulated trader with its own ledger account, trading one product.
+
+    act() is called once per timeframe, possibly on any thread and concurrently with other
+    agents, and appends the agent's asks and bids to out. An agent never offers more than its
+    ledger balances at the start of the timeframe, so every order it places can be settled.
+*/
+class TradingAgent
+{
+    public:
+        TradingAgent(AccountId account, std::size_t product, std::uint64_t seed);
+        virtual ~TradingAgent() = default;
+        virtual void act(const AgentMarket & market, std::vector<OrderBookEntry> & out) = 0;
+        AccountId getAccount() const;
+    protected:
+        /*! Balances an agent may still commit in the current timeframe. */
+        struct Budget
+        {
+            double base;
+            double quote;
+        };
+        Budget budget(const AgentMarket & market) const;
+        void place(const AgentMarket & market, Budget & funds, OrderBookType type, double price, double amount,
+                   std::vector<OrderBookEntry> & out) const;
+        AccountId account;
+        std::size_t product;    /**< Index into AgentMarket::products. */
+        AgentRng rng;
+};
+
+/*! @class MarketMakerAgent
+    @brief Quotes a bid and an ask around the last price, leaning against its inventory.
+*/
+class MarketMakerAgent : public TradingAgent
+{
+    public:
+        MarketMakerAgent(AccountId account, std::size_t product, std::uint64_t seed, double spread, double size);
+        void act(const AgentMarket & market, std::vector<OrderBookEntry> & out) override;
+    private:
+        double halfSpread;
+        double size;
+        double startBase = -1.0;    /**< Base balance at the first timeframe; inventory is measured from it. */
+};
+
+/*! @class MomentumAgent
+    @brief Buys above the trailing average and sells below it, crossing the spread.
+*/
+class MomentumAgent : public TradingAgent
+{
+    public:
+        MomentumAgent(AccountId account, std::size_t product, std::uint64_t seed, double threshold, double size);
+        void act(const AgentMarket & market, std::vector<OrderBookEntry> & out) override;
+    private:
+        double threshold;
+        double size;
+};
+
+/*! @class NoiseAgent
+    @brief Sometimes sends a random ask or bid near the last price.
+*/
+class NoiseAgent : public TradingAgent
+{
+    public:
+        NoiseAgent(AccountId account, std::size_t product, std::uint64_t seed, double width, double size);
+        void act(const AgentMarket & market, std::vector<OrderBookEntry> & out) override;
+    private:
+        double width;
+        double size;
+};
@@ -0,0 +1,192 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file WorkStealingPool.cpp
+ * @author Edward Martinez
+ * @brief Source file for a fork-join thread pool with per-worker task queues and stealing.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "WorkStealingPool.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param threads Threads running tasks, the caller of run() included; 0 uses every hardware thread.
+ */
+WorkStealingPool::WorkStealingPool(unsigned threads)
+: nThreads((0 == threads) ? std::max(1u, std::thread::hardware_concurrency()) : threads),
+  queues(new TaskQueue[nThreads])
+{
+    for(unsigned w = 1; w < nThreads; w++)
+    {
+        workers.emplace_back([this, w](){ this->workerLoop(w); });
+    }
+}
+
+/**
+ * @brief Destructor. Stops the worker threads.
+ */
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(std::thread & w : workers) w.join();
+}
+
+/**
+ * @brief Threads running tasks, the caller of run() included.
+ */
+unsigned WorkStealingPool::getThreadCount() const
+{
+    return this->nThreads;
+}
+
+/**
+ * @brief Tasks taken from another worker's queue since construction.
+ */
+std::uint64_t WorkStealingPool::getSteals() const
+{
+    return steals.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Runs task(0, w) ... task(tasks - 1, w) and waits until every one has finished.
+ *
+ * Each task runs exactly once, on whichever worker w reaches it; a task may use w to index
+ * per-worker scratch space. The first exception thrown by a task is rethrown here after the
+ * batch completes.
+ */
+void WorkStealingPool::run(std::size_t tasks, const PoolTask & task)
+{
+    if(0 == tasks) return;
+    if(workers.empty() || (1 == tasks))
+    {
+        for(std::size_t i = 0; i < tasks; i++) task(i, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for(unsigned w = 0; w < nThreads; w++)
+        {
+            std::lock_guard<std::mutex> q(queues[w].lock);
+            queues[w].front = tasks * w / nThreads;
+            queues[w].back  = tasks * (w + 1) / nThreads;
+        }
+        current = &task;
+        error   = nullptr;
+        generation++;
+    }
+    wake.notify_all();
+    this->work(0);
+
+    std::exception_ptr failed;
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        finished.wait(guard, [this](){ return 0 == active; });
+        current = nullptr;
+        failed  = std::move(error);
+    }
+    if(failed) std::rethrow_exception(failed);
+}
+
+/**
+ * @brief Takes the next task from the front of a worker's own queue.
+ */
+bool WorkStealingPool::take(unsigned worker, std::size_t & task)
+{
+    TaskQueue & q = queues[worker];
+    std::lock_guard<std::mutex> guard(q.lock);
+    if(q.front >= q.back) return false;
+    task = q.front++;
+    return true;
+}
+
+/**
+ * @brief Takes a task from the back of another worker's queue, trying each queue once.
+ */
+bool WorkStealingPool::steal(unsigned worker, std::size_t & task)
+{
+    for(unsigned i = 1; i < nThreads; i++)
+    {
+        TaskQueue & q = queues[(worker + i) % nThreads];
+        std::lock_guard<std::mutex> guard(q.lock);
+        if(q.front >= q.back) continue;
+        task = --q.back;
+        steals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Runs tasks of the current batch, own queue first, until no queue has any left.
+ *
+ * Tasks are never added during a batch, so once every queue was seen empty the worker is done.
+ */
+void WorkStealingPool::work(unsigned worker)
+{
+    std::size_t task;
+    while(this->take(worker, task) || this->steal(worker, task))
+    {
+        try
+        {
+            (*current)(task, worker);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if(!error) error = std::current_exception();
+        }
+    }
+}
+
+/**
+ * @brief Worker thread body: joins each batch as it starts.
+ *
+ * The caller of run() waits for every worker that joined, so current stays valid while any
+ * of them runs tasks. A worker that wakes after the batch ended finds nothing to do.
+ */
+void WorkStealingPool::workerLoop(unsigned worker)
+{
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> guard(lock);
+    for(;;)
+    {
+        wake.wait(guard, [&](){ return stopping || (generation != seen); });
+        if(stopping) return;
+        seen = generation;
+        if(nullptr == current) continue;
+        active++;
+        guard.unlock();
+        this->work(worker);
+        guard.lock();
+        if(0 == --active) finished.notify_all();
+    }
+}
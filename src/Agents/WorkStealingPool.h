@@ -0,0 +1,96 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file WorkStealingPool.h
+ * @author Edward Martinez
+ * @brief Header file for a fork-join thread pool with per-worker task queues and stealing.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define POOL_CACHE_LINE 64 /**< Queues are padded to two lines so neighbours never share one, whatever their alignment. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** A task of WorkStealingPool::run(): task index and the index of the worker running it. */
+typedef std::function<void(std::size_t task, unsigned worker)> PoolTask;
+
+/*! @class WorkStealingPool
+    @brief Runs batches of indexed tasks on persistent threads, balancing them by work stealing.
+
+    run() deals the tasks out as one contiguous block per worker (the calling thread is worker
+    0). A worker takes tasks from the front of its own queue and, once that is empty, steals
+    from the back of the other queues, so uneven tasks still finish together while neighbouring
+    tasks mostly stay on one thread. Queues are short-lived index ranges guarded by their own
+    mutex, which is cheap for tasks of a few microseconds or more.
+*/
+class WorkStealingPool
+{
+    public:
+        WorkStealingPool(unsigned threads = 0);
+        ~WorkStealingPool();
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool & operator=(const WorkStealingPool &) = delete;
+        unsigned getThreadCount() const;
+        void run(std::size_t tasks, const PoolTask & task);
+        std::uint64_t getSteals() const;
+    private:
+        /*! Tasks [front, back) still waiting in one worker's queue. */
+        struct TaskQueue
+        {
+            std::mutex lock;
+            std::size_t front = 0;
+            std::size_t back  = 0;
+            char pad[2 * POOL_CACHE_LINE - sizeof(std::mutex) - 2 * sizeof(std::size_t)];
+        };
+        static_assert(sizeof(TaskQueue) == 2 * POOL_CACHE_LINE, "TaskQueue must fill exactly two cache lines.");
+        bool take(unsigned worker, std::size_t & task);
+        bool steal(unsigned worker, std::size_t & task);
+        void work(unsigned worker);
+        void workerLoop(unsigned worker);
+        unsigned nThreads;
+        std::unique_ptr<TaskQueue[]> queues;
+        std::vector<std::thread> workers;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::condition_variable finished;
+        std::uint64_t generation = 0;
+        unsigned active = 0;
+        bool stopping = false;
+        const PoolTask * current = nullptr;
+        std::exception_ptr error;
+        std::atomic<std::uint64_t> steals{0};
+};
@@ -0,0 +1,230 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file CandleBuilder.cpp
+ * @author Edward Martinez
+ * @brief Source file for multi-resolution OHLCV candle aggregation.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "CandleBuilder.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define CANDLE_DEFAULT_HISTORY 1024
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param capacity Number of candles kept before the oldest is overwritten.
+ */
+CandleRing::CandleRing(std::size_t capacity)
+: slots(std::max<std::size_t>(capacity,1)),
+  head(0),
+  count(0)
+{
+}
+
+/**
+ * @brief Appends a finished candle.
+ */
+void CandleRing::push(const Candle & candle)
+{
+    slots[head] = candle;
+    head = (head + 1 == slots.size()) ? 0 : head + 1;
+    if(count < slots.size()) count++;
+}
+
+/**
+ * @brief Number of candles held.
+ */
+std::size_t CandleRing::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the i-th held candle, 0 being the oldest.
+ */
+const Candle & CandleRing::at(std::size_t i) const
+{
+    if(i >= count) throw std::out_of_range(std::string("CandleRing::at - Index out of range."));
+    std::size_t oldest = (head + slots.size() - count) % slots.size();
+    return slots[(oldest + i) % slots.size()];
+}
+
+/**
+ * @brief Returns the most recently finished candle. The ring must not be empty.
+ */
+const Candle & CandleRing::newest() const
+{
+    return this->at(count - 1);
+}
+
+/**
+ * @brief Constructor using 1s, 1m, 5m and 1h resolutions.
+ */
+CandleBuilder::CandleBuilder()
+: CandleBuilder({CANDLE_MICROS_1S, CANDLE_MICROS_1M, CANDLE_MICROS_5M, CANDLE_MICROS_1H}, CANDLE_DEFAULT_HISTORY)
+{
+}
+
+/**
+ * @brief Constructor.
+ * @param resolutions Candle lengths in microseconds.
+ * @param historyLen Finished candles kept per product and resolution.
+ */
+CandleBuilder::CandleBuilder(const std::vector<std::int64_t> & resolutions, std::size_t historyLen)
+: resolutions(resolutions),
+  historyLen(historyLen),
+  lastSeries(nullptr),
+  lastMicros(-1)
+{
+    for(std::int64_t r : resolutions)
+    {
+        if(r <= 0) throw std::runtime_error(std::string("CandleBuilder - Resolutions must be positive."));
+    }
+}
+
+/**
+ * @brief Adds a sale produced by OrderBook::matchAsksToBids().
+ */
+void CandleBuilder::onSale(const OrderBookEntry & sale)
+{
+    this->onTrade(sale._product, this->toMicros(sale._timestamp), sale._price, sale._amount);
+}
+
+/**
+ * @brief Adds an order as a price observation, for builders fed from the order stream.
+ */
+void CandleBuilder::onOrder(const OrderBookEntry & order)
+{
+    this->onTrade(order._product, this->toMicros(order._timestamp), order._price, order._amount);
+}
+
+/**
+ * @brief Adds a trade to every resolution of a product.
+ *
+ * Trades are expected in time order; a trade older than the open candle is folded into it.
+ * @param product Product traded, e.g. "ETH/BTC".
+ * @param time Trade time in microseconds since epoch.
+ * @param price Trade price.
+ * @param amount Traded amount.
+ */
+void CandleBuilder::onTrade(const std::string & product, std::int64_t time, double price, double amount)
+{
+    if(time < 0) return;
+    std::vector<Series> & series = this->seriesFor(product);
+
+    for(std::size_t r = 0; r < resolutions.size(); r++)
+    {
+        Series & s = series[r];
+        std::int64_t start = time - (time % resolutions[r]);
+        if(s.open && (start > s.current.start))
+        {
+            s.history.push(s.current);
+            s.open = false;
+        }
+        if(!s.open)
+        {
+            s.current.start  = start;
+            s.current.open   = price;
+            s.current.high   = price;
+            s.current.low    = price;
+            s.current.volume = 0.0;
+            s.current.trades = 0;
+            s.open = true;
+        }
+        if(price > s.current.high) s.current.high = price;
+        if(price < s.current.low)  s.current.low  = price;
+        s.current.close   = price;
+        s.current.volume += amount;
+        s.current.trades++;
+    }
+}
+
+/**
+ * @brief Candle lengths in microseconds, in the order used for the resolution index.
+ */
+const std::vector<std::int64_t> & CandleBuilder::getResolutions() const
+{
+    return this->resolutions;
+}
+
+/**
+ * @brief Returns the candle still being built for a product and resolution.
+ * @return Pointer to the candle, or nullptr if the product has not traded.
+ */
+const Candle * CandleBuilder::getCurrent(const std::string & product, std::size_t resolution) const
+{
+    auto it = products.find(product);
+    if((it == products.end()) || (resolution >= resolutions.size()) || !it->second[resolution].open) return nullptr;
+    return &it->second[resolution].current;
+}
+
+/**
+ * @brief Returns the finished candles for a product and resolution.
+ * @return Pointer to the history ring, or nullptr if the product has not traded.
+ */
+const CandleRing * CandleBuilder::getHistory(const std::string & product, std::size_t resolution) const
+{
+    auto it = products.find(product);
+    if((it == products.end()) || (resolution >= resolutions.size())) return nullptr;
+    return &it->second[resolution].history;
+}
+
+/**
+ * @brief Finds (or creates) the per-resolution series of a product.
+ *
+ * Sales arrive grouped by product, so the previous lookup is remembered.
+ */
+std::vector<CandleBuilder::Series> & CandleBuilder::seriesFor(const std::string & product)
+{
+    if((nullptr != lastSeries) && (product == lastProduct)) return *lastSeries;
+
+    auto it = products.find(product);
+    if(it == products.end())
+    {
+        it = products.emplace(product, std::vector<Series>(resolutions.size(), Series{historyLen})).first;
+    }
+    lastProduct = product;
+    lastSeries  = &it->second;
+    return it->second;
+}
+
+/**
+ * @brief Converts a timestamp, reusing the previous result since a timeframe's sales share one timestamp.
+ */
+std::int64_t CandleBuilder::toMicros(const std::string & timestamp)
+{
+    if(timestamp != lastTimestamp)
+    {
+        lastTimestamp = timestamp;
+        lastMicros    = OrderBookEntry::timestampToMicros(timestamp);
+    }
+    return lastMicros;
+}
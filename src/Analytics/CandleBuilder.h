@@ -0,0 +1,117 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file CandleBuilder.h
+ * @author Edward Martinez
+ * @brief Header file for multi-resolution OHLCV candle aggregation.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define CANDLE_MICROS_1S  1000000LL
+#define CANDLE_MICROS_1M  (60LL * CANDLE_MICROS_1S)
+#define CANDLE_MICROS_5M  (5LL * CANDLE_MICROS_1M)
+#define CANDLE_MICROS_1H  (60LL * CANDLE_MICROS_1M)
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct Candle
+    @brief Open/high/low/close/volume of one product over one time bucket.
+*/
+struct Candle
+{
+    std::int64_t start = 0;   /**< Bucket start, microseconds since epoch. */
+    double open   = 0.0;
+    double high   = 0.0;
+    double low    = 0.0;
+    double close  = 0.0;
+    double volume = 0.0;      /**< Traded (or, for order-fed builders, ordered) amount of the base currency. */
+    std::uint32_t trades = 0;
+};
+
+/*! @class CandleRing
+    @brief Fixed-capacity ring buffer of finished candles; the oldest candle is overwritten when full.
+*/
+class CandleRing
+{
+    public:
+        CandleRing(std::size_t capacity);
+        void push(const Candle & candle);
+        std::size_t size() const;
+        const Candle & at(std::size_t i) const;
+        const Candle & newest() const;
+    private:
+        std::vector<Candle> slots;
+        std::size_t head;
+        std::size_t count;
+};
+
+/*! @class CandleBuilder
+    @brief Aggregates trades into candles at several resolutions per product.
+
+    Each trade updates the open candle of every configured resolution in O(1). When a trade
+    falls into a later bucket, the open candle is moved to that resolution's history ring.
+    Buckets without trades produce no candle. A builder fed with onOrder() instead of onSale()
+    produces candles of order prices rather than traded prices.
+*/
+class CandleBuilder
+{
+    public:
+        CandleBuilder();
+        CandleBuilder(const std::vector<std::int64_t> & resolutions, std::size_t historyLen);
+        CandleBuilder(const CandleBuilder &) = delete;
+        CandleBuilder & operator=(const CandleBuilder &) = delete;
+        void onSale(const OrderBookEntry & sale);
+        void onOrder(const OrderBookEntry & order);
+        void onTrade(const std::string & product, std::int64_t time, double price, double amount);
+        const std::vector<std::int64_t> & getResolutions() const;
+        const Candle * getCurrent(const std::string & product, std::size_t resolution) const;
+        const CandleRing * getHistory(const std::string & product, std::size_t resolution) const;
+    private:
+        /*! Open candle and history for one resolution. */
+        struct Series
+        {
+            Series(std::size_t historyLen) : history(historyLen) {}
+            Candle current;
+            bool open = false;
+            CandleRing history;
+        };
+        std::vector<Series> & seriesFor(const std::string & product);
+        std::int64_t toMicros(const std::string & timestamp);
+        std::vector<std::int64_t> resolutions;
+        std::size_t historyLen;
+        std::unordered_map<std::string, std::vector<Series>> products;
+        std::string lastProduct;
+        std::vector<Series> * lastSeries;
+        std::string lastTimestamp;
+        std::int64_t lastMicros;
+};
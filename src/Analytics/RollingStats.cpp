@@ -0,0 +1,206 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file RollingStats.cpp
+ * @author Edward Martinez
+ * @brief Source file for sliding-window VWAP, TWAP and volatility per product.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "RollingStats.h"
+#include "CandleBuilder.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor using 1m, 5m and 1h windows.
+ */
+RollingStats::RollingStats()
+: RollingStats({CANDLE_MICROS_1M, CANDLE_MICROS_5M, CANDLE_MICROS_1H})
+{
+}
+
+/**
+ * @brief Constructor.
+ * @param windows Window lengths in microseconds.
+ */
+RollingStats::RollingStats(const std::vector<std::int64_t> & windows)
+: windows(windows),
+  lastEntry(nullptr),
+  lastMicros(-1)
+{
+    for(std::int64_t w : windows)
+    {
+        if(w <= 0) throw std::runtime_error(std::string("RollingStats - Windows must be positive."));
+    }
+}
+
+/**
+ * @brief Adds a sale produced by OrderBook::matchAsksToBids().
+ */
+void RollingStats::onSale(const OrderBookEntry & sale)
+{
+    if(sale._timestamp != lastTimestamp)
+    {
+        lastTimestamp = sale._timestamp;
+        lastMicros    = OrderBookEntry::timestampToMicros(sale._timestamp);
+    }
+    this->onTrade(sale._product, lastMicros, sale._price, sale._amount);
+}
+
+/**
+ * @brief Adds a trade to every window of a product and evicts trades that fell out of them.
+ *
+ * Trades are expected in time order.
+ * @param product Product traded, e.g. "ETH/BTC".
+ * @param time Trade time in microseconds since epoch.
+ * @param price Trade price. Must be positive.
+ * @param amount Traded amount.
+ */
+void RollingStats::onTrade(const std::string & product, std::int64_t time, double price, double amount)
+{
+    if((time < 0) || (price <= 0.0)) return;
+    Product & p = this->productFor(product);
+
+    Sample s{time, price, amount, 0.0, false, 0};
+    std::uint64_t seq = p.frontSeq + p.samples.size();
+    if(!p.samples.empty())
+    {
+        Sample & prev = p.samples.back();
+        if(time < prev.time) time = s.time = prev.time;
+        prev.dt      = time - prev.time;
+        s.logReturn  = std::log(price / prev.price);
+        s.hasReturn  = true;
+    }
+    p.samples.push_back(s);
+
+    std::uint64_t oldest = seq;
+    for(std::size_t w = 0; w < windows.size(); w++)
+    {
+        Window & win = p.windows[w];
+        if(seq == 0) win.start = 0;
+
+        //The previous trade's price now has a known duration.
+        if((seq > 0) && (win.start <= seq - 1))
+        {
+            const Sample & prev = p.samples[seq - 1 - p.frontSeq];
+            win.twapSum  += prev.price * (double)prev.dt;
+            win.twapTime += (double)prev.dt;
+        }
+        win.pv += price * amount;
+        win.v  += amount;
+        win.nTrades++;
+        if(s.hasReturn)
+        {
+            win.r  += s.logReturn;
+            win.r2 += s.logReturn * s.logReturn;
+            win.nReturns++;
+        }
+
+        //Evict trades older than the window. The newest trade is always kept.
+        while(win.start < seq)
+        {
+            const Sample & old = p.samples[win.start - p.frontSeq];
+            if(old.time >= time - windows[w]) break;
+            win.pv       -= old.price * old.volume;
+            win.v        -= old.volume;
+            win.twapSum  -= old.price * (double)old.dt;
+            win.twapTime -= (double)old.dt;
+            win.nTrades--;
+            //Only returns between two trades of the window count, so the return into the
+            //new oldest trade leaves the window along with the evicted trade.
+            const Sample & next = p.samples[win.start + 1 - p.frontSeq];
+            win.r  -= next.logReturn;
+            win.r2 -= next.logReturn * next.logReturn;
+            win.nReturns--;
+            win.start++;
+        }
+        oldest = std::min(oldest, win.start);
+    }
+
+    //Drop trades no window needs any more.
+    while(p.frontSeq < oldest)
+    {
+        p.samples.pop_front();
+        p.frontSeq++;
+    }
+}
+
+/**
+ * @brief Reads the statistics of a product over one window.
+ * @param product Product to query.
+ * @param window Index into getWindows().
+ * @param out Receives the statistics.
+ * @return TRUE if the product has traded and the window index is valid.
+ */
+bool RollingStats::get(const std::string & product, std::size_t window, RollingSnapshot & out) const
+{
+    auto it = products.find(product);
+    if((it == products.end()) || (window >= windows.size()) || it->second.samples.empty()) return false;
+
+    const Window & win = it->second.windows[window];
+    double lastPrice = it->second.samples.back().price;
+
+    out.trades = win.nTrades;
+    out.volume = win.v;
+    out.vwap   = (win.v > 0.0) ? (win.pv / win.v) : lastPrice;
+    out.twap   = (win.twapTime > 0.0) ? (win.twapSum / win.twapTime) : lastPrice;
+    out.volatility = 0.0;
+    if(win.nReturns > 1)
+    {
+        double n = (double)win.nReturns;
+        double var = (win.r2 - (win.r * win.r) / n) / (n - 1.0);
+        out.volatility = (var > 0.0) ? std::sqrt(var) : 0.0;
+    }
+    return true;
+}
+
+/**
+ * @brief Window lengths in microseconds, in the order used for the window index.
+ */
+const std::vector<std::int64_t> & RollingStats::getWindows() const
+{
+    return this->windows;
+}
+
+/**
+ * @brief Finds (or creates) the state of a product, remembering the previous lookup.
+ */
+RollingStats::Product & RollingStats::productFor(const std::string & product)
+{
+    if((nullptr != lastEntry) && (product == lastProduct)) return *lastEntry;
+
+    auto it = products.find(product);
+    if(it == products.end())
+    {
+        it = products.emplace(product, Product{}).first;
+        it->second.windows.resize(windows.size());
+    }
+    lastProduct = product;
+    lastEntry   = &it->second;
+    return it->second;
+}
@@ -0,0 +1,106 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file RollingStats.h
+ * @author Edward Martinez
+ * @brief Header file for sliding-window VWAP, TWAP and volatility per product.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct RollingSnapshot
+    @brief Statistics of one product over one sliding window.
+*/
+struct RollingSnapshot
+{
+    double vwap       = 0.0; /**< Volume-weighted average price. */
+    double twap       = 0.0; /**< Time-weighted average price. */
+    double volatility = 0.0; /**< Sample standard deviation of trade-to-trade log returns. */
+    double volume     = 0.0; /**< Traded amount in the window. */
+    std::size_t trades = 0;
+};
+
+/*! @class RollingStats
+    @brief Keeps running sums over sliding time windows so VWAP, TWAP and volatility are O(1) to query.
+
+    Every product keeps one buffer of trades covering the longest window. Each window holds
+    running sums (price x volume, volume, time-weighted price, log returns and their squares)
+    and a cursor to its oldest trade; a new trade adds its terms and evicts expired trades by
+    subtracting theirs, so updates are amortized O(1). Windows end at the product's latest trade.
+*/
+class RollingStats
+{
+    public:
+        RollingStats();
+        RollingStats(const std::vector<std::int64_t> & windows);
+        RollingStats(const RollingStats &) = delete;
+        RollingStats & operator=(const RollingStats &) = delete;
+        void onSale(const OrderBookEntry & sale);
+        void onTrade(const std::string & product, std::int64_t time, double price, double amount);
+        bool get(const std::string & product, std::size_t window, RollingSnapshot & out) const;
+        const std::vector<std::int64_t> & getWindows() const;
+    private:
+        /*! One trade, plus the terms it contributes to the running sums. */
+        struct Sample
+        {
+            std::int64_t time;
+            double price;
+            double volume;
+            double logReturn;  /**< Log return from the previous trade; 0 for the first trade. */
+            bool hasReturn;
+            std::int64_t dt;   /**< Time until the next trade; 0 until it arrives. */
+        };
+        /*! Running sums for one window. */
+        struct Window
+        {
+            std::uint64_t start = 0; /**< Sequence number of the oldest trade in the window. */
+            double pv = 0.0, v = 0.0;
+            double twapSum = 0.0, twapTime = 0.0;
+            double r = 0.0, r2 = 0.0;
+            std::size_t nReturns = 0, nTrades = 0;
+        };
+        /*! Trade buffer and windows of one product. */
+        struct Product
+        {
+            std::deque<Sample> samples;
+            std::uint64_t frontSeq = 0;   /**< Sequence number of samples.front(). */
+            std::vector<Window> windows;
+        };
+        Product & productFor(const std::string & product);
+        std::vector<std::int64_t> windows;
+        std::unordered_map<std::string, Product> products;
+        std::string lastProduct;
+        Product * lastEntry;
+        std::string lastTimestamp;
+        std::int64_t lastMicros;
+};
@@ -0,0 +1,291 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Backtester.cpp
+ * @author Edward Martinez
+ * @brief Source file for the shared backtest data set and the headless strategy backtester.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Backtester.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /*! Attaches a strategy to a backtester for the duration of a run. */
+    struct StrategyBinding
+    {
+        Backtester *& engine;
+        StrategyBinding(Backtester *& engine, Backtester * owner) : engine(engine)
+        {
+            if(nullptr != engine) throw std::runtime_error(std::string("Backtester::run - Strategy is already being backtested."));
+            engine = owner;
+        }
+        ~StrategyBinding() { engine = nullptr; }
+    };
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Loads a data set from a csv file.
+ * @param filename Path to csv file containing order data set.
+ */
+BacktestData::BacktestData(const std::string & filename)
+{
+    OrderBook book{filename};
+    this->products = book.getKnownProducts();
+    this->frames   = book.snapshot();
+    this->build();
+}
+
+/**
+ * @brief Takes a snapshot of a loaded OrderBook; the book's frames are shared, not copied.
+ */
+BacktestData::BacktestData(OrderBook & book)
+: frames(book.snapshot()),
+  products(book.getKnownProducts())
+{
+    this->build();
+}
+
+/**
+ * @brief Finds the best prices of every product in every timeframe, and the price its
+ *        historical orders alone last trade at.
+ */
+void BacktestData::build()
+{
+    for(const std::string & p : products) pairs.push_back(SymbolTable::instance().product(p));
+    tops.resize(frames->size() * products.size());
+    for(std::size_t f = 0; f < frames->size(); f++)
+    {
+        const OrderBookFrame & frame = (*frames)[f];
+        BookTop * row = &tops[f * products.size()];
+        std::size_t last = 0;
+        for(const OrderBookEntry & e : frame.orders)
+        {
+            //Entries of a product tend to be adjacent, so try the previous product first.
+            if((last >= products.size()) || (products[last] != e._product))
+            {
+                last = std::lower_bound(products.begin(), products.end(), e._product) - products.begin();
+            }
+            if(last >= products.size()) continue;
+            BookTop & top = row[last];
+            if((OrderBookType::bid == e._OrderType) && (e._price > top.bid)) top.bid = e._price;
+            if((OrderBookType::ask == e._OrderType) && ((0.0 == top.ask) || (e._price < top.ask))) top.ask = e._price;
+        }
+        for(std::size_t p = 0; p < products.size(); p++)
+        {
+            if((row[p].bid < row[p].ask) || (0.0 == row[p].bid) || (0.0 == row[p].ask)) continue; //Book does not cross.
+            std::vector<OrderBookEntry> sales = OrderMatcher<DefaultMatchPolicy>::match(frame.orders, products[p], frame.timestamp);
+            if(!sales.empty()) row[p].last = sales.back()._price;
+        }
+    }
+}
+
+/**
+ * @brief Number of timeframes.
+ */
+std::size_t BacktestData::getFrameCount() const
+{
+    return frames->size();
+}
+
+/**
+ * @brief A timeframe's historical orders.
+ * @param frame Index of the timeframe, in time order.
+ */
+const OrderBookFrame & BacktestData::getFrame(std::size_t frame) const
+{
+    return (*frames)[frame];
+}
+
+/**
+ * @brief Best prices of a timeframe, one BookTop per product.
+ * @param frame Index of the timeframe, in time order.
+ */
+const BookTop * BacktestData::getTops(std::size_t frame) const
+{
+    return &tops[frame * products.size()];
+}
+
+/**
+ * @brief Products of the data set, in sorted order.
+ */
+const std::vector<std::string> & BacktestData::getProducts() const
+{
+    return this->products;
+}
+
+/**
+ * @brief Currency pairs of getProducts(), in the same order.
+ */
+const std::vector<ProductPair> & BacktestData::getPairs() const
+{
+    return this->pairs;
+}
+
+/**
+ * @brief Constructor.
+ * @param data Data set to replay; must outlive the backtester.
+ * @param strategy Strategy to run; must outlive the backtester.
+ * @param options Starting wallet and length.
+ */
+Backtester::Backtester(const BacktestData & data, Strategy & strategy, const BacktestOptions & options)
+: data(data),
+  strategy(strategy),
+  options(options),
+  traded(data.getProducts().size(), 0),
+  last(data.getProducts().size(), 0.0)
+{
+    wallet.insertCurrency(options.currency, options.funds);
+}
+
+/**
+ * @brief Replays the data set from its first timeframe until its end or options.maxTicks.
+ * @return Totals, final balances and the final wallet value.
+ */
+BacktestResult Backtester::run()
+{
+    StrategyBinding binding{strategy.engine, this};
+    BacktestResult result;
+    std::size_t n = data.getFrameCount();
+    if((0 != options.maxTicks) && (options.maxTicks < n)) n = options.maxTicks;
+    placed   = 0;
+    rejected = 0;
+    for(std::size_t f = 0; f < n; f++) this->tick(f, result);
+    result.ticks    = n;
+    result.orders   = placed;
+    result.rejected = rejected;
+    result.balances = wallet.getBalances();
+    result.equity   = this->value();
+    return result;
+}
+
+/**
+ * @brief Runs the strategy on one timeframe and matches the products it traded.
+ */
+void Backtester::tick(std::size_t frame, BacktestResult & result)
+{
+    current = &data.getFrame(frame);
+    const BookTop * tops = data.getTops(frame);
+    const std::vector<std::string> & products = data.getProducts();
+    overlay.clear();
+    std::fill(traded.begin(), traded.end(), 0);
+
+    strategy.onTick(BookView{*current, products, tops}, current->timestamp);
+
+    for(std::size_t p = 0; p < products.size(); p++)
+    {
+        if(tops[p].last > 0.0) last[p] = tops[p].last;
+        else if((0.0 == last[p]) && (tops[p].bid > 0.0) && (tops[p].ask > 0.0)) last[p] = (tops[p].bid + tops[p].ask) / 2.0;
+        if(!traded[p]) continue;
+
+        std::vector<OrderBookEntry> sales = OrderMatcher<DefaultMatchPolicy>::match(current->orders, overlay, products[p], current->timestamp);
+        for(const OrderBookEntry & sale : sales)
+        {
+            if(MATCH_USER_NAME != sale.username) continue;
+            wallet.processSale(sale);
+            result.fills++;
+            result.volume += sale._amount;
+            strategy.onFill(sale);
+        }
+    }
+    wallet.releaseAll(); //Unfilled strategy orders expire with their timeframe.
+    current = nullptr;
+}
+
+/**
+ * @brief Adds a strategy order to the current timeframe's overlay, holding its funds.
+ * @return Id of the order, or ORDER_ID_NONE if it is invalid or the wallet cannot fund it.
+ */
+OrderId Backtester::place(std::size_t product, OrderBookType type, double price, double amount)
+{
+    if(nullptr == current) throw std::runtime_error(std::string("Backtester::place - Orders can only be placed from onTick()."));
+    if((product >= traded.size()) || (price <= 0.0) || (amount <= 0.0))
+    {
+        rejected++;
+        return ORDER_ID_NONE;
+    }
+    OrderBookEntry order{current->timestamp, data.getProducts()[product], type, price, amount};
+    order.username = MATCH_USER_NAME;
+    order.orderId  = wallet.reserve(order);
+    if(ORDER_ID_NONE == order.orderId)
+    {
+        rejected++;
+        return ORDER_ID_NONE;
+    }
+    overlay.push_back(std::move(order));
+    traded[product] = 1;
+    placed++;
+    return overlay.back().orderId;
+}
+
+/**
+ * @brief The backtest's wallet.
+ */
+const Wallet & Backtester::getWallet() const
+{
+    return this->wallet;
+}
+
+/**
+ * @brief Values the wallet in options.currency at the last known price of each product.
+ *
+ * A currency counts if a product trades it directly against options.currency; other
+ * currencies are left out.
+ */
+double Backtester::value() const
+{
+    CurrencyId funding = SymbolTable::instance().currency(options.currency);
+    const std::vector<ProductPair> & pairs = data.getPairs();
+    double total = 0.0;
+    for(const std::pair<const std::string, double> & b : wallet.getBalances())
+    {
+        CurrencyId c = SymbolTable::instance().currency(b.first);
+        if(funding == c)
+        {
+            total += b.second;
+            continue;
+        }
+        for(std::size_t p = 0; p < pairs.size(); p++)
+        {
+            if(last[p] <= 0.0) continue;
+            if((pairs[p].base == c) && (pairs[p].quote == funding))
+            {
+                total += b.second * last[p];
+                break;
+            }
+            if((pairs[p].base == funding) && (pairs[p].quote == c))
+            {
+                total += b.second / last[p];
+                break;
+            }
+        }
+    }
+    return total;
+}
@@ -0,0 +1,127 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Backtester.h
+ * @author Edward Martinez
+ * @brief Header file for the shared backtest data set and the headless strategy backtester.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Strategy.h"
+#include "../OrderBookLib/SymbolTable.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class BacktestData
+    @brief A data set prepared once for any number of backtests, and never modified afterwards.
+
+    Holds a snapshot of the OrderBook's frames together with the best prices and last
+    historical sale of every product in every timeframe. Every Backtester and SweepRunner
+    reads it in place and concurrently, so it is not copyable.
+*/
+class BacktestData
+{
+    public:
+        explicit BacktestData(const std::string & filename);
+        explicit BacktestData(OrderBook & book);
+        BacktestData(const BacktestData &) = delete;
+        BacktestData & operator=(const BacktestData &) = delete;
+        std::size_t getFrameCount() const;
+        const OrderBookFrame & getFrame(std::size_t frame) const;
+        const BookTop * getTops(std::size_t frame) const;
+        const std::vector<std::string> & getProducts() const;
+        const std::vector<ProductPair> & getPairs() const;
+    private:
+        void build();
+        OrderBookSnapshot frames;
+        std::vector<std::string> products;
+        std::vector<ProductPair> pairs;
+        std::vector<BookTop> tops;  /**< getFrameCount() rows of one entry per product. */
+};
+
+/*! @struct BacktestOptions
+    @brief Starting wallet and length of a backtest.
+*/
+struct BacktestOptions
+{
+    std::string currency = "BTC";   /**< Funded currency; results are valued in it. */
+    double funds         = 10.0;    /**< Opening balance, as MerkelMain gives the user. */
+    std::size_t maxTicks = 0;       /**< Timeframes to replay; 0 replays the whole data set once. */
+};
+
+/*! @struct BacktestResult
+    @brief Totals of a backtest.
+*/
+struct BacktestResult
+{
+    std::size_t ticks    = 0;
+    std::size_t orders   = 0;   /**< Orders placed and funded. */
+    std::size_t rejected = 0;   /**< Orders the wallet could not fund. */
+    std::size_t fills    = 0;
+    double volume        = 0.0; /**< Base currency amount filled. */
+    double equity        = 0.0; /**< Final wallet value in BacktestOptions::currency at the last prices. */
+    std::map<std::string, double> balances;
+};
+
+/*! @class Backtester
+    @brief Replays a data set's timeframes headlessly through a Strategy.
+
+    Each timeframe, the strategy sees a BookView of the historical orders and may place
+    orders. Those orders form a private overlay on the timeframe: products the strategy
+    traded are matched from the shared historical orders plus the overlay under
+    DefaultMatchPolicy, exactly as if MerkelMain::submitOrder() had added them to the book,
+    and the strategy's fills settle in a private Wallet. Products it did not trade cannot
+    change its wallet and are not matched at all. Unfilled orders expire with the timeframe.
+
+    The data set is only read, so backtests of one BacktestData may run on any number of
+    threads at once.
+*/
+class Backtester
+{
+    public:
+        Backtester(const BacktestData & data, Strategy & strategy, const BacktestOptions & options = BacktestOptions());
+        Backtester(const Backtester &) = delete;
+        Backtester & operator=(const Backtester &) = delete;
+        BacktestResult run();
+        const Wallet & getWallet() const;
+    private:
+        friend class Strategy;
+        OrderId place(std::size_t product, OrderBookType type, double price, double amount);
+        void tick(std::size_t frame, BacktestResult & result);
+        double value() const;
+        const BacktestData & data;
+        Strategy & strategy;
+        BacktestOptions options;
+        Wallet wallet;
+        const OrderBookFrame * current = nullptr;   /**< Timeframe being replayed. */
+        std::vector<OrderBookEntry> overlay;        /**< Strategy orders of the current timeframe. */
+        std::vector<unsigned char> traded;          /**< Per product: non-zero if the overlay has orders for it. */
+        std::vector<double> last;                   /**< Last known price per product, for valuation. */
+        std::size_t placed   = 0;
+        std::size_t rejected = 0;
+};
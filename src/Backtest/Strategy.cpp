@@ -0,0 +1,167 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Strategy.cpp
+ * @author Edward Martinez
+ * @brief Source file for the backtesting strategy interface, its book view and a sample strategy.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Strategy.h"
+#include "Backtester.h"
+/** @cond STDINCLUDES */
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param frame Historical timeframe.
+ * @param products Products of the data set.
+ * @param tops Best prices of the timeframe, one per product.
+ */
+BookView::BookView(const OrderBookFrame & frame, const std::vector<std::string> & products, const BookTop * tops)
+: frame(frame),
+  products(products),
+  tops(tops)
+{
+}
+
+/**
+ * @brief Timestamp of the timeframe.
+ */
+const std::string & BookView::getTimestamp() const
+{
+    return frame.timestamp;
+}
+
+/**
+ * @brief Products of the data set, in sorted order; strategies refer to them by index.
+ */
+const std::vector<std::string> & BookView::getProducts() const
+{
+    return this->products;
+}
+
+/**
+ * @brief Best historical prices of a product in the timeframe.
+ * @param product Index into getProducts().
+ */
+const BookTop & BookView::getTop(std::size_t product) const
+{
+    return tops[product];
+}
+
+/**
+ * @brief Every historical ask and bid of the timeframe, for strategies that need the full depth.
+ */
+const std::vector<OrderBookEntry> & BookView::getOrders() const
+{
+    return frame.orders;
+}
+
+/**
+ * @brief Called after each fill of the strategy's orders. Does nothing by default.
+ */
+void Strategy::onFill(const OrderBookEntry &)
+{
+}
+
+/**
+ * @brief Places a bid in the current timeframe.
+ * @param product Index into BookView::getProducts().
+ * @return Id of the order, or ORDER_ID_NONE if the wallet cannot fund it.
+ */
+OrderId Strategy::bid(std::size_t product, double price, double amount)
+{
+    if(nullptr == engine) throw std::runtime_error(std::string("Strategy::bid - Strategy is not being backtested."));
+    return engine->place(product, OrderBookType::bid, price, amount);
+}
+
+/**
+ * @brief Places an ask in the current timeframe.
+ * @param product Index into BookView::getProducts().
+ * @return Id of the order, or ORDER_ID_NONE if the wallet cannot fund it.
+ */
+OrderId Strategy::ask(std::size_t product, double price, double amount)
+{
+    if(nullptr == engine) throw std::runtime_error(std::string("Strategy::ask - Strategy is not being backtested."));
+    return engine->place(product, OrderBookType::ask, price, amount);
+}
+
+/**
+ * @brief The backtest's wallet, including funds held by open orders.
+ */
+const Wallet & Strategy::getWallet() const
+{
+    if(nullptr == engine) throw std::runtime_error(std::string("Strategy::getWallet - Strategy is not being backtested."));
+    return engine->getWallet();
+}
+
+/**
+ * @brief Constructor.
+ * @param edge Relative distance of the best price from the average that triggers a trade.
+ * @param alpha Weight of the newest mid price in the average, in (0, 1].
+ * @param size Amount of each order.
+ */
+MeanReversionStrategy::MeanReversionStrategy(double edge, double alpha, double size)
+: edge(edge),
+  alpha(alpha),
+  size(size)
+{
+}
+
+/**
+ * @brief Trades every product whose best ask or bid has moved more than edge away from its average.
+ */
+void MeanReversionStrategy::onTick(const BookView & book, const std::string &)
+{
+    if(average.empty()) average.assign(book.getProducts().size(), 0.0);
+    for(std::size_t p = 0; p < average.size(); p++)
+    {
+        const BookTop & top = book.getTop(p);
+        if((top.bid <= 0.0) || (top.ask <= 0.0)) continue;
+        double mid = (top.bid + top.ask) / 2.0;
+        if(average[p] <= 0.0) average[p] = mid;
+
+        if(top.ask < average[p] * (1.0 - edge))      this->bid(p, top.ask, size);
+        else if(top.bid > average[p] * (1.0 + edge)) this->ask(p, top.bid, size);
+        average[p] += alpha * (mid - average[p]);
+    }
+}
+
+/**
+ * @brief Counts fills.
+ */
+void MeanReversionStrategy::onFill(const OrderBookEntry &)
+{
+    fills++;
+}
+
+/**
+ * @brief Number of fills so far.
+ */
+std::size_t MeanReversionStrategy::getFillCount() const
+{
+    return this->fills;
+}
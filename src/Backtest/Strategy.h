@@ -0,0 +1,112 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Strategy.h
+ * @author Edward Martinez
+ * @brief Header file for the backtesting strategy interface, its book view and a sample strategy.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "../OrderBookLib/OrderBook.h"
+#include "../Wallet/Wallet.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+class Backtester;
+
+/*! @struct BookTop
+    @brief Best prices of one product in one historical timeframe. Zero where a side is empty.
+*/
+struct BookTop
+{
+    double bid  = 0.0;  /**< Highest bid. */
+    double ask  = 0.0;  /**< Lowest ask. */
+    double last = 0.0;  /**< Price of the timeframe's last historical sale, or 0 without sales. */
+};
+
+/*! @class BookView
+    @brief Read-only view of one historical timeframe, as a strategy sees it in onTick().
+
+    The view refers to the shared data set directly; nothing is copied to build it.
+*/
+class BookView
+{
+    public:
+        BookView(const OrderBookFrame & frame, const std::vector<std::string> & products, const BookTop * tops);
+        const std::string & getTimestamp() const;
+        const std::vector<std::string> & getProducts() const;
+        const BookTop & getTop(std::size_t product) const;
+        const std::vector<OrderBookEntry> & getOrders() const;
+    private:
+        const OrderBookFrame & frame;
+        const std::vector<std::string> & products;
+        const BookTop * tops;   /**< One per product. */
+};
+
+/*! @class Strategy
+    @brief A trading strategy run by a Backtester over historical timeframes.
+
+    onTick() is called once per timeframe before it is matched; orders placed with bid() and
+    ask() join that timeframe's historical orders, are funded from the backtest's own wallet,
+    and expire with the timeframe like user orders of MerkelMain. onFill() reports each fill
+    after the wallet has been updated. A strategy is used by one Backtester, on one thread.
+*/
+class Strategy
+{
+    public:
+        virtual ~Strategy() = default;
+        virtual void onTick(const BookView & book, const std::string & timestamp) = 0;
+        virtual void onFill(const OrderBookEntry & trade);
+    protected:
+        OrderId bid(std::size_t product, double price, double amount);
+        OrderId ask(std::size_t product, double price, double amount);
+        const Wallet & getWallet() const;
+    private:
+        friend class Backtester;
+        Backtester * engine = nullptr;  /**< Set while a Backtester runs the strategy. */
+};
+
+/*! @class MeanReversionStrategy
+    @brief Buys at the ask when it falls below a moving average of the mid price and sells at
+    the bid when it rises above it.
+
+    The average is exponential: avg += alpha * (mid - avg) every timeframe with a two-sided book.
+*/
+class MeanReversionStrategy : public Strategy
+{
+    public:
+        MeanReversionStrategy(double edge, double alpha, double size);
+        void onTick(const BookView & book, const std::string & timestamp) override;
+        void onFill(const OrderBookEntry & trade) override;
+        std::size_t getFillCount() const;
+    private:
+        double edge;    /**< Relative distance from the average that triggers a trade. */
+        double alpha;   /**< Weight of the newest mid in the average. */
+        double size;    /**< Amount of each order. */
+        std::vector<double> average;
+        std::size_t fills = 0;
+};
@@ -0,0 +1,212 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SweepRunner.cpp
+ * @author Edward Martinez
+ * @brief Source file for parallel backtests of many strategy parameter combinations.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "SweepRunner.h"
+#include "../CsvReader/CsvReader.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <numeric>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Reads a comma separated list of numbers.
+     * @return FALSE if the list is empty.
+     */
+    bool parseList(const char * text, std::vector<double> & out)
+    {
+        out.clear();
+        for(const std::string & token : CsvReader::tokenise(text, ',')) out.push_back(std::strtod(token.c_str(), nullptr));
+        return !out.empty();
+    }
+
+    double perSecond(std::size_t count, double seconds)
+    {
+        return (seconds > 0.0) ? (double)count / seconds : 0.0;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param data Data set every backtest replays; must outlive the runner.
+ * @param threads Pool threads; 0 uses every hardware thread.
+ */
+SweepRunner::SweepRunner(const BacktestData & data, unsigned threads)
+: data(data),
+  pool(threads)
+{
+}
+
+/**
+ * @brief Number of threads backtests run on, the calling thread included.
+ */
+unsigned SweepRunner::getThreadCount() const
+{
+    return pool.getThreadCount();
+}
+
+/**
+ * @brief Backtests every combination, each with a fresh strategy from factory and a fresh wallet.
+ * @param combinations Number of combinations, numbered from 0.
+ * @param factory Creates the strategy of a combination.
+ * @param options Starting wallet and length, the same for every combination.
+ * @return Result of each combination, in combination order.
+ */
+std::vector<BacktestResult> SweepRunner::run(std::size_t combinations, const StrategyFactory & factory,
+                                             const BacktestOptions & options)
+{
+    std::vector<BacktestResult> results(combinations);
+    pool.run(combinations, [&](std::size_t combination, unsigned)
+    {
+        std::unique_ptr<Strategy> strategy = factory(combination);
+        Backtester backtest{data, *strategy, options};
+        results[combination] = backtest.run();
+    });
+    return results;
+}
+
+/**
+ * @brief Number of combinations in the grid.
+ */
+std::size_t SweepRunner::gridSize(const SweepOptions & options)
+{
+    return options.edges.size() * options.alphas.size() * options.sizes.size();
+}
+
+/**
+ * @brief Parameters of one combination of the grid. Sizes vary fastest, then alphas, then edges.
+ */
+void SweepRunner::gridPoint(const SweepOptions & options, std::size_t combination, double & edge, double & alpha, double & size)
+{
+    size  = options.sizes[combination % options.sizes.size()];
+    combination /= options.sizes.size();
+    alpha = options.alphas[combination % options.alphas.size()];
+    edge  = options.edges[combination / options.alphas.size()];
+}
+
+/**
+ * @brief A factory creating the MeanReversionStrategy of each combination of the grid.
+ */
+StrategyFactory SweepRunner::meanReversionGrid(const SweepOptions & options)
+{
+    return [options](std::size_t combination)
+    {
+        double edge, alpha, size;
+        SweepRunner::gridPoint(options, combination, edge, alpha, size);
+        return std::unique_ptr<Strategy>(new MeanReversionStrategy(edge, alpha, size));
+    };
+}
+
+/**
+ * @brief Reads command line options.
+ * @return FALSE on an unknown option, an empty list or a missing data set.
+ */
+bool SweepRunner::parseArgs(int argc, char ** argv, SweepOptions & options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--edges" == arg))          { if(!parseList(argv[++i], options.edges)) return false; }
+        else if(hasValue && ("--alphas" == arg))    { if(!parseList(argv[++i], options.alphas)) return false; }
+        else if(hasValue && ("--sizes" == arg))     { if(!parseList(argv[++i], options.sizes)) return false; }
+        else if(hasValue && ("--threads" == arg))   options.threads           = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        else if(hasValue && ("--top" == arg))       options.top               = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--max-ticks" == arg)) options.backtest.maxTicks = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--currency" == arg))  options.backtest.currency = argv[++i];
+        else if(hasValue && ("--funds" == arg))     options.backtest.funds    = std::strtod(argv[++i], nullptr);
+        else if((arg.size() > 1) && ('-' == arg[0])) return false;
+        else options.dataset = arg;
+    }
+    return !options.dataset.empty();
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void SweepRunner::printUsage(std::ostream & os, const char * program)
+{
+    SweepOptions d;
+    os << "Usage: " << program << " [options] <dataset.csv>\n"
+       << "   --edges A,B,...     Distances from the average that trigger a trade (default " << d.edges.size() << " values)\n"
+       << "   --alphas A,B,...    Weights of the newest mid in the average (default " << d.alphas.size() << " values)\n"
+       << "   --sizes A,B,...     Order amounts (default " << d.sizes.size() << " values)\n"
+       << "   --threads N         Pool threads (default: all hardware threads)\n"
+       << "   --top N             Best combinations to print (default " << d.top << ")\n"
+       << "   --max-ticks N       Replay only the first N timeframes (default: the whole data set)\n"
+       << "   --currency C        Funded currency results are valued in (default " << d.backtest.currency << ")\n"
+       << "   --funds F           Opening balance (default " << d.backtest.funds << ")\n";
+}
+
+/**
+ * @brief Prints sweep totals and the best combinations by final wallet value.
+ */
+void SweepRunner::printResults(std::ostream & os, const SweepOptions & options,
+                               const std::vector<BacktestResult> & results, double seconds, unsigned threads)
+{
+    std::size_t ticks = 0, fills = 0;
+    for(const BacktestResult & r : results)
+    {
+        ticks += r.ticks;
+        fills += r.fills;
+    }
+    std::vector<std::size_t> order(results.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&results](std::size_t a, std::size_t b){ return results[a].equity > results[b].equity; });
+
+    os << std::fixed << std::setprecision(3)
+       << "Backtest sweep summary\n"
+       << "   Combinations : " << results.size() << '\n'
+       << "   Threads      : " << threads << '\n'
+       << "   Ticks        : " << ticks << '\n'
+       << "   Fills        : " << fills << '\n'
+       << "   Wall time    : " << seconds << " s\n"
+       << std::setprecision(0)
+       << "   Ticks/s      : " << perSecond(ticks, seconds) << '\n'
+       << std::setprecision(1)
+       << "   Combos/s     : " << perSecond(results.size(), seconds) << '\n'
+       << "Best combinations (value in " << options.backtest.currency << ")\n"
+       << "          edge     alpha      size    orders     fills         value\n";
+    for(std::size_t i = 0; (i < order.size()) && (i < options.top); i++)
+    {
+        const BacktestResult & r = results[order[i]];
+        double edge, alpha, size;
+        SweepRunner::gridPoint(options, order[i], edge, alpha, size);
+        os << std::setprecision(4)
+           << std::setw(14) << edge << std::setw(10) << alpha << std::setw(10) << size
+           << std::setw(10) << r.orders << std::setw(10) << r.fills
+           << std::setprecision(6) << std::setw(14) << r.equity << '\n';
+    }
+}
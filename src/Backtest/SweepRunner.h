@@ -0,0 +1,86 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SweepRunner.h
+ * @author Edward Martinez
+ * @brief Header file for parallel backtests of many strategy parameter combinations.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Backtester.h"
+#include "../Agents/WorkStealingPool.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** Creates the strategy for one parameter combination of a sweep. Called concurrently. */
+typedef std::function<std::unique_ptr<Strategy>(std::size_t combination)> StrategyFactory;
+
+/*! @struct SweepOptions
+    @brief A parameter grid of MeanReversionStrategy and how to run it.
+
+    Every combination of one edge, one alpha and one size is backtested.
+*/
+struct SweepOptions
+{
+    std::string dataset;
+    std::vector<double> edges  = {0.0005, 0.001, 0.002, 0.003, 0.005, 0.01};
+    std::vector<double> alphas = {0.01, 0.02, 0.05, 0.1, 0.2, 0.5};
+    std::vector<double> sizes  = {0.01, 0.1, 1.0};
+    unsigned threads = 0;       /**< Pool threads; 0 uses every hardware thread. Results do not depend on it. */
+    std::size_t top  = 10;      /**< Best combinations printed. */
+    BacktestOptions backtest;
+};
+
+/*! @class SweepRunner
+    @brief Backtests many strategies over one BacktestData in parallel.
+
+    Each combination is an independent Backtester with its own strategy, wallet and order
+    overlay, run as one task of a WorkStealingPool. All of them read the same BacktestData,
+    so the historical data is loaded and held once however many combinations and threads
+    are used, and a sweep scales with the number of cores.
+*/
+class SweepRunner
+{
+    public:
+        SweepRunner(const BacktestData & data, unsigned threads = 0);
+        unsigned getThreadCount() const;
+        std::vector<BacktestResult> run(std::size_t combinations, const StrategyFactory & factory,
+                                        const BacktestOptions & options = BacktestOptions());
+        static std::size_t gridSize(const SweepOptions & options);
+        static void gridPoint(const SweepOptions & options, std::size_t combination, double & edge, double & alpha, double & size);
+        static StrategyFactory meanReversionGrid(const SweepOptions & options);
+        static bool parseArgs(int argc, char ** argv, SweepOptions & options);
+        static void printUsage(std::ostream & os, const char * program);
+        static void printResults(std::ostream & os, const SweepOptions & options,
+                                 const std::vector<BacktestResult> & results, double seconds, unsigned threads);
+    private:
+        const BacktestData & data;
+        WorkStealingPool pool;
+};
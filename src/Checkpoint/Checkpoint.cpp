@@ -0,0 +1,448 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Checkpoint.cpp
+ * @author Edward Martinez
+ * @brief Source file for full-state simulation checkpoints.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * File layout (little endian):
+ *   magic "MRXCKPT2"
+ *   current time
+ *   timestamp table, product table, username table  (u32 count, then u16-length strings)
+ *   wallet balances                                 (u32 count, then string + double)
+ *   orders                                          (u64 count, then fixed-size records)
+ *   journal length                                  (u64, optional)
+ *
+ * Version 1 files ("MRXCKPT1") have shorter order records without the owning account and
+ * order id; they are still read, with both fields left unset.
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Checkpoint.h"
+/** @cond STDINCLUDES */
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define CHECKPOINT_MAGIC        "MRXCKPT2"
+#define CHECKPOINT_MAGIC_V1     "MRXCKPT1"
+#define CHECKPOINT_MAGIC_LEN    8
+#define CHECKPOINT_ORDER_BYTES  37       /**< u32 time, u16 product, u16 user, u8 type, 2 doubles, u32 account, u64 order id */
+#define CHECKPOINT_ORDER_BYTES_V1 25     /**< Version 1 records end after the doubles. */
+#define CHECKPOINT_WRITE_CHUNK  (1 << 20)
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Interns strings into a table, remembering the last hit since orders arrive grouped.
+     */
+    class StringTable
+    {
+        public:
+            std::uint32_t index(const std::string & s)
+            {
+                if(!strings.empty() && (s == strings[last])) return last;
+                auto it = ids.find(s);
+                if(it == ids.end())
+                {
+                    it = ids.emplace(s,(std::uint32_t)strings.size()).first;
+                    strings.push_back(s);
+                }
+                last = it->second;
+                return last;
+            }
+            std::vector<std::string> strings;
+        private:
+            std::unordered_map<std::string, std::uint32_t> ids;
+            std::uint32_t last = 0;
+    };
+
+    /**
+     * @brief Buffered writer for the checkpoint file.
+     */
+    class FileWriter
+    {
+        public:
+            explicit FileWriter(const std::string & path)
+            : path(path)
+            {
+                fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if(fd < 0)
+                {
+                    throw std::runtime_error(std::string("Checkpoint::write - Failed to open ") + path + ": " + std::strerror(errno));
+                }
+                buffer.reserve(CHECKPOINT_WRITE_CHUNK * 2);
+            }
+            ~FileWriter()
+            {
+                if(fd >= 0) ::close(fd);
+            }
+            void put(const void * data, std::size_t len)
+            {
+                const char * p = static_cast<const char *>(data);
+                buffer.insert(buffer.end(), p, p + len);
+                if(buffer.size() >= CHECKPOINT_WRITE_CHUNK) flush();
+            }
+            template <typename T> void putValue(T v)
+            {
+                put(&v,sizeof(v));
+            }
+            void putString(const std::string & s)
+            {
+                if(s.size() > UINT16_MAX)
+                {
+                    throw std::runtime_error(std::string("Checkpoint::write - String too long for checkpoint."));
+                }
+                putValue<std::uint16_t>((std::uint16_t)s.size());
+                put(s.data(),s.size());
+            }
+            void putTable(const std::vector<std::string> & table)
+            {
+                putValue<std::uint32_t>((std::uint32_t)table.size());
+                for(const std::string & s : table) putString(s);
+            }
+            void flush()
+            {
+                const char * p = buffer.data();
+                std::size_t remaining = buffer.size();
+                while(remaining > 0)
+                {
+                    ssize_t n = ::write(fd,p,remaining);
+                    if(n < 0)
+                    {
+                        if(EINTR == errno) continue;
+                        throw std::runtime_error(std::string("Checkpoint::write - write failed: ") + std::strerror(errno));
+                    }
+                    p += n;
+                    remaining -= (std::size_t)n;
+                }
+                buffer.clear();
+            }
+            void finish()
+            {
+                flush();
+                if((0 != ::fsync(fd)) || (0 != ::close(fd)))
+                {
+                    fd = -1;
+                    throw std::runtime_error(std::string("Checkpoint::write - Failed to sync ") + path);
+                }
+                fd = -1;
+            }
+        private:
+            std::string path;
+            std::vector<char> buffer;
+            int fd;
+    };
+
+    /**
+     * @brief Bounds-checked reader over a checkpoint file loaded into memory.
+     */
+    class BufferReader
+    {
+        public:
+            BufferReader(const char * begin, const char * end)
+            : pos(begin), end(end)
+            {
+            }
+            const char * take(std::size_t len)
+            {
+                if((std::size_t)(end - pos) < len)
+                {
+                    throw std::runtime_error(std::string("Checkpoint::read - Truncated checkpoint file."));
+                }
+                const char * p = pos;
+                pos += len;
+                return p;
+            }
+            std::size_t remaining() const
+            {
+                return (std::size_t)(end - pos);
+            }
+            template <typename T> T getValue()
+            {
+                T v;
+                std::memcpy(&v,take(sizeof(v)),sizeof(v));
+                return v;
+            }
+            std::string getString()
+            {
+                std::uint16_t len = getValue<std::uint16_t>();
+                return std::string(take(len),len);
+            }
+            std::vector<std::string> getTable()
+            {
+                std::uint32_t n = getValue<std::uint32_t>();
+                //Every string takes at least its length prefix, so a larger count cannot be genuine.
+                if(n > remaining() / sizeof(std::uint16_t))
+                {
+                    throw std::runtime_error(std::string("Checkpoint::read - Truncated checkpoint file."));
+                }
+                std::vector<std::string> table;
+                table.reserve(n);
+                for(std::uint32_t i = 0; i < n; i++) table.push_back(getString());
+                return table;
+            }
+        private:
+            const char * pos;
+            const char * end;
+    };
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Writes a checkpoint file.
+ *
+ * The file is written under a temporary name and renamed into place once it is complete, so an
+ * interrupted write never replaces a good checkpoint.
+ * @param path Destination of the checkpoint.
+ * @param state State to be saved.
+ */
+void Checkpoint::write(const std::string & path, const CheckpointState & state)
+{
+    static const OrderBookFrames noFrames;
+    const OrderBookFrames & frames = state.orders ? *state.orders : noFrames;
+
+    //Build symbol tables first so order records can refer to them by index.
+    StringTable timestamps, products, users;
+    std::uint64_t nOrders = 0;
+    for(const OrderBookFrame & frame : frames)
+    {
+        timestamps.index(frame.timestamp);
+        for(const OrderBookEntry & e : frame.orders)
+        {
+            products.index(e._product);
+            users.index(e.username);
+        }
+        nOrders += frame.orders.size();
+    }
+    if((products.strings.size() > UINT16_MAX) || (users.strings.size() > UINT16_MAX))
+    {
+        throw std::runtime_error(std::string("Checkpoint::write - Too many products or users for checkpoint format."));
+    }
+
+    std::string tmpPath = path + ".tmp";
+    FileWriter out{tmpPath};
+    out.put(CHECKPOINT_MAGIC,CHECKPOINT_MAGIC_LEN);
+    out.putString(state.currentTime);
+    out.putTable(timestamps.strings);
+    out.putTable(products.strings);
+    out.putTable(users.strings);
+
+    out.putValue<std::uint32_t>((std::uint32_t)state.balances.size());
+    for(const auto & b : state.balances)
+    {
+        out.putString(b.first);
+        out.putValue<double>(b.second);
+    }
+
+    out.putValue<std::uint64_t>(nOrders);
+    char rec[CHECKPOINT_ORDER_BYTES];
+    for(const OrderBookFrame & frame : frames)
+    {
+        std::uint32_t t = timestamps.index(frame.timestamp);
+        for(const OrderBookEntry & e : frame.orders)
+        {
+            std::uint16_t p = (std::uint16_t)products.index(e._product);
+            std::uint16_t u = (std::uint16_t)users.index(e.username);
+            std::uint8_t type = static_cast<std::uint8_t>(e._OrderType);
+            std::memcpy(rec,      &t,         4);
+            std::memcpy(rec + 4,  &p,         2);
+            std::memcpy(rec + 6,  &u,         2);
+            std::memcpy(rec + 8,  &type,      1);
+            std::memcpy(rec + 9,  &e._price,  8);
+            std::memcpy(rec + 17, &e._amount, 8);
+            std::memcpy(rec + 25, &e.account, 4);
+            std::memcpy(rec + 29, &e.orderId, 8);
+            out.put(rec,CHECKPOINT_ORDER_BYTES);
+        }
+    }
+    out.putValue<std::uint64_t>(state.journalBytes);
+    out.finish();
+
+    if(0 != std::rename(tmpPath.c_str(),path.c_str()))
+    {
+        throw std::runtime_error(std::string("Checkpoint::write - Failed to move checkpoint into place: ") + path);
+    }
+}
+
+/**
+ * @brief Reads a checkpoint file written by Checkpoint::write().
+ *
+ * The whole file is read with a single pass of read() calls and decoded from memory.
+ * @param path Checkpoint to be read.
+ * @param orders Receives the saved orderbook entries, so they can be moved straight into an OrderBook.
+ * @return The rest of the saved state (the orders member is left empty).
+ *         Throws std::runtime_error if the file is missing or malformed.
+ */
+CheckpointState Checkpoint::read(const std::string & path, std::vector<OrderBookEntry> & orders)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        throw std::runtime_error(std::string("Checkpoint::read - Failed to open ") + path);
+    }
+    struct stat st;
+    if(0 != ::fstat(fd,&st))
+    {
+        ::close(fd);
+        throw std::runtime_error(std::string("Checkpoint::read - Failed to stat ") + path);
+    }
+    std::vector<char> data((std::size_t)st.st_size);
+    std::size_t got = 0;
+    while(got < data.size())
+    {
+        ssize_t n = ::read(fd, data.data() + got, data.size() - got);
+        if(n < 0 && EINTR == errno) continue;
+        if(n <= 0) break;
+        got += (std::size_t)n;
+    }
+    ::close(fd);
+
+    BufferReader in{data.data(), data.data() + got};
+    const char * magic = in.take(CHECKPOINT_MAGIC_LEN);
+    std::size_t recordBytes = CHECKPOINT_ORDER_BYTES;
+    if(0 == std::memcmp(magic,CHECKPOINT_MAGIC_V1,CHECKPOINT_MAGIC_LEN)) recordBytes = CHECKPOINT_ORDER_BYTES_V1;
+    else if(0 != std::memcmp(magic,CHECKPOINT_MAGIC,CHECKPOINT_MAGIC_LEN))
+    {
+        throw std::runtime_error(std::string("Checkpoint::read - Not a checkpoint file: ") + path);
+    }
+
+    CheckpointState state;
+    state.currentTime = in.getString();
+    std::vector<std::string> timestamps = in.getTable();
+    std::vector<std::string> products   = in.getTable();
+    std::vector<std::string> users      = in.getTable();
+
+    std::uint32_t nBalances = in.getValue<std::uint32_t>();
+    for(std::uint32_t i = 0; i < nBalances; i++)
+    {
+        std::string currency = in.getString();
+        state.balances[currency] = in.getValue<double>();
+    }
+
+    std::uint64_t nOrders = in.getValue<std::uint64_t>();
+    if(nOrders > in.remaining() / recordBytes)
+    {
+        //Checked before multiplying, so a corrupt count can neither overflow nor force a huge allocation.
+        throw std::runtime_error(std::string("Checkpoint::read - Truncated checkpoint file."));
+    }
+    const char * rec = in.take(nOrders * recordBytes);
+    orders.clear();
+    orders.reserve(nOrders);
+    for(std::uint64_t i = 0; i < nOrders; i++, rec += recordBytes)
+    {
+        std::uint32_t t;
+        std::uint16_t p, u;
+        std::uint8_t type;
+        double price, amount;
+        std::memcpy(&t,      rec,      4);
+        std::memcpy(&p,      rec + 4,  2);
+        std::memcpy(&u,      rec + 6,  2);
+        std::memcpy(&type,   rec + 8,  1);
+        std::memcpy(&price,  rec + 9,  8);
+        std::memcpy(&amount, rec + 17, 8);
+        if((t >= timestamps.size()) || (p >= products.size()) || (u >= users.size()))
+        {
+            throw std::runtime_error(std::string("Checkpoint::read - Corrupt order record in ") + path);
+        }
+        orders.emplace_back(timestamps[t], products[p], static_cast<OrderBookType>(type), price, amount);
+        orders.back().username = users[u];
+        if(CHECKPOINT_ORDER_BYTES == recordBytes)
+        {
+            std::memcpy(&orders.back().account, rec + 25, 4);
+            std::memcpy(&orders.back().orderId, rec + 29, 8);
+        }
+    }
+    //Written after the orders so files without it still read.
+    if(in.remaining() >= sizeof(std::uint64_t)) state.journalBytes = in.getValue<std::uint64_t>();
+    return state;
+}
+
+/**
+ * @brief Waits for any checkpoint still being written.
+ */
+CheckpointWriter::~CheckpointWriter()
+{
+    this->wait();
+}
+
+/**
+ * @brief Starts writing a checkpoint on a background thread.
+ *
+ * A checkpoint that is still being written is completed first.
+ * @param path Destination of the checkpoint.
+ * @param state Snapshot of the state to be saved.
+ */
+void CheckpointWriter::start(const std::string & path, CheckpointState state)
+{
+    this->wait();
+    this->ok = true;
+    this->error.clear();
+    this->worker = std::thread([this, path, state = std::move(state)]()
+    {
+        try
+        {
+            Checkpoint::write(path,state);
+        }
+        catch(const std::exception & e)
+        {
+            this->error = e.what();
+            this->ok = false;
+        }
+    });
+}
+
+/**
+ * @brief Blocks until the checkpoint started last has been written.
+ */
+void CheckpointWriter::wait()
+{
+    if(this->worker.joinable()) this->worker.join();
+}
+
+/**
+ * @brief Result of the checkpoint started last. Only meaningful after wait().
+ */
+bool CheckpointWriter::lastWriteOk() const
+{
+    return this->ok;
+}
+
+/**
+ * @brief Why the checkpoint started last failed, or an empty string. Only meaningful after wait().
+ */
+const std::string & CheckpointWriter::lastError() const
+{
+    return this->error;
+}
@@ -0,0 +1,93 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Checkpoint.h
+ * @author Edward Martinez
+ * @brief Header file for full-state simulation checkpoints.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+#include "OrderBook.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define CHECKPOINT_NO_JOURNAL UINT64_MAX   /**< CheckpointState::journalBytes of a state saved without a journal. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct CheckpointState
+    @brief Everything needed to resume a simulation at a given time.
+*/
+struct CheckpointState
+{
+    std::string currentTime;
+    OrderBookSnapshot orders;
+    std::map<std::string, double> balances;
+    std::uint64_t journalBytes = CHECKPOINT_NO_JOURNAL; /**< Journal length (Journal::size()) when the state was captured. */
+};
+
+/*! @class Checkpoint
+    @brief Reads and writes compact binary checkpoints.
+
+    Repeated strings (timestamps, products, usernames) are written once to symbol tables and
+    orders refer to them by index, so each order costs a fixed 37 bytes on disk, including
+    its owning ledger account and order id.
+*/
+class Checkpoint
+{
+    public:
+        static void write(const std::string & path, const CheckpointState & state);
+        static CheckpointState read(const std::string & path, std::vector<OrderBookEntry> & orders);
+};
+
+/*! @class CheckpointWriter
+    @brief Writes checkpoints on a background thread.
+
+    The state handed to start() is a snapshot that the engine no longer modifies (the orderbook
+    part is shared copy-on-write storage), so the engine keeps running while it is serialised.
+*/
+class CheckpointWriter
+{
+    public:
+        CheckpointWriter() = default;
+        ~CheckpointWriter();
+        CheckpointWriter(const CheckpointWriter &) = delete;
+        CheckpointWriter & operator=(const CheckpointWriter &) = delete;
+        void start(const std::string & path, CheckpointState state);
+        void wait();
+        bool lastWriteOk() const;
+        const std::string & lastError() const;
+    private:
+        std::thread worker;
+        std::atomic<bool> ok{true};
+        std::string error;      /**< Why the checkpoint started last failed; written by the worker before it exits. */
+};
@@ -27,6 +27,7 @@
  *  Includes
  ***********************************************/
 #include "CsvReader.h"
+#include "../Log/Logger.h"
 /** @cond */
 #include <iostream>
 #include <fstream>
@@ -36,6 +37,7 @@
  *  Defines
  ***********************************************/
 #define ORDERBOOK_ENT_NTOKENS 5
+#define ORDERBOOK_ENT_NTOKENS_ACCOUNT 6 /**< Rows may carry the owning account id as a sixth field. */
 
 /********************************************//**
  *  Class Implementations
@@ -53,7 +55,7 @@ CsvReader::CsvReader()
  * 
  * Uses an input file stream to read a CSV file. Each line is tokenised into
  * orderbook entry objects. If the line does not contain the required amount of tokens
- * as specified by ORDERBOOK_ENT_NTOKENS, the line is skipped.
+ * as specified by ORDERBOOK_ENT_NTOKENS (or ORDERBOOK_ENT_NTOKENS_ACCOUNT), the line is skipped.
  * 
  * @see OrderBookEntry class for the expected data and its format.
  * @param csvFilename path to CSV file to be used as input.
@@ -78,7 +80,7 @@ std::vector<OrderBookEntry> CsvReader::readCSV(std::string csvFilename)
         while(std::getline(csvFile,line))
         {
             tokens = tokenise(line,',');
-            if(ORDERBOOK_ENT_NTOKENS != tokens.size())
+            if((ORDERBOOK_ENT_NTOKENS != tokens.size()) && (ORDERBOOK_ENT_NTOKENS_ACCOUNT != tokens.size()))
 
             {
                 nErr++;
@@ -92,7 +94,7 @@ std::vector<OrderBookEntry> CsvReader::readCSV(std::string csvFilename)
             }
             catch(const std::exception& e)
             {
-                std::cerr << e.what() << '\n';
+                MRX_LOG_WARN("CsvReader::readCSV - Skipping line: {}", e.what());
             }
         }       
         // std::cout << std::endl << std::endl << "Summary of lines processed: " << std::endl;
@@ -100,7 +102,7 @@ std::vector<OrderBookEntry> CsvReader::readCSV(std::string csvFilename)
         // std::cout << "   Invalid line count: " << nErr << std::endl;
         csvFile.close(); 
     }
-    else std::cout << "CsvReader::readCSV - Error opening file " << csvDataFileName << std::endl;
+    else MRX_LOG_ERROR("CsvReader::readCSV - Error opening file {}", csvDataFileName);
 
     return entries;
 }
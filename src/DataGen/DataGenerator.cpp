@@ -0,0 +1,329 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file DataGenerator.cpp
+ * @author Edward Martinez
+ * @brief Source file for the synthetic order data set generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "DataGenerator.h"
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define DATAGEN_CHUNK_FRAMES 256    /**< Timeframes per independently generated chunk. */
+#define DATAGEN_MIN_AMOUNT   0.01
+#define DATAGEN_MAX_AMOUNT   10.0
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief SplitMix64 step, used to derive independent stream seeds from the user seed.
+     */
+    std::uint64_t splitmix64(std::uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Appends "YYYY/MM/DD HH:MM:SS.ffffff" for a time in microseconds since epoch.
+     */
+    void appendTimestamp(std::int64_t micros, std::string & out)
+    {
+        std::int64_t secs = micros / 1000000;
+        std::int64_t frac = micros % 1000000;
+        std::int64_t days = secs / 86400;
+        std::int64_t sod  = secs % 86400;
+
+        //Civil date from days since epoch (proleptic Gregorian calendar).
+        std::int64_t z   = days + 719468;
+        std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        std::int64_t doe = z - era * 146097;
+        std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        std::int64_t mp  = (5 * doy + 2) / 153;
+        std::int64_t d   = doy - (153 * mp + 2) / 5 + 1;
+        std::int64_t m   = mp + (mp < 10 ? 3 : -9);
+        std::int64_t y   = yoe + era * 400 + (m <= 2);
+
+        char buf[32];
+        int n = std::snprintf(buf, sizeof(buf), "%04d/%02d/%02d %02d:%02d:%02d.%06d",
+                              (int)y, (int)m, (int)d, (int)(sod / 3600), (int)((sod / 60) % 60),
+                              (int)(sod % 60), (int)frac);
+        out.append(buf, (std::size_t)n);
+    }
+
+    /**
+     * @brief Appends a non-negative value with 8 decimals, without going through printf.
+     */
+    void appendFixed8(double value, std::string & out)
+    {
+        std::uint64_t v = (std::uint64_t)std::llround(value * 1e8);
+        std::uint64_t whole = v / 100000000ULL;
+        std::uint64_t frac  = v % 100000000ULL;
+
+        char buf[32];
+        char * p = buf + sizeof(buf);
+        for(int i = 0; i < 8; i++)
+        {
+            *--p = (char)('0' + frac % 10);
+            frac /= 10;
+        }
+        *--p = '.';
+        do
+        {
+            *--p = (char)('0' + whole % 10);
+            whole /= 10;
+        } while(whole > 0);
+        out.append(p, (std::size_t)(buf + sizeof(buf) - p));
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor. Validates the options and draws the mid price at every chunk boundary.
+ */
+DataGenerator::DataGenerator(const DataGenOptions & options)
+: options(options),
+  names(productNames(options.products)),
+  startMicros(OrderBookEntry::timestampToMicros(options.start)),
+  nChunks((options.frames + DATAGEN_CHUNK_FRAMES - 1) / DATAGEN_CHUNK_FRAMES)
+{
+    if((0 == options.products) || (0 == options.ordersPerFrame))
+    {
+        throw std::runtime_error(std::string("DataGenerator - Products and orders per frame must be positive."));
+    }
+    if(startMicros < 0)
+    {
+        throw std::runtime_error(std::string("DataGenerator - Invalid start time: ") + options.start);
+    }
+    if((options.startPrice <= 0.0) || (options.volatility < 0.0) || (options.depth < 0.0) ||
+       (options.overlap < 0.0) || (options.overlap > 1.0) || (options.intervalMs <= 0))
+    {
+        throw std::runtime_error(std::string("DataGenerator - Price, volatility, depth, overlap or interval out of range."));
+    }
+
+    std::mt19937_64 walk(splitmix64(options.seed));
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::size_t P = options.products;
+    boundaryLogMid.resize((nChunks + 1) * P);
+    for(std::size_t p = 0; p < P; p++) boundaryLogMid[p] = std::log(options.startPrice * (double)(p + 1));
+    for(std::size_t k = 0; k < nChunks; k++)
+    {
+        std::size_t steps = std::min<std::size_t>(DATAGEN_CHUNK_FRAMES, options.frames - k * DATAGEN_CHUNK_FRAMES);
+        double sd = options.volatility * std::sqrt((double)steps);
+        for(std::size_t p = 0; p < P; p++)
+        {
+            boundaryLogMid[(k + 1) * P + p] = boundaryLogMid[k * P + p] + sd * normal(walk);
+        }
+    }
+}
+
+/**
+ * @brief Product names: ETH/BTC, DOGE/BTC and BTC/USDT as in the sample data sets, then TK3/BTC, TK4/BTC, ...
+ */
+std::vector<std::string> DataGenerator::productNames(std::size_t n)
+{
+    static const char * known[] = {"ETH/BTC", "DOGE/BTC", "BTC/USDT"};
+    std::vector<std::string> out;
+    for(std::size_t i = 0; i < n; i++)
+    {
+        out.push_back((i < 3) ? std::string(known[i]) : "TK" + std::to_string(i) + "/BTC");
+    }
+    return out;
+}
+
+/**
+ * @brief Renders every timeframe to a stream, in time order.
+ *
+ * Workers render up to one chunk each per round; the rendered chunks are then written in order.
+ * @return Number of rows written.
+ */
+std::size_t DataGenerator::write(std::ostream & os) const
+{
+    unsigned nThreads = options.threads;
+    if(0 == nThreads) nThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::string> buffers(nThreads);
+    for(std::size_t first = 0; first < nChunks; first += nThreads)
+    {
+        std::size_t n = std::min<std::size_t>(nThreads, nChunks - first);
+        std::vector<std::thread> workers;
+        for(std::size_t i = 1; i < n; i++)
+        {
+            workers.emplace_back(&DataGenerator::renderChunk, this, first + i, std::ref(buffers[i]));
+        }
+        this->renderChunk(first, buffers[0]);
+        for(std::thread & t : workers) t.join();
+        for(std::size_t i = 0; i < n; i++) os.write(buffers[i].data(), (std::streamsize)buffers[i].size());
+    }
+    os.flush();
+    if(!os) throw std::runtime_error(std::string("DataGenerator::write - Failed writing output."));
+    return options.frames * options.ordersPerFrame;
+}
+
+/**
+ * @brief Renders every timeframe to a file. @see write(std::ostream &)
+ */
+std::size_t DataGenerator::write(const std::string & path) const
+{
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    if(!out) throw std::runtime_error(std::string("DataGenerator::write - Cannot open ") + path);
+    return this->write(out);
+}
+
+/**
+ * @brief Renders the rows of one chunk of timeframes.
+ *
+ * Each order picks a side, then a distance from the mid price (half-normal, scaled by depth).
+ * Asks sit above the mid and bids below, except for the overlap fraction that is placed on the
+ * other side so it can match.
+ */
+void DataGenerator::renderChunk(std::size_t chunk, std::string & out) const
+{
+    out.clear();
+    std::mt19937_64 rng(splitmix64(options.seed ^ splitmix64(chunk + 1)));
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::size_t P = options.products;
+    std::size_t firstFrame = chunk * DATAGEN_CHUNK_FRAMES;
+    std::size_t steps = std::min<std::size_t>(DATAGEN_CHUNK_FRAMES, options.frames - firstFrame);
+    std::vector<double> logMid(boundaryLogMid.begin() + chunk * P, boundaryLogMid.begin() + (chunk + 1) * P);
+    std::vector<double> remaining(P);
+    for(std::size_t p = 0; p < P; p++) remaining[p] = boundaryLogMid[(chunk + 1) * P + p] - logMid[p];
+
+    out.reserve(steps * options.ordersPerFrame * 64);
+    std::string ts;
+    for(std::size_t f = 0; f < steps; f++)
+    {
+        ts.clear();
+        appendTimestamp(startMicros + (std::int64_t)(firstFrame + f) * options.intervalMs * 1000, ts);
+
+        for(std::size_t j = 0; j < options.ordersPerFrame; j++)
+        {
+            std::size_t p = j % P;
+            bool ask      = (rng() & 1) != 0;
+            double dist   = std::fabs(normal(rng)) * options.depth;
+            bool cross    = unit(rng) < options.overlap;
+            double sign   = (ask != cross) ? 1.0 : -1.0;
+            double price  = std::exp(logMid[p] + sign * dist);
+            double amount = DATAGEN_MIN_AMOUNT + unit(rng) * (DATAGEN_MAX_AMOUNT - DATAGEN_MIN_AMOUNT);
+
+            out += ts;
+            out += ',';
+            out += names[p];
+            out += ask ? ",ask," : ",bid,";
+            appendFixed8(price, out);
+            out += ',';
+            appendFixed8(amount, out);
+            if(options.accounts > 0)
+            {
+                out += ',';
+                out += std::to_string(rng() % options.accounts);
+            }
+            out += '\n';
+        }
+
+        //Brownian bridge step towards the next chunk boundary.
+        std::size_t left = steps - f;
+        for(std::size_t p = 0; p < P; p++)
+        {
+            double step = remaining[p];
+            if(left > 1)
+            {
+                double sd = options.volatility * std::sqrt((double)(left - 1) / (double)left);
+                step = remaining[p] / (double)left + sd * normal(rng);
+            }
+            logMid[p]    += step;
+            remaining[p] -= step;
+        }
+    }
+}
+
+/**
+ * @brief Parses command line arguments.
+ * @param path Receives the output file.
+ * @return TRUE if the arguments are valid and an output file was given.
+ */
+bool DataGenerator::parseArgs(int argc, char ** argv, DataGenOptions & options, std::string & path)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--products" == arg))              options.products       = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--orders-per-frame" == arg)) options.ordersPerFrame = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--frames" == arg))           options.frames         = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--seed" == arg))             options.seed           = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--price" == arg))            options.startPrice     = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--volatility" == arg))       options.volatility     = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--depth" == arg))            options.depth          = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--overlap" == arg))          options.overlap        = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--start" == arg))            options.start          = argv[++i];
+        else if(hasValue && ("--interval-ms" == arg))      options.intervalMs     = std::strtoll(argv[++i], nullptr, 10);
+        else if(hasValue && ("--threads" == arg))          options.threads        = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        else if(hasValue && ("--accounts" == arg))         options.accounts       = std::strtoull(argv[++i], nullptr, 10);
+        else if((arg.size() > 1) && ('-' == arg[0]))       return false;
+        else if(path.empty())                              path = arg;
+        else return false;
+    }
+    if(options.accounts > (std::size_t)ACCOUNT_ID_MAX + 1) return false;
+    return !path.empty();
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void DataGenerator::printUsage(std::ostream & os, const char * program)
+{
+    DataGenOptions d;
+    os << "Usage: " << program << " [options] <output.csv>\n"
+       << "   --products N          Number of products (default " << d.products << ")\n"
+       << "   --orders-per-frame N  Orders per timeframe (default " << d.ordersPerFrame << ")\n"
+       << "   --frames N            Number of timeframes (default " << d.frames << ")\n"
+       << "   --seed N              Random seed (default " << d.seed << ")\n"
+       << "   --price P             Starting mid price (default " << d.startPrice << ")\n"
+       << "   --volatility S        Per-timeframe log-return std. dev. of the mid (default " << d.volatility << ")\n"
+       << "   --depth D             Typical relative order distance from the mid (default " << d.depth << ")\n"
+       << "   --overlap F           Fraction of orders crossing the mid (default " << d.overlap << ")\n"
+       << "   --start \"YYYY/MM/DD HH:MM:SS\"  First timestamp (default " << d.start << ")\n"
+       << "   --interval-ms N       Time between timeframes (default " << d.intervalMs << ")\n"
+       << "   --threads N           Worker threads, 0 for all cores (default 0)\n"
+       << "   --accounts N          Append an owning account id below N to each row (default none, at most " << (std::size_t)ACCOUNT_ID_MAX + 1 << ")\n";
+}
@@ -0,0 +1,83 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file DataGenerator.h
+ * @author Edward Martinez
+ * @brief Header file for the synthetic order data set generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct DataGenOptions
+    @brief Shape of a generated data set.
+*/
+struct DataGenOptions
+{
+    std::size_t products       = 3;     /**< Number of products (ETH/BTC, DOGE/BTC, BTC/USDT, then TK3/BTC, ...). */
+    std::size_t ordersPerFrame = 100;   /**< Orders sharing each timestamp, spread over the products. */
+    std::size_t frames         = 1000;  /**< Number of timeframes. */
+    std::uint64_t seed         = 1;
+    double startPrice          = 0.02;  /**< Initial mid price of the first product; product i starts at (i + 1) times this. */
+    double volatility          = 0.001; /**< Standard deviation of the per-timeframe log return of each mid price. */
+    double depth               = 0.005; /**< Typical relative distance of an order from the mid price. */
+    double overlap             = 0.2;   /**< Fraction of orders placed on the far side of the mid, where they can match. */
+    std::string start          = "2020/03/17 17:01:24";
+    std::int64_t intervalMs    = 1000;  /**< Time between timeframes. */
+    unsigned threads           = 0;     /**< Worker threads; 0 uses every hardware thread. */
+    std::size_t accounts       = 0;     /**< If non-zero, each row gets a sixth field: an owning account id below this value. */
+};
+
+/*! @class DataGenerator
+    @brief Writes CsvReader-compatible "timestamp,product,type,price,amount[,account]" rows.
+
+    Timeframes are generated in fixed-size chunks, each from its own random stream derived from
+    the seed, so chunks can be rendered in parallel and the output is byte-identical whatever
+    the thread count. Mid prices follow a geometric random walk: its value at every chunk
+    boundary is drawn up front, and the steps inside a chunk are drawn as a Brownian bridge
+    between the two boundaries, which keeps the walk continuous without serialising the chunks.
+*/
+class DataGenerator
+{
+    public:
+        DataGenerator(const DataGenOptions & options);
+        std::size_t write(std::ostream & os) const;
+        std::size_t write(const std::string & path) const;
+        static std::vector<std::string> productNames(std::size_t n);
+        static bool parseArgs(int argc, char ** argv, DataGenOptions & options, std::string & path);
+        static void printUsage(std::ostream & os, const char * program);
+    private:
+        void renderChunk(std::size_t chunk, std::string & out) const;
+        DataGenOptions options;
+        std::vector<std::string> names;
+        std::vector<double> boundaryLogMid; /**< Log mid price per chunk boundary and product. */
+        std::int64_t startMicros;
+        std::size_t nChunks;
+};
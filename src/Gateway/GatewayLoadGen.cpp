@@ -0,0 +1,307 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file GatewayLoadGen.cpp
+ * @author Edward Martinez
+ * @brief Source file for the order-entry gateway load generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "GatewayLoadGen.h"
+#include "GatewayProtocol.h"
+#include "OrderGateway.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LOADGEN_READ_BYTES (64u << 10)
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    std::uint64_t nowNanos()
+    {
+        return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    /*! One client connection of a load run. */
+    struct LoadClient
+    {
+        int fd = -1;
+        std::size_t quota = 0;      /**< Orders this connection sends in total. */
+        std::size_t sent  = 0;
+        std::size_t acked = 0;
+        std::vector<char> in;
+        std::size_t inUsed = 0;
+        std::vector<char> out;
+        std::size_t outSent = 0;
+        bool writing = false;
+    };
+
+    /*! Sockets of a load run, closed however the run ends. */
+    struct LoadSockets
+    {
+        int epollFd = -1;
+        std::vector<LoadClient> clients;
+        ~LoadSockets()
+        {
+            for(LoadClient & c : clients) if(c.fd >= 0) ::close(c.fd);
+            if(epollFd >= 0) ::close(epollFd);
+        }
+    };
+
+    /**
+     * @brief Sends pending output; returns FALSE if the gateway closed the connection.
+     */
+    bool sendPending(LoadClient & c)
+    {
+        while(c.outSent < c.out.size())
+        {
+            ssize_t n = ::send(c.fd, c.out.data() + c.outSent, c.out.size() - c.outSent, MSG_NOSIGNAL);
+            if(n < 0)
+            {
+                if((EAGAIN == errno) || (EWOULDBLOCK == errno)) return true;
+                if(EINTR == errno) continue;
+                return false;
+            }
+            c.outSent += (std::size_t)n;
+        }
+        c.out.clear();
+        c.outSent = 0;
+        return true;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ */
+GatewayLoadGen::GatewayLoadGen(const LoadGenOptions & options)
+: options(options)
+{
+    this->options.connections = std::max<std::size_t>(this->options.connections, 1);
+    this->options.window      = std::max<std::size_t>(this->options.window, 1);
+}
+
+/**
+ * @brief Connects every client, sends every order and waits for every ack.
+ * @return Counts, elapsed time and ack latencies. Fills seen before the last ack are counted.
+ */
+LoadGenResult GatewayLoadGen::run()
+{
+    if(options.product.size() > GW_PRODUCT_BYTES)
+    {
+        throw std::runtime_error(std::string("GatewayLoadGen::run - Product name too long: ") + options.product);
+    }
+    LoadGenResult result;
+    LoadSockets sockets;
+    sockets.epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    if(sockets.epollFd < 0) throw std::runtime_error(std::string("GatewayLoadGen::run - Cannot create the event loop."));
+    int epollFd = sockets.epollFd;
+    std::vector<LoadClient> & clients = sockets.clients;
+    clients.resize(options.connections);
+    for(std::size_t i = 0; i < clients.size(); i++)
+    {
+        LoadClient & c = clients[i];
+        c.fd = OrderGateway::connect(options.endpoint);
+        ::fcntl(c.fd, F_SETFL, ::fcntl(c.fd, F_GETFL) | O_NONBLOCK);
+        c.quota = options.messages / clients.size() + ((i < options.messages % clients.size()) ? 1 : 0);
+        c.in.resize(LOADGEN_READ_BYTES);
+        epoll_event ev{};
+        ev.events   = EPOLLIN;
+        ev.data.u64 = i;
+        ::epoll_ctl(epollFd, EPOLL_CTL_ADD, c.fd, &ev);
+    }
+
+    GatewayNewOrder req;
+    std::memset(&req, 0, sizeof(req));
+    req.header.length = sizeof(req);
+    req.header.type   = GatewayMsgType::newOrder;
+    req.side          = GatewaySide::bid;
+    req.amount        = options.amount;
+    std::memcpy(req.product, options.product.data(), options.product.size());
+
+    //Tops a connection's window up and sends the new orders in one write.
+    std::size_t counter = 0;
+    auto topUp = [&](LoadClient & c)
+    {
+        std::uint64_t now = nowNanos();
+        while((c.sent < c.quota) && (c.sent - c.acked < options.window))
+        {
+            req.clientTag = now;
+            req.price     = options.price * (1.0 + (double)((int)(counter++ % 21) - 10) * 1e-4);
+            const char * bytes = reinterpret_cast<const char *>(&req);
+            c.out.insert(c.out.end(), bytes, bytes + sizeof(req));
+            c.sent++;
+            result.sent++;
+        }
+        return sendPending(c);
+    };
+
+    Clock::time_point start = Clock::now();
+    std::size_t open = clients.size();
+    for(LoadClient & c : clients)
+    {
+        if(!topUp(c)) throw std::runtime_error(std::string("GatewayLoadGen::run - Gateway closed a connection."));
+        if(c.quota == 0) open--;
+    }
+
+    std::vector<epoll_event> events(std::min<std::size_t>(clients.size(), 1024));
+    while(open > 0)
+    {
+        int n = ::epoll_wait(epollFd, events.data(), (int)events.size(), 1000);
+        if(n < 0 && EINTR != errno) break;
+        for(int e = 0; e < n; e++)
+        {
+            LoadClient & c = clients[events[e].data.u64];
+            bool done = (c.acked == c.quota);
+            if(events[e].events & EPOLLOUT)
+            {
+                if(!sendPending(c)) throw std::runtime_error(std::string("GatewayLoadGen::run - Gateway closed a connection."));
+            }
+            if(events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                ssize_t got = ::read(c.fd, c.in.data() + c.inUsed, c.in.size() - c.inUsed);
+                if(0 == got || ((got < 0) && (EAGAIN != errno) && (EINTR != errno)))
+                {
+                    throw std::runtime_error(std::string("GatewayLoadGen::run - Gateway closed a connection."));
+                }
+                if(got > 0)
+                {
+                    c.inUsed += (std::size_t)got;
+                    std::uint64_t now = nowNanos();
+                    std::size_t pos = 0;
+                    while(c.inUsed - pos >= sizeof(GatewayHeader))
+                    {
+                        GatewayHeader header;
+                        std::memcpy(&header, c.in.data() + pos, sizeof(header));
+                        if((0 == header.length) || (c.inUsed - pos < header.length)) break;
+                        if(GatewayMsgType::ack == header.type)
+                        {
+                            GatewayAck ack;
+                            std::memcpy(&ack, c.in.data() + pos, sizeof(ack));
+                            if(GatewayStatus::accepted == ack.status) result.accepted++;
+                            else                                      result.rejected++;
+                            result.latency.record(now - ack.clientTag);
+                            c.acked++;
+                        }
+                        else if(GatewayMsgType::fill == header.type)
+                        {
+                            result.fills++;
+                        }
+                        pos += header.length;
+                    }
+                    c.inUsed -= pos;
+                    if(c.inUsed > 0) std::memmove(c.in.data(), c.in.data() + pos, c.inUsed);
+                    if(!topUp(c)) throw std::runtime_error(std::string("GatewayLoadGen::run - Gateway closed a connection."));
+                }
+            }
+            bool writing = (c.outSent < c.out.size());
+            if(writing != c.writing)
+            {
+                c.writing = writing;
+                epoll_event ev{};
+                ev.events   = EPOLLIN | (writing ? EPOLLOUT : 0u);
+                ev.data.u64 = events[e].data.u64;
+                ::epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+            }
+            if(!done && (c.acked == c.quota)) open--;
+        }
+    }
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return result;
+}
+
+/**
+ * @brief Prints a load run summary.
+ */
+void GatewayLoadGen::printResult(std::ostream & os, const LoadGenResult & result)
+{
+    std::size_t acked = result.accepted + result.rejected;
+    double rate = (result.seconds > 0.0) ? (double)acked / result.seconds : 0.0;
+    os << std::fixed << std::setprecision(3)
+       << "Load summary\n"
+       << "   Sent         : " << result.sent << '\n'
+       << "   Accepted     : " << result.accepted << '\n'
+       << "   Rejected     : " << result.rejected << '\n'
+       << "   Fills        : " << result.fills << '\n'
+       << "   Time         : " << result.seconds << " s\n"
+       << std::setprecision(0)
+       << "   Acks/s       : " << rate << '\n'
+       << "   Ack latency  : p50 " << result.latency.percentile(50.0) / 1000.0 << " us, p99 "
+       << result.latency.percentile(99.0) / 1000.0 << " us, max " << result.latency.max() / 1000.0 << " us\n";
+}
+
+/**
+ * @brief Reads command line options.
+ * @return FALSE on an unknown option.
+ */
+bool GatewayLoadGen::parseArgs(int argc, char ** argv, LoadGenOptions & options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--connect" == arg))          options.endpoint    = argv[++i];
+        else if(hasValue && ("--connections" == arg)) options.connections = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--messages" == arg))    options.messages    = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--window" == arg))      options.window      = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--product" == arg))     options.product     = argv[++i];
+        else if(hasValue && ("--price" == arg))       options.price       = std::strtod(argv[++i], nullptr);
+        else if(hasValue && ("--amount" == arg))      options.amount      = std::strtod(argv[++i], nullptr);
+        else return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void GatewayLoadGen::printUsage(std::ostream & os, const char * program)
+{
+    LoadGenOptions d;
+    os << "Usage: " << program << " [options]\n"
+       << "   --connect ENDPOINT  unix:<path> or tcp:<port> (default " << d.endpoint << ")\n"
+       << "   --connections N     Client connections (default " << d.connections << ")\n"
+       << "   --messages N        Orders sent in total (default " << d.messages << ")\n"
+       << "   --window N          Unacked orders per connection (default " << d.window << ")\n"
+       << "   --product P         Product bid for (default " << d.product << ")\n"
+       << "   --price P           Bid price (default " << d.price << ")\n"
+       << "   --amount A          Bid amount (default " << d.amount << ")\n";
+}
@@ -0,0 +1,82 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file GatewayLoadGen.h
+ * @author Edward Martinez
+ * @brief Header file for the order-entry gateway load generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "LatencyHistogram.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct LoadGenOptions
+    @brief Shape of the load put on a gateway.
+*/
+struct LoadGenOptions
+{
+    std::string endpoint    = "unix:/tmp/merklerex.sock";
+    std::size_t connections = 100;
+    std::size_t messages    = 1000000;  /**< New orders sent in total, spread evenly over the connections. */
+    std::size_t window      = 64;       /**< Orders a connection may have sent but not seen acked. */
+    std::string product     = "ETH/BTC";
+    double price            = 0.02;     /**< Bids are spread within 0.1% of this price. */
+    double amount           = 0.0001;   /**< Small enough that the default wallet funds a million bids. */
+};
+
+/*! @struct LoadGenResult
+    @brief What a load run saw.
+*/
+struct LoadGenResult
+{
+    std::size_t sent     = 0;
+    std::size_t accepted = 0;
+    std::size_t rejected = 0;
+    std::size_t fills    = 0;
+    double seconds       = 0.0;
+    LatencyHistogram latency;           /**< Nanoseconds from sending an order to reading its ack. */
+};
+
+/*! @class GatewayLoadGen
+    @brief Drives an OrderGateway from many client connections on one thread.
+
+    Every connection keeps up to window new orders in flight and tops the window up as acks
+    arrive, so a run measures the gateway's sustained throughput rather than its round trip.
+*/
+class GatewayLoadGen
+{
+    public:
+        GatewayLoadGen(const LoadGenOptions & options);
+        LoadGenResult run();
+        static void printResult(std::ostream & os, const LoadGenResult & result);
+        static bool parseArgs(int argc, char ** argv, LoadGenOptions & options);
+        static void printUsage(std::ostream & os, const char * program);
+    private:
+        LoadGenOptions options;
+};
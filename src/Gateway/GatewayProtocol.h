@@ -0,0 +1,114 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file GatewayProtocol.h
+ * @author Edward Martinez
+ * @brief Binary wire format of the order-entry gateway.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Every message is a fixed-size struct in host byte order, starting with a GatewayHeader whose
+ * length is the size of the whole message. The gateway only listens on local endpoints, so
+ * both ends share the host's byte order.
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstdint>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define GW_PRODUCT_BYTES 16 /**< Product name field, NUL padded; "ETH/BTC" and the like. */
+#define GW_UNIX_PREFIX "unix:"
+#define GW_TCP_PREFIX  "tcp:"
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** Message types. New and cancel go from client to gateway, ack and fill come back. */
+enum class GatewayMsgType:std::uint8_t {newOrder = 1, cancel = 2, ack = 3, fill = 4};
+
+/** Order side on the wire. */
+enum class GatewaySide:std::uint8_t {bid = 0, ask = 1};
+
+/** Outcome reported by an ack. */
+enum class GatewayStatus:std::uint8_t {accepted = 0, cancelled = 1, noFunds = 2, invalid = 3, unknownOrder = 4};
+
+struct GatewayHeader
+{
+    std::uint16_t length;   /**< Bytes in the whole message, header included. */
+    GatewayMsgType type;
+    std::uint8_t reserved;
+};
+
+/*! @struct GatewayNewOrder
+    @brief Enters an ask or bid in the current timeframe. Answered by an ack.
+*/
+struct GatewayNewOrder
+{
+    GatewayHeader header;
+    GatewaySide side;
+    std::uint8_t reserved[3];
+    std::uint64_t clientTag;    /**< Echoed in the ack; free for the client's use. */
+    double price;
+    double amount;
+    char product[GW_PRODUCT_BYTES];
+};
+
+/*! @struct GatewayCancel
+    @brief Cancels an order of the current timeframe. Answered by an ack.
+*/
+struct GatewayCancel
+{
+    GatewayHeader header;
+    std::uint32_t reserved;
+    std::uint64_t clientTag;
+    std::uint64_t orderId;
+};
+
+/*! @struct GatewayAck
+    @brief Answer to a new order or cancel, in the order the requests were received.
+*/
+struct GatewayAck
+{
+    GatewayHeader header;
+    GatewayStatus status;
+    std::uint8_t reserved[3];
+    std::uint64_t clientTag;
+    std::uint64_t orderId;      /**< Id of the accepted or cancelled order; 0 otherwise. */
+};
+
+/*! @struct GatewayFill
+    @brief A sale that filled (part of) one of the connection's orders.
+*/
+struct GatewayFill
+{
+    GatewayHeader header;
+    GatewaySide side;
+    std::uint8_t reserved[3];
+    std::uint64_t orderId;
+    double price;
+    double amount;
+};
+
+static_assert(sizeof(GatewayHeader) == 4, "GatewayHeader must be packed.");
+static_assert(sizeof(GatewayNewOrder) == 48, "GatewayNewOrder must be packed.");
+static_assert(sizeof(GatewayCancel) == 24, "GatewayCancel must be packed.");
+static_assert(sizeof(GatewayAck) == 24, "GatewayAck must be packed.");
+static_assert(sizeof(GatewayFill) == 32, "GatewayFill must be packed.");
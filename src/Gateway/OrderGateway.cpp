@@ -0,0 +1,573 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file OrderGateway.cpp
+ * @author Edward Martinez
+ * @brief Source file for the epoll-based order-entry gateway.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderGateway.h"
+#include "UserMenuIF.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    bool hasPrefix(const std::string & s, const char * prefix)
+    {
+        return 0 == s.compare(0, std::strlen(prefix), prefix);
+    }
+
+    /**
+     * @brief Socket address of "unix:<path>" or "tcp:<port>" (loopback only).
+     * @return Size of the address written to storage.
+     */
+    socklen_t endpointAddress(const std::string & endpoint, sockaddr_storage & storage, const char * method)
+    {
+        std::memset(&storage, 0, sizeof(storage));
+        if(hasPrefix(endpoint, GW_UNIX_PREFIX))
+        {
+            std::string path = endpoint.substr(std::strlen(GW_UNIX_PREFIX));
+            sockaddr_un & addr = reinterpret_cast<sockaddr_un &>(storage);
+            if(path.empty() || (path.size() >= sizeof(addr.sun_path)))
+            {
+                throw std::runtime_error(std::string("OrderGateway::") + method + " - Invalid socket path: " + path);
+            }
+            addr.sun_family = AF_UNIX;
+            std::memcpy(addr.sun_path, path.c_str(), path.size());
+            return sizeof(sockaddr_un);
+        }
+        if(hasPrefix(endpoint, GW_TCP_PREFIX))
+        {
+            unsigned long port = std::strtoul(endpoint.c_str() + std::strlen(GW_TCP_PREFIX), nullptr, 10);
+            if((0 == port) || (port > 65535))
+            {
+                throw std::runtime_error(std::string("OrderGateway::") + method + " - Invalid port in " + endpoint);
+            }
+            sockaddr_in & addr = reinterpret_cast<sockaddr_in &>(storage);
+            addr.sin_family      = AF_INET;
+            addr.sin_port        = htons((std::uint16_t)port);
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            return sizeof(sockaddr_in);
+        }
+        throw std::runtime_error(std::string("OrderGateway::") + method + " - Endpoint must be unix:<path> or tcp:<port>: " + endpoint);
+    }
+
+    /**
+     * @brief Size of a client request of the given type; 0 for types a client may not send.
+     */
+    std::size_t requestSize(GatewayMsgType type)
+    {
+        switch(type)
+        {
+            case GatewayMsgType::newOrder: return sizeof(GatewayNewOrder);
+            case GatewayMsgType::cancel:   return sizeof(GatewayCancel);
+            default:                       return 0;
+        }
+    }
+
+    /**
+     * @brief Header of a message sent by the gateway.
+     */
+    GatewayHeader replyHeader(GatewayMsgType type, std::size_t size)
+    {
+        GatewayHeader h;
+        h.length   = (std::uint16_t)size;
+        h.type     = type;
+        h.reserved = 0;
+        return h;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor. Nothing is listened on until listen() is called.
+ * @param app Simulation the orders are entered into. It should be initialised (MerkelMain::init(true)).
+ */
+OrderGateway::OrderGateway(MerkelMain & app)
+: app(app)
+{
+    epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    wakeFd  = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if((epollFd < 0) || (wakeFd < 0))
+    {
+        if(epollFd >= 0) ::close(epollFd);
+        if(wakeFd >= 0)  ::close(wakeFd);
+        throw std::runtime_error(std::string("OrderGateway::OrderGateway - Cannot create the event loop."));
+    }
+    epoll_event ev{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = wakeFd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+    app.setFillListener([this](const OrderBookEntry & sale){ this->onFill(sale); });
+}
+
+/**
+ * @brief Destructor. Closes every connection and the listening socket.
+ */
+OrderGateway::~OrderGateway()
+{
+    app.setFillListener(FillListener());
+    for(std::unique_ptr<GatewayConnection> & c : connections)
+    {
+        if(c) ::close(c->fd);
+    }
+    if(listenFd >= 0) ::close(listenFd);
+    if(!unixPath.empty()) ::unlink(unixPath.c_str());
+    ::close(wakeFd);
+    ::close(epollFd);
+}
+
+/**
+ * @brief Starts accepting clients.
+ * @param endpoint "unix:<path>" (an existing socket file is replaced) or "tcp:<port>" on 127.0.0.1.
+ */
+void OrderGateway::listen(const std::string & endpoint)
+{
+    if(listenFd >= 0)
+    {
+        throw std::runtime_error(std::string("OrderGateway::listen - Already listening."));
+    }
+    sockaddr_storage addr;
+    socklen_t len = endpointAddress(endpoint, addr, "listen");
+    int fd = ::socket(addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(fd < 0) throw std::runtime_error(std::string("OrderGateway::listen - socket() failed."));
+
+    if(AF_UNIX == addr.ss_family)
+    {
+        unixPath = endpoint.substr(std::strlen(GW_UNIX_PREFIX));
+        ::unlink(unixPath.c_str());
+    }
+    else
+    {
+        int on = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    }
+    if((::bind(fd, (sockaddr *)&addr, len) != 0) || (::listen(fd, SOMAXCONN) != 0))
+    {
+        ::close(fd);
+        unixPath.clear();
+        throw std::runtime_error(std::string("OrderGateway::listen - Cannot listen on ") + endpoint);
+    }
+    listenFd = fd;
+    epoll_event ev{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = listenFd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+}
+
+/**
+ * @brief Opens a blocking client connection to a gateway endpoint. @see listen()
+ * @return Connected socket, owned by the caller.
+ */
+int OrderGateway::connect(const std::string & endpoint)
+{
+    sockaddr_storage addr;
+    socklen_t len = endpointAddress(endpoint, addr, "connect");
+    int fd = ::socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if(fd < 0) throw std::runtime_error(std::string("OrderGateway::connect - socket() failed."));
+    if(::connect(fd, (sockaddr *)&addr, len) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error(std::string("OrderGateway::connect - Cannot connect to ") + endpoint);
+    }
+    if(AF_INET == addr.ss_family)
+    {
+        int on = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+    return fd;
+}
+
+/**
+ * @brief Waits for socket activity once and handles everything that is ready.
+ * @param timeoutMs Longest wait; -1 waits until something happens.
+ * @return Number of requests handled.
+ */
+std::size_t OrderGateway::poll(int timeoutMs)
+{
+    epoll_event events[GW_MAX_EVENTS];
+    int n = ::epoll_wait(epollFd, events, GW_MAX_EVENTS, timeoutMs);
+    if(n <= 0) return 0;
+    stats.wakeups++;
+
+    std::uint64_t before = stats.messages;
+    for(int i = 0; i < n; i++)
+    {
+        int fd = events[i].data.fd;
+        if(fd == listenFd)
+        {
+            this->acceptAll();
+            continue;
+        }
+        if(fd == wakeFd)
+        {
+            std::uint64_t count;
+            while(::read(wakeFd, &count, sizeof(count)) > 0) {}
+            continue;
+        }
+        if(((std::size_t)fd >= connections.size()) || !connections[(std::size_t)fd]) continue;
+        GatewayConnection & c = *connections[(std::size_t)fd];
+        if(events[i].events & EPOLLOUT) this->onWritable(c);
+        if(!connections[(std::size_t)fd]) continue;
+        if(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) this->onReadable(c);
+    }
+    std::size_t handled = (std::size_t)(stats.messages - before);
+    if(handled > 0) app.commitJournal();        //Group commit per wake-up, before any ack is sent.
+    this->flushQueued();
+    return handled;
+}
+
+/**
+ * @brief Serves clients and advances the timeframe every tickMs until stop() is called.
+ * @param tickMs Time between calls to advance(); 0 never advances.
+ */
+void OrderGateway::run(unsigned tickMs)
+{
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point next = Clock::now() + std::chrono::milliseconds(tickMs);
+    while(!stopping)
+    {
+        int wait = -1;
+        if(tickMs > 0)
+        {
+            long long left = std::chrono::duration_cast<std::chrono::milliseconds>(next - Clock::now()).count();
+            wait = (int)std::max<long long>(left, 0);
+        }
+        this->poll(wait);
+        if((tickMs > 0) && (Clock::now() >= next))
+        {
+            this->advance();
+            next = Clock::now() + std::chrono::milliseconds(tickMs);
+        }
+    }
+    Logger::instance().flush();
+}
+
+/**
+ * @brief Matches the current timeframe and sends each fill to the connection that entered the order.
+ */
+void OrderGateway::advance()
+{
+    app.processNext();
+    owners.clear();                             //Orders left open expired with the timeframe.
+    app.commitJournal();
+    this->flushQueued();
+}
+
+/**
+ * @brief Makes run() return. Safe to call from another thread or a signal handler.
+ */
+void OrderGateway::stop()
+{
+    stopping = true;
+    std::uint64_t one = 1;
+    ssize_t n = ::write(wakeFd, &one, sizeof(one));
+    (void)n;
+}
+
+/**
+ * @brief Number of connected clients.
+ */
+std::size_t OrderGateway::getConnectionCount() const
+{
+    return this->nConnections;
+}
+
+/**
+ * @brief Totals since construction.
+ */
+const GatewayStats & OrderGateway::getStats() const
+{
+    return this->stats;
+}
+
+/**
+ * @brief Accepts every pending client.
+ */
+void OrderGateway::acceptAll()
+{
+    while(true)
+    {
+        int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if(fd < 0)
+        {
+            if((EMFILE == errno) || (ENFILE == errno)) MRX_LOG_WARN("OrderGateway::acceptAll - Out of descriptors, {} clients connected.", nConnections);
+            return;
+        }
+        if(unixPath.empty())
+        {
+            int on = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        }
+        if((std::size_t)fd >= connections.size()) connections.resize((std::size_t)fd + 1);
+        std::unique_ptr<GatewayConnection> & c = connections[(std::size_t)fd];
+        c.reset(new GatewayConnection());
+        c->fd     = fd;
+        c->serial = nextSerial++;
+        c->in.resize(GW_READ_BYTES);
+
+        epoll_event ev{};
+        ev.events  = EPOLLIN;
+        ev.data.fd = fd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+        nConnections++;
+        stats.accepted++;
+    }
+}
+
+/**
+ * @brief Reads what the client sent and handles every complete request.
+ */
+void OrderGateway::onReadable(GatewayConnection & c)
+{
+    ssize_t got = ::read(c.fd, c.in.data() + c.inUsed, c.in.size() - c.inUsed);
+    if(got < 0)
+    {
+        if((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)) return;
+        this->close(c);
+        return;
+    }
+    if(0 == got)
+    {
+        this->close(c);
+        return;
+    }
+    stats.reads++;
+    c.inUsed += (std::size_t)got;
+
+    std::size_t pos = 0;
+    while(c.inUsed - pos >= sizeof(GatewayHeader))
+    {
+        GatewayHeader header;
+        std::memcpy(&header, c.in.data() + pos, sizeof(header));
+        if((0 == requestSize(header.type)) || (header.length != requestSize(header.type)))
+        {
+            MRX_LOG_WARN("OrderGateway::onReadable - Dropping client {}: bad message type {} length {}.",
+                         c.serial, (unsigned)header.type, (unsigned)header.length);
+            stats.dropped++;
+            this->close(c);
+            return;
+        }
+        if(c.inUsed - pos < header.length) break;
+        if(!this->handle(c, c.in.data() + pos, header)) return;
+        pos += header.length;
+    }
+    c.inUsed -= pos;
+    if(c.inUsed > 0) std::memmove(c.in.data(), c.in.data() + pos, c.inUsed);
+}
+
+/**
+ * @brief Sends output that did not fit in the socket buffer earlier, then resumes reading.
+ */
+void OrderGateway::onWritable(GatewayConnection & c)
+{
+    if(!this->send(c) || (c.outSent < c.out.size())) return;
+    c.writing = false;
+    epoll_event ev{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = c.fd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+}
+
+/**
+ * @brief Runs one request and queues its ack.
+ * @return FALSE if the connection was closed.
+ */
+bool OrderGateway::handle(GatewayConnection & c, const char * msg, const GatewayHeader & header)
+{
+    stats.messages++;
+    if(GatewayMsgType::newOrder == header.type)
+    {
+        GatewayNewOrder req;
+        std::memcpy(&req, msg, sizeof(req));
+        std::size_t n = 0;
+        while((n < GW_PRODUCT_BYTES) && ('\0' != req.product[n])) n++;
+        bool valid = (n > 0) && (req.price > 0.0) && (req.amount > 0.0) && (req.side <= GatewaySide::ask);
+        OrderId id = ORDER_ID_NONE;
+        GatewayStatus status = GatewayStatus::invalid;
+        if(valid)
+        {
+            order._product.assign(req.product, n);
+            order._OrderType = (GatewaySide::ask == req.side) ? OrderBookType::ask : OrderBookType::bid;
+            order._price     = req.price;
+            order._amount    = req.amount;
+            try
+            {
+                id = app.submitOrder(order);
+                status = (ORDER_ID_NONE == id) ? GatewayStatus::noFunds : GatewayStatus::accepted;
+            }
+            catch(const std::exception &)
+            {
+                status = GatewayStatus::invalid; //E.g. a product that is not BASE/QUOTE.
+            }
+        }
+        if(ORDER_ID_NONE != id) owners[id] = std::make_pair(c.fd, c.serial);
+        this->acknowledge(c, status, req.clientTag, id);
+    }
+    else
+    {
+        GatewayCancel req;
+        std::memcpy(&req, msg, sizeof(req));
+        auto owner = owners.find(req.orderId);
+        bool mine = (owners.end() != owner) && (owner->second.second == c.serial);
+        if(mine && app.cancelUserOrder(req.orderId))
+        {
+            owners.erase(owner);
+            this->acknowledge(c, GatewayStatus::cancelled, req.clientTag, req.orderId);
+        }
+        else
+        {
+            this->acknowledge(c, GatewayStatus::unknownOrder, req.clientTag, ORDER_ID_NONE);
+        }
+    }
+    return connections[(std::size_t)c.fd] != nullptr;
+}
+
+/**
+ * @brief Queues an ack for a request.
+ */
+void OrderGateway::acknowledge(GatewayConnection & c, GatewayStatus status, std::uint64_t clientTag, OrderId id)
+{
+    if((GatewayStatus::accepted != status) && (GatewayStatus::cancelled != status)) stats.rejected++;
+    GatewayAck ack;
+    std::memset(&ack, 0, sizeof(ack));
+    ack.header    = replyHeader(GatewayMsgType::ack, sizeof(ack));
+    ack.status    = status;
+    ack.clientTag = clientTag;
+    ack.orderId   = id;
+    this->queue(c, &ack, sizeof(ack));
+}
+
+/**
+ * @brief Appends a message to a connection's output; it is sent by flushQueued().
+ */
+void OrderGateway::queue(GatewayConnection & c, const void * msg, std::size_t n)
+{
+    const char * bytes = static_cast<const char *>(msg);
+    c.out.insert(c.out.end(), bytes, bytes + n);
+    if(!c.queued && !c.writing)
+    {
+        c.queued = true;
+        flushList.push_back(c.fd);
+    }
+}
+
+/**
+ * @brief Sends the output queued since the last flush, one send() per connection.
+ */
+void OrderGateway::flushQueued()
+{
+    for(int fd : flushList)
+    {
+        if(((std::size_t)fd >= connections.size()) || !connections[(std::size_t)fd]) continue;
+        GatewayConnection & c = *connections[(std::size_t)fd];
+        if(!c.queued) continue;
+        c.queued = false;
+        if(!this->send(c) || (c.outSent == c.out.size())) continue;
+        c.writing = true;                       //Socket buffer full: stop reading until the client catches up.
+        epoll_event ev{};
+        ev.events  = EPOLLOUT;
+        ev.data.fd = c.fd;
+        ::epoll_ctl(epollFd, EPOLL_CTL_MOD, c.fd, &ev);
+    }
+    flushList.clear();
+}
+
+/**
+ * @brief Sends as much pending output as the socket takes.
+ * @return FALSE if the connection failed and was closed.
+ */
+bool OrderGateway::send(GatewayConnection & c)
+{
+    while(c.outSent < c.out.size())
+    {
+        ssize_t n = ::send(c.fd, c.out.data() + c.outSent, c.out.size() - c.outSent, MSG_NOSIGNAL);
+        stats.writes++;
+        if(n < 0)
+        {
+            if((EAGAIN == errno) || (EWOULDBLOCK == errno)) break;
+            if(EINTR == errno) continue;
+            this->close(c);
+            return false;
+        }
+        c.outSent += (std::size_t)n;
+    }
+    if(c.outSent == c.out.size())
+    {
+        c.out.clear();
+        c.outSent = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Closes a connection. Its orders stay in the book until they fill or expire.
+ */
+void OrderGateway::close(GatewayConnection & c)
+{
+    int fd = c.fd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections[(std::size_t)fd].reset();
+    nConnections--;
+}
+
+/**
+ * @brief Fill listener: queues a fill for the connection that owns the order, if it is still connected.
+ */
+void OrderGateway::onFill(const OrderBookEntry & sale)
+{
+    auto owner = owners.find(sale.orderId);
+    if(owners.end() == owner) return;
+    std::size_t fd = (std::size_t)owner->second.first;
+    if((fd >= connections.size()) || !connections[fd] || (connections[fd]->serial != owner->second.second)) return;
+
+    GatewayFill fill;
+    std::memset(&fill, 0, sizeof(fill));
+    fill.header  = replyHeader(GatewayMsgType::fill, sizeof(fill));
+    fill.side    = (OrderBookType::asksale == sale._OrderType) ? GatewaySide::ask : GatewaySide::bid;
+    fill.orderId = sale.orderId;
+    fill.price   = sale._price;
+    fill.amount  = sale._amount;
+    this->queue(*connections[fd], &fill, sizeof(fill));
+    stats.fills++;
+}
@@ -0,0 +1,132 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file OrderGateway.h
+ * @author Edward Martinez
+ * @brief Header file for the epoll-based order-entry gateway.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "GatewayProtocol.h"
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define GW_MAX_EVENTS      256          /**< Ready sockets handled per epoll_wait(). */
+#define GW_READ_BYTES      (64u << 10)  /**< Input buffer per connection; one read() fills it at most. */
+#define GW_TICK_MS_DEFAULT 1000         /**< Time between timeframe advances in run(). */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+class MerkelMain;
+
+/*! @struct GatewayStats
+    @brief Running totals of an OrderGateway.
+*/
+struct GatewayStats
+{
+    std::uint64_t accepted = 0;     /**< Connections accepted. */
+    std::uint64_t dropped  = 0;     /**< Connections closed for a protocol error. */
+    std::uint64_t messages = 0;     /**< Requests handled. */
+    std::uint64_t rejected = 0;     /**< Requests acked with a status other than accepted or cancelled. */
+    std::uint64_t fills    = 0;     /**< Fill messages queued. */
+    std::uint64_t reads    = 0;     /**< read() calls that returned data. */
+    std::uint64_t writes   = 0;     /**< send() calls. */
+    std::uint64_t wakeups  = 0;     /**< epoll_wait() calls that returned events. */
+};
+
+/*! @struct GatewayConnection
+    @brief One client socket with its partially received input and unsent output.
+*/
+struct GatewayConnection
+{
+    int fd = -1;
+    std::uint64_t serial = 0;       /**< Distinguishes connections that reuse a closed descriptor. */
+    std::vector<char> in;
+    std::size_t inUsed = 0;
+    std::vector<char> out;
+    std::size_t outSent = 0;
+    bool queued  = false;           /**< On the list of connections to flush this iteration. */
+    bool writing = false;           /**< Socket buffer full: input is not read until the output drains. */
+};
+
+/*! @class OrderGateway
+    @brief Accepts GatewayProtocol clients on a Unix or loopback TCP socket and feeds their orders to MerkelMain.
+
+    A single thread runs a level-triggered epoll loop. Each wake-up reads every ready socket
+    (up to GW_READ_BYTES at once), handles every complete message through
+    MerkelMain::submitOrder() / cancelUserOrder(), commits the journal once, and then sends each
+    connection's replies with one send(). A client that stops reading its replies is not read
+    from until it catches up. Orders are the simulated user's, so they share its
+    wallet. Fills are delivered by advance(), which runs processNext() and routes each user fill
+    to the connection that entered the order; orders not filled expire with their timeframe.
+*/
+class OrderGateway
+{
+    public:
+        OrderGateway(MerkelMain & app);
+        ~OrderGateway();
+        OrderGateway(const OrderGateway &) = delete;
+        OrderGateway & operator=(const OrderGateway &) = delete;
+        void listen(const std::string & endpoint);
+        std::size_t poll(int timeoutMs);
+        void run(unsigned tickMs = GW_TICK_MS_DEFAULT);
+        void advance();
+        void stop();
+        std::size_t getConnectionCount() const;
+        const GatewayStats & getStats() const;
+        static int connect(const std::string & endpoint);
+    private:
+        void acceptAll();
+        void onReadable(GatewayConnection & c);
+        void onWritable(GatewayConnection & c);
+        bool handle(GatewayConnection & c, const char * msg, const GatewayHeader & header);
+        void acknowledge(GatewayConnection & c, GatewayStatus status, std::uint64_t clientTag, OrderId id);
+        void queue(GatewayConnection & c, const void * msg, std::size_t n);
+        void flushQueued();
+        bool send(GatewayConnection & c);
+        void close(GatewayConnection & c);
+        void onFill(const OrderBookEntry & sale);
+
+        MerkelMain & app;
+        int epollFd  = -1;
+        int listenFd = -1;
+        int wakeFd   = -1;
+        std::string unixPath;
+        std::vector<std::unique_ptr<GatewayConnection>> connections; /**< Indexed by descriptor. */
+        std::size_t nConnections = 0;
+        std::vector<int> flushList;
+        std::unordered_map<OrderId, std::pair<int, std::uint64_t>> owners; /**< Order id to descriptor and serial. */
+        std::uint64_t nextSerial = 1;
+        OrderBookEntry order{"", "", OrderBookType::bid, 0.0, 0.0}; /**< Reused, so entering orders keeps its string buffers. */
+        GatewayStats stats;
+        std::atomic<bool> stopping{false};
+};
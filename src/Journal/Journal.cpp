@@ -0,0 +1,536 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Journal.cpp
+ * @author Edward Martinez
+ * @brief Source file for the append-only write-ahead journal of user orders and fills.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Journal.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define JOURNAL_HEADER_BYTES      9         /**< length + crc32 + type */
+#define JOURNAL_GROUP_COMMIT_SIZE (1 << 16) /**< Staged bytes that force a commit. */
+#define JOURNAL_MAX_RECORD_BYTES  (1 << 16) /**< Sanity limit used while recovering. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Builds the lookup table for the reflected CRC-32 (IEEE 802.3) polynomial.
+     */
+    struct Crc32Table
+    {
+        std::uint32_t entries[256];
+        Crc32Table()
+        {
+            for(std::uint32_t i = 0; i < 256; i++)
+            {
+                std::uint32_t c = i;
+                for(int k = 0; k < 8; k++)
+                {
+                    c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                }
+                entries[i] = c;
+            }
+        }
+    };
+    const Crc32Table crcTable;
+
+    /**
+     * @brief Bounds-checked little helper for decoding journal payloads.
+     */
+    struct PayloadReader
+    {
+        const unsigned char * pos;
+        const unsigned char * end;
+
+        bool getString(std::string & s)
+        {
+            std::uint16_t len;
+            if(end - pos < (long)sizeof(len)) return false;
+            std::memcpy(&len,pos,sizeof(len));
+            pos += sizeof(len);
+            if(end - pos < len) return false;
+            s.assign(reinterpret_cast<const char *>(pos),len);
+            pos += len;
+            return true;
+        }
+        bool getDouble(double & d)
+        {
+            if(end - pos < (long)sizeof(d)) return false;
+            std::memcpy(&d,pos,sizeof(d));
+            pos += sizeof(d);
+            return true;
+        }
+        bool getU32(std::uint32_t & v)
+        {
+            if(end - pos < (long)sizeof(v)) return false;
+            std::memcpy(&v,pos,sizeof(v));
+            pos += sizeof(v);
+            return true;
+        }
+        bool getU64(std::uint64_t & v)
+        {
+            if(end - pos < (long)sizeof(v)) return false;
+            std::memcpy(&v,pos,sizeof(v));
+            pos += sizeof(v);
+            return true;
+        }
+        bool getByte(unsigned char & b)
+        {
+            if(end == pos) return false;
+            b = *pos++;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Decodes an OrderBookEntry written by Journal::appendEntry().
+     *
+     * The trailing order id and ledger accounts are optional so journals written before they
+     * existed still recover; their orders have no account.
+     */
+    bool decodeEntry(PayloadReader & rd, OrderBookEntry & entry)
+    {
+        unsigned char type;
+        if(!(rd.getString(entry._timestamp) &&
+             rd.getString(entry._product)   &&
+             rd.getByte(type)               &&
+             rd.getDouble(entry._price)     &&
+             rd.getDouble(entry._amount)    &&
+             rd.getString(entry.username)))
+        {
+            return false;
+        }
+        entry._OrderType = static_cast<OrderBookType>(type);
+        entry.orderId    = ORDER_ID_NONE;
+        entry.account    = ACCOUNT_NONE;
+        entry.buyer      = ACCOUNT_NONE;
+        entry.seller     = ACCOUNT_NONE;
+        if((rd.pos != rd.end) && !rd.getU64(entry.orderId)) return false;
+        if(rd.pos == rd.end) return true;
+        return rd.getU32(entry.account) && rd.getU32(entry.buyer) && rd.getU32(entry.seller);
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor. The journal is closed until open() is called.
+ */
+Journal::Journal()
+: fd(-1),
+  committed(0),
+  recordStart(0)
+{
+    buffer.reserve(JOURNAL_GROUP_COMMIT_SIZE + JOURNAL_MAX_RECORD_BYTES);
+}
+
+/**
+ * @brief Destructor. Flushes any staged records.
+ */
+Journal::~Journal()
+{
+    try
+    {
+        this->close();
+    }
+    catch(const std::exception & e)
+    {
+        //Nothing sensible left to do with the error during teardown.
+    }
+}
+
+/**
+ * @brief Opens (or creates) a journal file for appending.
+ *
+ * @param path Path to the journal file.
+ * @param truncateTo Length of the valid prefix reported by recover(). Anything after it (e.g. a
+ *                   record torn by a crash) is discarded so new records are appended cleanly.
+ */
+void Journal::open(const std::string & path, std::size_t truncateTo)
+{
+    this->close();
+    fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if(fd < 0)
+    {
+        throw std::runtime_error(std::string("Journal::open - Failed to open ") + path + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    committed = (0 == ::fstat(fd,&st)) ? (std::size_t)st.st_size : 0;
+    if(committed > truncateTo)
+    {
+        if(0 != ::ftruncate(fd,(off_t)truncateTo))
+        {
+            ::close(fd);
+            fd = -1;
+            throw std::runtime_error(std::string("Journal::open - Failed to truncate torn tail of ") + path);
+        }
+        committed = truncateTo;
+    }
+}
+
+/**
+ * @brief Commits staged records and closes the journal file.
+ */
+void Journal::close()
+{
+    if(fd >= 0)
+    {
+        this->commit();
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+/**
+ * @brief Returns TRUE if the journal is accepting records.
+ */
+bool Journal::isOpen() const
+{
+    return fd >= 0;
+}
+
+/**
+ * @brief Length the journal file will have once the staged records are committed.
+ *
+ * Always a record boundary, so it can be handed back to recover() to skip what came before.
+ */
+std::size_t Journal::size() const
+{
+    return committed + buffer.size();
+}
+
+/**
+ * @brief Stages a user order (as inserted into the orderbook).
+ */
+void Journal::appendOrder(const OrderBookEntry & order)
+{
+    this->appendEntry(JournalRecordType::order, order);
+}
+
+/**
+ * @brief Stages a sale that was applied to the user wallet.
+ */
+void Journal::appendFill(const OrderBookEntry & sale)
+{
+    this->appendEntry(JournalRecordType::fill, sale);
+}
+
+/**
+ * @brief Stages an advance of the simulation clock.
+ */
+void Journal::appendTime(const std::string & timestamp)
+{
+    if(fd < 0) return;
+    this->beginRecord(JournalRecordType::time);
+    this->putString(timestamp);
+    this->endRecord();
+}
+
+/**
+ * @brief Stages the cancellation of a user order.
+ * @param timestamp Timeframe the order was entered in.
+ * @param id Order id given by Wallet::reserve().
+ */
+void Journal::appendCancel(const std::string & timestamp, OrderId id)
+{
+    if(fd < 0) return;
+    this->beginRecord(JournalRecordType::cancel);
+    this->putString(timestamp);
+    this->putU64(id);
+    this->endRecord();
+}
+
+/**
+ * @brief Writes all staged records to the journal file.
+ *
+ * A single write() is issued for the whole batch; short writes are retried until the batch
+ * is on disk (in the page cache), which is enough to survive a crash of the simulator process.
+ */
+void Journal::commit()
+{
+    if((fd < 0) || buffer.empty()) return;
+
+    const unsigned char * pos = buffer.data();
+    std::size_t remaining = buffer.size();
+    while(remaining > 0)
+    {
+        ssize_t n = ::write(fd,pos,remaining);
+        if(n < 0)
+        {
+            if(EINTR == errno) continue;
+            throw std::runtime_error(std::string("Journal::commit - write failed: ") + std::strerror(errno));
+        }
+        pos += n;
+        remaining -= (std::size_t)n;
+        committed += (std::size_t)n;
+    }
+    buffer.clear();
+}
+
+/**
+ * @brief Serialises an OrderBookEntry as a journal record.
+ */
+void Journal::appendEntry(JournalRecordType type, const OrderBookEntry & entry)
+{
+    if(fd < 0) return;
+    this->beginRecord(type);
+    this->putString(entry._timestamp);
+    this->putString(entry._product);
+    buffer.push_back(static_cast<unsigned char>(entry._OrderType));
+    this->putDouble(entry._price);
+    this->putDouble(entry._amount);
+    this->putString(entry.username);
+    this->putU64(entry.orderId);
+    this->putU32(entry.account);
+    this->putU32(entry.buyer);
+    this->putU32(entry.seller);
+    this->endRecord();
+}
+
+/**
+ * @brief Reserves space for a record header and writes the record type.
+ */
+void Journal::beginRecord(JournalRecordType type)
+{
+    recordStart = buffer.size();
+    buffer.resize(recordStart + JOURNAL_HEADER_BYTES - 1);
+    buffer.push_back(static_cast<unsigned char>(type));
+}
+
+/**
+ * @brief Fills in the length and checksum of the record started by beginRecord().
+ *
+ * Triggers a commit once enough records have been staged.
+ */
+void Journal::endRecord()
+{
+    std::uint32_t len = (std::uint32_t)(buffer.size() - recordStart - JOURNAL_HEADER_BYTES);
+    std::uint32_t crc = crc32(buffer.data() + recordStart + 8, len + 1);
+    std::memcpy(buffer.data() + recordStart,     &len, sizeof(len));
+    std::memcpy(buffer.data() + recordStart + 4, &crc, sizeof(crc));
+
+    if(buffer.size() >= JOURNAL_GROUP_COMMIT_SIZE) this->commit();
+}
+
+/**
+ * @brief Appends a length-prefixed string to the staged record.
+ */
+void Journal::putString(const std::string & s)
+{
+    std::uint16_t len = (std::uint16_t)s.size();
+    const unsigned char * p = reinterpret_cast<const unsigned char *>(&len);
+    buffer.insert(buffer.end(), p, p + sizeof(len));
+    buffer.insert(buffer.end(), s.begin(), s.begin() + len);
+}
+
+/**
+ * @brief Appends a raw double to the staged record.
+ */
+void Journal::putDouble(double d)
+{
+    const unsigned char * p = reinterpret_cast<const unsigned char *>(&d);
+    buffer.insert(buffer.end(), p, p + sizeof(d));
+}
+
+/**
+ * @brief Appends an unsigned 32-bit value to the current record.
+ */
+void Journal::putU32(std::uint32_t v)
+{
+    const unsigned char * p = reinterpret_cast<const unsigned char *>(&v);
+    buffer.insert(buffer.end(), p, p + sizeof(v));
+}
+
+/**
+ * @brief Appends an unsigned 64-bit value to the current record.
+ */
+void Journal::putU64(std::uint64_t v)
+{
+    const unsigned char * p = reinterpret_cast<const unsigned char *>(&v);
+    buffer.insert(buffer.end(), p, p + sizeof(v));
+}
+
+/**
+ * @brief Computes the CRC-32 of a byte range.
+ */
+std::uint32_t Journal::crc32(const unsigned char * data, std::size_t len)
+{
+    std::uint32_t c = 0xFFFFFFFFu;
+    for(std::size_t i = 0; i < len; i++)
+    {
+        c = crcTable.entries[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+/**
+ * @brief Rebuilds orderbook, wallet and clock state from a journal file.
+ *
+ * The file is memory-mapped and scanned once. Orders are collected and inserted into the
+ * orderbook as a single batch, fills are applied to the wallet in journal order, and the last
+ * clock record becomes the current time. Wallet holds of user orders are re-created, consumed
+ * by their fills, and released by cancel records and clock records, as they were originally.
+ * A cancel removes its order from the replayed batch, or from the orderbook if the order was
+ * already there (e.g. restored from a checkpoint). Scanning stops at the first truncated or
+ * corrupted record; everything before it is applied. Intact records that cannot be decoded
+ * are skipped and counted.
+ *
+ * @param path Path to the journal file. A missing or empty file is not an error.
+ * @param orderBook Orderbook receiving the journaled user orders.
+ * @param wallet Wallet receiving the journaled fills.
+ * @param currentTime Updated with the last journaled simulation time, if any.
+ * @param from Offset of the first record to replay, e.g. size() when a checkpoint was taken;
+ *             the records before it are already part of the restored state. Past the end of
+ *             the file, nothing is replayed.
+ * @param holdIds Holds already re-created for journaled order ids, e.g. those of the open user
+ *                orders of a restored checkpoint, so later fills and cancels find them.
+ * @return Summary of the replay.
+ */
+JournalRecoveryStats Journal::recover(const std::string & path,
+                                      OrderBook & orderBook,
+                                      Wallet & wallet,
+                                      std::string & currentTime,
+                                      std::size_t from,
+                                      JournalHoldMap holdIds)
+{
+    JournalRecoveryStats stats;
+
+    int rfd = ::open(path.c_str(), O_RDONLY);
+    if(rfd < 0) return stats;
+
+    struct stat st;
+    if((0 != ::fstat(rfd,&st)) || (0 == st.st_size))
+    {
+        ::close(rfd);
+        return stats;
+    }
+    std::size_t fileLen = (std::size_t)st.st_size;
+    void * map = ::mmap(nullptr, fileLen, PROT_READ, MAP_PRIVATE, rfd, 0);
+    ::close(rfd);
+    if(MAP_FAILED == map)
+    {
+        throw std::runtime_error(std::string("Journal::recover - Failed to map ") + path);
+    }
+    ::madvise(map, fileLen, MADV_SEQUENTIAL);
+
+    const unsigned char * base = static_cast<const unsigned char *>(map);
+    const unsigned char * end  = base + fileLen;
+    const unsigned char * pos  = base + std::min(from, fileLen);
+    std::vector<OrderBookEntry> orders;
+    OrderBookEntry entry{"", "", OrderBookType::unknown, 0.0, 0.0};
+
+    while(end - pos >= JOURNAL_HEADER_BYTES)
+    {
+        std::uint32_t len, crc;
+        std::memcpy(&len, pos,     sizeof(len));
+        std::memcpy(&crc, pos + 4, sizeof(crc));
+        if((len > JOURNAL_MAX_RECORD_BYTES) || ((std::size_t)(end - pos) < JOURNAL_HEADER_BYTES + len)) break;
+        if(crc != crc32(pos + 8, len + 1)) break;
+
+        JournalRecordType type = static_cast<JournalRecordType>(pos[8]);
+        PayloadReader rd{pos + JOURNAL_HEADER_BYTES, pos + JOURNAL_HEADER_BYTES + len};
+        bool ok = false;
+        switch(type)
+        {
+            case JournalRecordType::order:
+                ok = decodeEntry(rd,entry);
+                if(ok)
+                {
+                    if(ORDER_ID_NONE != entry.orderId)
+                    {
+                        OrderId journaled = entry.orderId;
+                        entry.orderId = wallet.reserve(entry);
+                        holdIds[journaled] = entry.orderId;
+                    }
+                    orders.push_back(std::move(entry));
+                    stats.nOrders++;
+                }
+                break;
+            case JournalRecordType::fill:
+                ok = decodeEntry(rd,entry);
+                if(ok)
+                {
+                    auto held = holdIds.find(entry.orderId);
+                    entry.orderId = (held == holdIds.end()) ? ORDER_ID_NONE : held->second;
+                    wallet.processSale(entry);
+                    stats.nFills++;
+                }
+                break;
+            case JournalRecordType::time:
+                ok = rd.getString(currentTime);
+                if(ok)
+                {
+                    wallet.releaseAll(); //Orders of the matched timeframe expired.
+                    stats.nTimes++;
+                }
+                break;
+            case JournalRecordType::cancel:
+            {
+                OrderId id = ORDER_ID_NONE;
+                ok = rd.getString(entry._timestamp) && rd.getU64(id);
+                if(ok)
+                {
+                    auto held = holdIds.find(id);
+                    id = (held == holdIds.end()) ? ORDER_ID_NONE : held->second;
+                    if(ORDER_ID_NONE == id) break;
+                    wallet.release(id);
+                    auto it = std::find_if(orders.rbegin(), orders.rend(), [id](const OrderBookEntry & e){ return e.orderId == id; });
+                    if(it != orders.rend()) orders.erase(std::next(it).base());
+                    else orderBook.cancelOrder(entry._timestamp, id);
+                    stats.nCancels++;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        //The record passed its checksum, so its length is trusted: step over it rather than
+        //reporting a torn tail, which would get it and every record after it truncated.
+        if(!ok) stats.nSkipped++;
+        pos += JOURNAL_HEADER_BYTES + len;
+    }
+
+    stats.validBytes = (std::size_t)(pos - base);
+    stats.tornTail   = (pos != end);
+    ::munmap(map, fileLen);
+
+    orderBook.insertOrders(orders);
+    return stats;
+}
@@ -0,0 +1,103 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Journal.h
+ * @author Edward Martinez
+ * @brief Header file for the append-only write-ahead journal of user orders and fills.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+#include "OrderBook.h"
+#include "Wallet.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+enum class JournalRecordType:std::uint8_t {order = 1, fill = 2, time = 3, cancel = 4};
+
+/** Journaled order id -> id of the wallet hold that stands for it after recovery. */
+typedef std::unordered_map<OrderId, OrderId> JournalHoldMap;
+
+/*! @struct JournalRecoveryStats
+    @brief Summary of a journal replay.
+*/
+struct JournalRecoveryStats
+{
+    std::size_t nOrders   = 0;
+    std::size_t nFills    = 0;
+    std::size_t nTimes    = 0;
+    std::size_t nCancels  = 0;
+    std::size_t nSkipped  = 0;  /**< Intact records of an unknown type or layout, e.g. from a newer build. */
+    std::size_t validBytes = 0; /**< Length of the journal prefix made of intact records. */
+    bool tornTail = false;      /**< TRUE if trailing bytes were truncated or failed their checksum. */
+};
+
+/*! @class Journal
+    @brief Append-only, checksummed journal of order commands and fills.
+
+    Records are laid out as [uint32 length][uint32 crc32][uint8 type][payload], where the
+    checksum covers the type byte and the payload. Appends are staged in memory and written
+    with a single write() per commit() (group commit), so a burst of commands costs one syscall.
+*/
+class Journal
+{
+    public:
+        Journal();
+        ~Journal();
+        Journal(const Journal &) = delete;
+        Journal & operator=(const Journal &) = delete;
+        void open(const std::string & path, std::size_t truncateTo);
+        void close();
+        bool isOpen() const;
+        std::size_t size() const;
+        void appendOrder(const OrderBookEntry & order);
+        void appendFill(const OrderBookEntry & sale);
+        void appendTime(const std::string & timestamp);
+        void appendCancel(const std::string & timestamp, OrderId id);
+        void commit();
+        static JournalRecoveryStats recover(const std::string & path,
+                                            OrderBook & orderBook,
+                                            Wallet & wallet,
+                                            std::string & currentTime,
+                                            std::size_t from = 0,
+                                            JournalHoldMap holdIds = JournalHoldMap());
+        static std::uint32_t crc32(const unsigned char * data, std::size_t len);
+    private:
+        void appendEntry(JournalRecordType type, const OrderBookEntry & entry);
+        void beginRecord(JournalRecordType type);
+        void endRecord();
+        void putString(const std::string & s);
+        void putDouble(double d);
+        void putU32(std::uint32_t v);
+        void putU64(std::uint64_t v);
+        int fd;
+        std::size_t committed;  /**< Bytes of the file written so far. */
+        std::size_t recordStart;
+        std::vector<unsigned char> buffer;
+};
@@ -0,0 +1,308 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ConcurrentLedger.cpp
+ * @author Edward Martinez
+ * @brief Source file for the thread-safe multi-account balance ledger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "ConcurrentLedger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LEDGER_SPIN_LIMIT 64 /**< Spins on a held row lock before yielding the CPU. */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor. Every balance starts at 0.
+ * @param accounts Number of accounts; ids run from 0 to accounts - 1.
+ * @param currencies Number of currency columns; SymbolTable ids must stay below it.
+ */
+ConcurrentLedger::ConcurrentLedger(std::size_t accounts, std::size_t currencies)
+: nAccounts(accounts),
+  nCurrencies(std::max<std::size_t>(currencies, 1))
+{
+    if(accounts >= (std::size_t)ACCOUNT_NONE)
+    {
+        throw std::runtime_error(std::string("ConcurrentLedger::ConcurrentLedger - Too many accounts."));
+    }
+    rowBytes = LEDGER_LOCK_BYTES + nCurrencies * sizeof(std::atomic<double>);
+    rowBytes = (rowBytes + LEDGER_CACHE_LINE - 1) / LEDGER_CACHE_LINE * LEDGER_CACHE_LINE;
+
+    storage.reset(new unsigned char[nAccounts * rowBytes + LEDGER_CACHE_LINE]);
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(storage.get());
+    rows = storage.get() + (LEDGER_CACHE_LINE - base % LEDGER_CACHE_LINE) % LEDGER_CACHE_LINE;
+    for(AccountId a = 0; a < nAccounts; a++)
+    {
+        new (&lockOf(a)) std::atomic<std::uint32_t>(0);
+        for(CurrencyId c = 0; c < nCurrencies; c++) new (&cell(a, c)) std::atomic<double>(0.0);
+    }
+}
+
+/**
+ * @brief Number of accounts; every account id is below this value.
+ */
+std::size_t ConcurrentLedger::getAccountCount() const
+{
+    return this->nAccounts;
+}
+
+/**
+ * @brief Number of balance columns per account.
+ */
+std::size_t ConcurrentLedger::getCurrencyCount() const
+{
+    return this->nCurrencies;
+}
+
+/**
+ * @brief Bytes used by the balance table, padding included.
+ */
+std::size_t ConcurrentLedger::getMemoryBytes() const
+{
+    return nAccounts * rowBytes + LEDGER_CACHE_LINE;
+}
+
+/**
+ * @brief Balance of an account in a currency; 0 for unknown accounts or currencies.
+ */
+double ConcurrentLedger::getBalance(AccountId account, CurrencyId currency) const
+{
+    if((account >= nAccounts) || (currency >= nCurrencies)) return 0.0;
+    return this->cell(account, currency).load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Sum of a currency over every account. Exact once concurrent updates have finished.
+ */
+double ConcurrentLedger::getTotal(CurrencyId currency) const
+{
+    double total = 0.0;
+    if(currency >= nCurrencies) return total;
+    for(AccountId a = 0; a < nAccounts; a++) total += this->cell(a, currency).load(std::memory_order_acquire);
+    return total;
+}
+
+/**
+ * @brief Copies every balance of an account, consistent with respect to settle().
+ */
+void ConcurrentLedger::snapshot(AccountId account, std::vector<double> & out)
+{
+    this->check(account, 0, "snapshot");
+    out.resize(nCurrencies);
+    std::atomic<std::uint32_t> & l = this->lockOf(account);
+    lock(l);
+    for(CurrencyId c = 0; c < nCurrencies; c++) out[c] = this->cell(account, c).load(std::memory_order_relaxed);
+    unlock(l);
+}
+
+/**
+ * @brief Adds currency to an account.
+ * @param amount Amount to be added. Must be non-negative.
+ */
+void ConcurrentLedger::deposit(AccountId account, CurrencyId currency, double amount)
+{
+    if(amount < 0)
+    {
+        throw std::runtime_error(std::string("ConcurrentLedger::deposit - Received negative currency amount."));
+    }
+    this->check(account, currency, "deposit");
+    add(this->cell(account, currency), amount);
+}
+
+/**
+ * @brief Removes currency from an account if the balance allows it, atomically with the check.
+ * @return TRUE if the amount was removed.
+ */
+bool ConcurrentLedger::withdraw(AccountId account, CurrencyId currency, double amount)
+{
+    if(amount < 0)
+    {
+        throw std::runtime_error(std::string("ConcurrentLedger::withdraw - Received negative currency amount."));
+    }
+    this->check(account, currency, "withdraw");
+    std::atomic<double> & balance = this->cell(account, currency);
+    double seen = balance.load(std::memory_order_relaxed);
+    do
+    {
+        if(seen < amount) return false;
+    } while(!balance.compare_exchange_weak(seen, seen - amount, std::memory_order_acq_rel, std::memory_order_relaxed));
+    return true;
+}
+
+/**
+ * @brief Moves currency between two accounts if the sender's balance allows it.
+ *
+ * The amount leaves the sender before it reaches the receiver, so a concurrent getTotal() may
+ * briefly miss it but never counts it twice.
+ * @return TRUE if the amount was moved.
+ */
+bool ConcurrentLedger::transfer(AccountId from, AccountId to, CurrencyId currency, double amount)
+{
+    this->check(to, currency, "transfer");
+    if(!this->withdraw(from, currency, amount)) return false;
+    add(this->cell(to, currency), amount);
+    return true;
+}
+
+/**
+ * @brief Settles a sale produced by the matcher between its buyer and seller. @see Ledger::settle()
+ */
+void ConcurrentLedger::settle(const OrderBookEntry & sale)
+{
+    if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) return;
+    this->settle(SymbolTable::instance().product(sale._product), sale.buyer, sale.seller, sale._price, sale._amount);
+}
+
+/**
+ * @brief Moves amount of the base currency from seller to buyer, and amount x price of the quote back.
+ *
+ * Both rows are locked, lower account id first, so fills between the same accounts on other
+ * threads cannot deadlock. As in Ledger, balances may go negative and a side without an
+ * account (ACCOUNT_NONE) is not booked.
+ */
+void ConcurrentLedger::settle(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount)
+{
+    if((ACCOUNT_NONE == buyer) && (ACCOUNT_NONE == seller)) return;
+    CurrencyId top = std::max(pair.base, pair.quote);
+    if(ACCOUNT_NONE != buyer)  this->check(buyer, top, "settle");
+    if(ACCOUNT_NONE != seller) this->check(seller, top, "settle");
+    double value = amount * price;
+
+    AccountId first  = std::min(buyer, seller);     //ACCOUNT_NONE sorts last.
+    AccountId second = std::max(buyer, seller);
+    if((ACCOUNT_NONE == second) || (first == second)) second = ACCOUNT_NONE;
+    lock(this->lockOf(first));
+    if(ACCOUNT_NONE != second) lock(this->lockOf(second));
+
+    if(ACCOUNT_NONE != buyer)
+    {
+        add(this->cell(buyer, pair.base), amount);
+        add(this->cell(buyer, pair.quote), -value);
+    }
+    if(ACCOUNT_NONE != seller)
+    {
+        add(this->cell(seller, pair.base), -amount);
+        add(this->cell(seller, pair.quote), value);
+    }
+
+    if(ACCOUNT_NONE != second) unlock(this->lockOf(second));
+    unlock(this->lockOf(first));
+}
+
+/**
+ * @brief Settles every sale of a batch. Several threads may settle batches at once.
+ * @return Number of sales that involved at least one account.
+ */
+std::size_t ConcurrentLedger::settleAll(const std::vector<OrderBookEntry> & sales)
+{
+    std::size_t n = 0;
+    const std::string * product = nullptr;
+    ProductPair pair{0, 0};
+    for(const OrderBookEntry & sale : sales)
+    {
+        if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) continue;
+        if((nullptr == product) || (*product != sale._product))
+        {
+            product = &sale._product;
+            pair    = SymbolTable::instance().product(sale._product);
+        }
+        this->settle(pair, sale.buyer, sale.seller, sale._price, sale._amount);
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Lock word at the start of an account's row.
+ */
+std::atomic<std::uint32_t> & ConcurrentLedger::lockOf(AccountId account) const
+{
+    return *reinterpret_cast<std::atomic<std::uint32_t> *>(rows + (std::size_t)account * rowBytes);
+}
+
+/**
+ * @brief One balance of an account's row.
+ */
+std::atomic<double> & ConcurrentLedger::cell(AccountId account, CurrencyId currency) const
+{
+    unsigned char * row = rows + (std::size_t)account * rowBytes + LEDGER_LOCK_BYTES;
+    return reinterpret_cast<std::atomic<double> *>(row)[currency];
+}
+
+/**
+ * @brief Throws if an account or currency id is outside the table.
+ */
+void ConcurrentLedger::check(AccountId account, CurrencyId currency, const char * method) const
+{
+    if((account >= nAccounts) || (currency >= nCurrencies))
+    {
+        throw std::runtime_error(std::string("ConcurrentLedger::") + method + " - Account or currency outside the ledger.");
+    }
+}
+
+/**
+ * @brief Atomically adds a signed amount to a balance.
+ */
+void ConcurrentLedger::add(std::atomic<double> & balance, double delta)
+{
+    double seen = balance.load(std::memory_order_relaxed);
+    while(!balance.compare_exchange_weak(seen, seen + delta, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Takes a row lock, spinning briefly and then yielding while another thread holds it.
+ */
+void ConcurrentLedger::lock(std::atomic<std::uint32_t> & l)
+{
+    unsigned spins = 0;
+    while(0 != l.exchange(1, std::memory_order_acquire))
+    {
+        while(0 != l.load(std::memory_order_relaxed))
+        {
+            if(++spins >= LEDGER_SPIN_LIMIT)
+            {
+                spins = 0;
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Releases a row lock.
+ */
+void ConcurrentLedger::unlock(std::atomic<std::uint32_t> & l)
+{
+    l.store(0, std::memory_order_release);
+}
@@ -0,0 +1,89 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ConcurrentLedger.h
+ * @author Edward Martinez
+ * @brief Header file for the thread-safe multi-account balance ledger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "../OrderBookLib/OrderBookLib.h"
+#include "../OrderBookLib/SymbolTable.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LEDGER_CACHE_LINE 64 /**< Account rows start on their own cache line. */
+#define LEDGER_LOCK_BYTES 8  /**< Room for the row lock ahead of the balances, keeping them 8-byte aligned. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class ConcurrentLedger
+    @brief Balances of a fixed set of accounts that any number of threads may update at once.
+
+    Same layout idea as Ledger, but each account row is padded to whole cache lines so threads
+    settling different accounts never share a line. A row is a small spin lock followed by one
+    atomic balance per currency:
+    - Single-balance operations (deposit(), withdraw(), transfer()) are compare-and-swap loops
+      and never take a lock.
+    - settle() moves two currencies between two accounts under both row locks, taken in account
+      order, so snapshot() never sees half of a fill.
+    The table is sized at construction and never re-laid out, which is what makes lock-free
+    access safe; ids outside it throw.
+*/
+class ConcurrentLedger
+{
+    public:
+        ConcurrentLedger(std::size_t accounts, std::size_t currencies);
+        ConcurrentLedger(const ConcurrentLedger &) = delete;
+        ConcurrentLedger & operator=(const ConcurrentLedger &) = delete;
+        std::size_t getAccountCount() const;
+        std::size_t getCurrencyCount() const;
+        std::size_t getMemoryBytes() const;
+        double getBalance(AccountId account, CurrencyId currency) const;
+        double getTotal(CurrencyId currency) const;
+        void snapshot(AccountId account, std::vector<double> & out);
+        void deposit(AccountId account, CurrencyId currency, double amount);
+        bool withdraw(AccountId account, CurrencyId currency, double amount);
+        bool transfer(AccountId from, AccountId to, CurrencyId currency, double amount);
+        void settle(const OrderBookEntry & sale);
+        void settle(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount);
+        std::size_t settleAll(const std::vector<OrderBookEntry> & sales);
+    private:
+        std::atomic<std::uint32_t> & lockOf(AccountId account) const;
+        std::atomic<double> & cell(AccountId account, CurrencyId currency) const;
+        void check(AccountId account, CurrencyId currency, const char * method) const;
+        static void add(std::atomic<double> & balance, double delta);
+        static void lock(std::atomic<std::uint32_t> & l);
+        static void unlock(std::atomic<std::uint32_t> & l);
+        std::size_t nAccounts;
+        std::size_t nCurrencies;
+        std::size_t rowBytes;                   /**< Lock plus balances, rounded up to whole cache lines. */
+        std::unique_ptr<unsigned char[]> storage;
+        unsigned char * rows;                   /**< First cache-line aligned byte of storage. */
+};
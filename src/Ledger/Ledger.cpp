@@ -0,0 +1,262 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Ledger.cpp
+ * @author Edward Martinez
+ * @brief Source file for the multi-account balance ledger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Ledger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor for an empty ledger.
+ */
+Ledger::Ledger()
+: nAccounts(0),
+  stride(LEDGER_MIN_CURRENCIES)
+{
+}
+
+/**
+ * @brief Opens n new accounts with zero balances.
+ * @return Id of the first new account; the others follow consecutively.
+ */
+AccountId Ledger::openAccounts(std::size_t n)
+{
+    std::size_t first = nAccounts;
+    if(first + n >= (std::size_t)ACCOUNT_NONE)
+    {
+        throw std::runtime_error(std::string("Ledger::openAccounts - Account id space exhausted."));
+    }
+    nAccounts += n;
+    balances.resize(nAccounts * stride, 0.0);
+    return (AccountId)first;
+}
+
+/**
+ * @brief Pre-allocates room for a number of accounts and currencies.
+ */
+void Ledger::reserve(std::size_t accounts, std::size_t currencies)
+{
+    if(currencies > stride) this->relayout(currencies);
+    balances.reserve(accounts * stride);
+}
+
+/**
+ * @brief Number of accounts; every account id is below this value.
+ */
+std::size_t Ledger::getAccountCount() const
+{
+    return this->nAccounts;
+}
+
+/**
+ * @brief Number of balance columns per account.
+ */
+std::size_t Ledger::getCurrencyCount() const
+{
+    return this->stride;
+}
+
+/**
+ * @brief Bytes used by the balance table.
+ */
+std::size_t Ledger::getMemoryBytes() const
+{
+    return balances.capacity() * sizeof(double);
+}
+
+/**
+ * @brief Balance of an account in a currency; 0 for unknown accounts or currencies.
+ */
+double Ledger::getBalance(AccountId account, CurrencyId currency) const
+{
+    if((account >= nAccounts) || (currency >= stride)) return 0.0;
+    return balances[(std::size_t)account * stride + currency];
+}
+
+/**
+ * @brief Sum of a currency over every account.
+ */
+double Ledger::getTotal(CurrencyId currency) const
+{
+    double total = 0.0;
+    if(currency >= stride) return total;
+    for(std::size_t a = 0; a < nAccounts; a++) total += balances[a * stride + currency];
+    return total;
+}
+
+/**
+ * @brief Adds currency to an account.
+ * @param amount Amount to be added. Must be non-negative.
+ */
+void Ledger::deposit(AccountId account, CurrencyId currency, double amount)
+{
+    if(amount < 0)
+    {
+        throw std::runtime_error(std::string("Ledger::deposit - Received negative currency amount."));
+    }
+    this->row(account, currency)[currency] += amount;
+}
+
+/**
+ * @brief Removes currency from an account if the balance allows it.
+ * @return TRUE if the amount was removed.
+ */
+bool Ledger::withdraw(AccountId account, CurrencyId currency, double amount)
+{
+    if(amount < 0)
+    {
+        throw std::runtime_error(std::string("Ledger::withdraw - Received negative currency amount."));
+    }
+    double & balance = this->row(account, currency)[currency];
+    if(balance < amount) return false;
+    balance -= amount;
+    return true;
+}
+
+/**
+ * @brief Determines whether the order's account can pay for an ask or bid. @see Wallet::canFulfillOrder()
+ */
+bool Ledger::canFulfillOrder(const OrderBookEntry & order) const
+{
+    ProductPair pair = SymbolTable::instance().product(order._product);
+    if(OrderBookType::ask == order._OrderType) return this->getBalance(order.account, pair.base) >= order._amount;
+    if(OrderBookType::bid == order._OrderType) return this->getBalance(order.account, pair.quote) >= order._amount * order._price;
+    return false;
+}
+
+/**
+ * @brief Settles a sale produced by the matcher between its buyer and seller.
+ */
+void Ledger::settle(const OrderBookEntry & sale)
+{
+    if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) return;
+    this->settle(SymbolTable::instance().product(sale._product), sale.buyer, sale.seller, sale._price, sale._amount);
+}
+
+/**
+ * @brief Moves amount of the base currency from seller to buyer, and amount x price of the quote back.
+ *
+ * A side without an account (ACCOUNT_NONE) is the outside market and is not booked.
+ * Balances may go negative: settlement applies fills, it does not re-check them.
+ */
+void Ledger::settle(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount)
+{
+    CurrencyId top = std::max(pair.base, pair.quote);
+    double value   = amount * price;
+    //Look both rows up first so an unknown account leaves the other side untouched.
+    double * b = (ACCOUNT_NONE != buyer) ? this->row(buyer, top) : nullptr;
+    double * s = (ACCOUNT_NONE != seller) ? this->row(seller, top) : nullptr;
+    if(nullptr != b)
+    {
+        b[pair.base]  += amount;
+        b[pair.quote] -= value;
+    }
+    if(nullptr != s)
+    {
+        s[pair.base]  -= amount;
+        s[pair.quote] += value;
+    }
+}
+
+/**
+ * @brief Settles every sale of a batch.
+ * @return Number of sales that involved at least one account.
+ */
+std::size_t Ledger::settleAll(const std::vector<OrderBookEntry> & sales)
+{
+    std::size_t n = 0;
+    const std::string * product = nullptr;
+    ProductPair pair{0, 0};
+    for(const OrderBookEntry & sale : sales)
+    {
+        if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) continue;
+        //A matching run yields sales of one product, so the pair is looked up once per run.
+        if((nullptr == product) || (*product != sale._product))
+        {
+            product = &sale._product;
+            pair    = SymbolTable::instance().product(sale._product);
+        }
+        this->settle(pair, sale.buyer, sale.seller, sale._price, sale._amount);
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Makes sure an account is open and a currency column exists, creating the column (at 0) if needed.
+ *
+ * After ensure(), adjust() on accounts and currencies up to these ids never resizes the table,
+ * so different threads may adjust different balances concurrently.
+ */
+void Ledger::ensure(AccountId maxAccount, CurrencyId maxCurrency)
+{
+    this->row(maxAccount, maxCurrency);
+}
+
+/**
+ * @brief Adds a signed amount to one balance of an open account, creating the currency column if needed.
+ */
+void Ledger::adjust(AccountId account, CurrencyId currency, double delta)
+{
+    this->row(account, currency)[currency] += delta;
+}
+
+/**
+ * @brief Balance row of an open account, creating currency columns if needed.
+ */
+double * Ledger::row(AccountId account, CurrencyId maxCurrency)
+{
+    if(ACCOUNT_NONE == account)
+    {
+        throw std::runtime_error(std::string("Ledger::row - No account given."));
+    }
+    if(account >= nAccounts)
+    {
+        throw std::runtime_error(std::string("Ledger::row - Account ") + std::to_string(account) + " was never opened.");
+    }
+    if(maxCurrency >= stride) this->relayout(std::max<std::size_t>((std::size_t)maxCurrency + 1, stride + stride / 2));
+    return &balances[(std::size_t)account * stride];
+}
+
+/**
+ * @brief Widens every account row to newStride columns.
+ */
+void Ledger::relayout(std::size_t newStride)
+{
+    std::vector<double> wider(nAccounts * newStride, 0.0);
+    for(std::size_t a = 0; a < nAccounts; a++)
+    {
+        std::copy(balances.begin() + a * stride, balances.begin() + (a + 1) * stride, wider.begin() + a * newStride);
+    }
+    balances.swap(wider);
+    stride = newStride;
+}
@@ -0,0 +1,77 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Ledger.h
+ * @author Edward Martinez
+ * @brief Header file for the multi-account balance ledger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "../OrderBookLib/OrderBookLib.h"
+#include "../OrderBookLib/SymbolTable.h"
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LEDGER_MIN_CURRENCIES 4 /**< Smallest number of balance columns per account. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class Ledger
+    @brief Balances of every account in every currency, in one contiguous accounts x currencies table.
+
+    Account ids are dense indices into the table and currency ids come from SymbolTable, so a
+    balance is a single indexed load and an account costs only (currencies x 8) bytes. Accounts
+    are created by openAccounts(); deposits, fills and adjustments naming any other account id
+    are refused rather than growing the table. When a currency id beyond the current columns
+    appears the table is re-laid out with more columns, which is rare since currencies are few
+    and long-lived.
+*/
+class Ledger
+{
+    public:
+        Ledger();
+        AccountId openAccounts(std::size_t n);
+        void reserve(std::size_t accounts, std::size_t currencies);
+        std::size_t getAccountCount() const;
+        std::size_t getCurrencyCount() const;
+        std::size_t getMemoryBytes() const;
+        double getBalance(AccountId account, CurrencyId currency) const;
+        double getTotal(CurrencyId currency) const;
+        void deposit(AccountId account, CurrencyId currency, double amount);
+        bool withdraw(AccountId account, CurrencyId currency, double amount);
+        bool canFulfillOrder(const OrderBookEntry & order) const;
+        void settle(const OrderBookEntry & sale);
+        void settle(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount);
+        std::size_t settleAll(const std::vector<OrderBookEntry> & sales);
+        void ensure(AccountId maxAccount, CurrencyId maxCurrency);
+        void adjust(AccountId account, CurrencyId currency, double delta);
+    private:
+        double * row(AccountId account, CurrencyId maxCurrency);
+        void relayout(std::size_t newStride);
+        std::size_t nAccounts;
+        std::size_t stride;             /**< Balance columns per account. */
+        std::vector<double> balances;   /**< Row-major, nAccounts x stride. */
+};
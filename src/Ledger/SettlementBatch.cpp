@@ -0,0 +1,241 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SettlementBatch.cpp
+ * @author Edward Martinez
+ * @brief Source file for netted, batched settlement of fills.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "SettlementBatch.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define SETTLEMENT_MIN_SLOTS 64
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    inline std::uint64_t positionKey(AccountId account, CurrencyId currency)
+    {
+        return ((std::uint64_t)account << 32) | currency;
+    }
+
+    inline std::size_t slotOf(std::uint64_t key, std::size_t mask)
+    {
+        return (std::size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor for an empty batch.
+ */
+SettlementBatch::SettlementBatch()
+: slots(SETTLEMENT_MIN_SLOTS, 0),
+  nFills(0)
+{
+}
+
+/**
+ * @brief Adds a sale produced by the matcher. Sales without accounts are ignored.
+ */
+void SettlementBatch::add(const OrderBookEntry & sale)
+{
+    if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) return;
+    this->add(SymbolTable::instance().product(sale._product), sale.buyer, sale.seller, sale._price, sale._amount);
+}
+
+/**
+ * @brief Adds a fill: the buyer receives amount of base for amount x price of quote. @see Ledger::settle()
+ */
+void SettlementBatch::add(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount)
+{
+    double value = amount * price;
+    if(ACCOUNT_NONE != buyer)
+    {
+        this->net(buyer, pair.base, amount);
+        this->net(buyer, pair.quote, -value);
+    }
+    if(ACCOUNT_NONE != seller)
+    {
+        this->net(seller, pair.base, -amount);
+        this->net(seller, pair.quote, value);
+    }
+    nFills++;
+}
+
+/**
+ * @brief Adds every sale of a matching run.
+ * @return Number of sales that involved at least one account.
+ */
+std::size_t SettlementBatch::addAll(const std::vector<OrderBookEntry> & sales)
+{
+    std::size_t before = nFills;
+    const std::string * product = nullptr;
+    ProductPair pair{0, 0};
+    for(const OrderBookEntry & sale : sales)
+    {
+        if((ACCOUNT_NONE == sale.buyer) && (ACCOUNT_NONE == sale.seller)) continue;
+        //A matching run yields sales of one product, so the pair is looked up once per run.
+        if((nullptr == product) || (*product != sale._product))
+        {
+            product = &sale._product;
+            pair    = SymbolTable::instance().product(sale._product);
+        }
+        this->add(pair, sale.buyer, sale.seller, sale._price, sale._amount);
+    }
+    return nFills - before;
+}
+
+/**
+ * @brief Fills added since the last apply() or clear().
+ */
+std::size_t SettlementBatch::getFillCount() const
+{
+    return this->nFills;
+}
+
+/**
+ * @brief Distinct (account, currency) balances the pending fills change.
+ */
+std::size_t SettlementBatch::getPositionCount() const
+{
+    return this->positions.size();
+}
+
+/**
+ * @brief Writes every net position to the ledger, then clears the batch.
+ * @param threads Threads to spread large batches over. Each thread updates a disjoint range of accounts.
+ * @return Number of ledger updates made.
+ * @throws std::runtime_error if a fill names an account the ledger never opened; nothing is applied.
+ */
+std::size_t SettlementBatch::apply(Ledger & ledger, unsigned threads)
+{
+    std::size_t n = positions.size();
+    if(0 == n)
+    {
+        this->clear();
+        return 0;
+    }
+
+    //Check every account and create every currency up front so the ledger never resizes while threads write.
+    std::uint64_t maxKey = 0;
+    CurrencyId maxCurrency = 0;
+    for(const Position & p : positions)
+    {
+        maxKey      = std::max(maxKey, p.key);
+        maxCurrency = std::max(maxCurrency, (CurrencyId)(p.key & 0xFFFFFFFFu));
+    }
+    ledger.ensure((AccountId)(maxKey >> 32), maxCurrency);
+
+    if((threads <= 1) || (n < SETTLEMENT_PARALLEL_MIN))
+    {
+        applyRange(ledger, positions.data(), positions.data() + n);
+    }
+    else
+    {
+        //Sort by account so each thread gets whole accounts, then cut at account boundaries.
+        std::sort(positions.begin(), positions.end(), [](const Position & a, const Position & b){ return a.key < b.key; });
+        std::vector<std::thread> workers;
+        std::size_t begin = 0;
+        for(unsigned t = 0; (t < threads) && (begin < n); t++)
+        {
+            std::size_t end = (t + 1 == threads) ? n : std::max(begin, n * (t + 1) / threads);
+            while((end < n) && (end > begin) && ((positions[end].key >> 32) == (positions[end - 1].key >> 32))) end++;
+            if(end > begin) workers.emplace_back(&SettlementBatch::applyRange, std::ref(ledger), positions.data() + begin, positions.data() + end);
+            begin = end;
+        }
+        for(std::thread & w : workers) w.join();
+    }
+    this->clear();
+    return n;
+}
+
+/**
+ * @brief Discards the pending fills. Only the slots in use are reset, so a table enlarged by one
+ *        busy tick does not slow down the following ones.
+ */
+void SettlementBatch::clear()
+{
+    for(const Position & p : positions) slots[p.slot] = 0;
+    positions.clear();
+    nFills = 0;
+}
+
+/**
+ * @brief Adds delta to the net position of a balance, creating the position if needed.
+ */
+void SettlementBatch::net(AccountId account, CurrencyId currency, double delta)
+{
+    std::uint64_t key = positionKey(account, currency);
+    std::size_t mask  = slots.size() - 1;
+    for(std::size_t s = slotOf(key, mask); ; s = (s + 1) & mask)
+    {
+        std::uint32_t idx = slots[s];
+        if(0 == idx)
+        {
+            positions.push_back(Position{key, delta, (std::uint32_t)s});
+            slots[s] = (std::uint32_t)positions.size();
+            if(2 * positions.size() > slots.size()) this->grow();
+            return;
+        }
+        if(positions[idx - 1].key == key)
+        {
+            positions[idx - 1].delta += delta;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Doubles the hash table and re-inserts every position.
+ */
+void SettlementBatch::grow()
+{
+    slots.assign(slots.size() * 2, 0);
+    std::size_t mask = slots.size() - 1;
+    for(std::size_t i = 0; i < positions.size(); i++)
+    {
+        std::size_t s = slotOf(positions[i].key, mask);
+        while(0 != slots[s]) s = (s + 1) & mask;
+        slots[s] = (std::uint32_t)(i + 1);
+        positions[i].slot = (std::uint32_t)s;
+    }
+}
+
+/**
+ * @brief Applies a range of net positions to the ledger.
+ */
+void SettlementBatch::applyRange(Ledger & ledger, const Position * first, const Position * last)
+{
+    for(const Position * p = first; p != last; p++)
+    {
+        ledger.adjust((AccountId)(p->key >> 32), (CurrencyId)(p->key & 0xFFFFFFFFu), p->delta);
+    }
+}
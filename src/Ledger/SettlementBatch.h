@@ -0,0 +1,75 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SettlementBatch.h
+ * @author Edward Martinez
+ * @brief Header file for netted, batched settlement of fills.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Ledger.h"
+/** @cond STDINCLUDES */
+#include <cstdint>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define SETTLEMENT_PARALLEL_MIN 16384 /**< Fewest net positions worth splitting across threads. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class SettlementBatch
+    @brief Collects the fills of a tick and settles them as one update per (account, currency).
+
+    Each fill adds its four balance changes (buyer and seller, base and quote) to a running net
+    position in a flat open-addressing table, so an account filling hundreds of times in a tick
+    costs hundreds of in-cache additions but only one ledger update per currency it touched.
+    apply() writes the net positions to a Ledger, optionally splitting them across threads by
+    account range, and empties the batch for the next tick.
+*/
+class SettlementBatch
+{
+    public:
+        SettlementBatch();
+        void add(const OrderBookEntry & sale);
+        void add(ProductPair pair, AccountId buyer, AccountId seller, double price, double amount);
+        std::size_t addAll(const std::vector<OrderBookEntry> & sales);
+        std::size_t getFillCount() const;
+        std::size_t getPositionCount() const;
+        std::size_t apply(Ledger & ledger, unsigned threads = 1);
+        void clear();
+    private:
+        /*! Net change of one balance. */
+        struct Position
+        {
+            std::uint64_t key;  /**< account << 32 | currency */
+            double delta;
+            std::uint32_t slot; /**< Hash slot pointing at this position, cleared by clear(). */
+        };
+        void net(AccountId account, CurrencyId currency, double delta);
+        void grow();
+        static void applyRange(Ledger & ledger, const Position * first, const Position * last);
+        std::vector<Position> positions;    /**< Distinct balances touched, in first-touch order. */
+        std::vector<std::uint32_t> slots;   /**< Hash slots holding position index + 1, 0 if empty. */
+        std::size_t nFills;
+};
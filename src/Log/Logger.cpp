@@ -0,0 +1,421 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Logger.cpp
+ * @author Edward Martinez
+ * @brief Source file for the asynchronous engine logger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LOG_RING_MASK (LOG_RING_RECORDS - 1)
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /*! Releases a thread's ring when the thread exits. */
+    struct RingLease
+    {
+        LogRing * ring = nullptr;
+        ~RingLease()
+        {
+            if(nullptr != ring) ring->owned.store(false, std::memory_order_release);
+        }
+    };
+
+    const double pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+    /**
+     * @brief Formats a double exactly as printf "%g" does, without printf, for the plain
+     *        notation range 1e-4 <= |v| < 1e6 that prices and amounts fall in.
+     * @return Length written to buf, or 0 if v is outside that range or its sixth significant
+     *         digit is too close to a rounding tie to decide here; use snprintf then.
+     */
+    int formatG(double v, char * buf)
+    {
+        double a = std::fabs(v);
+        if(!(a >= 1e-4) || !(a < 999999.5)) return 0;
+        //Six significant digits: scale until the integer part has six digits, e being the exponent.
+        int e = 5;
+        double scaled = a;
+        while((scaled < 100000.0) && (e > -4)) scaled = a * pow10[5 - --e];
+        if(scaled < 99999.5) return 0;
+        double r = std::floor(scaled + 0.5);
+        double frac = scaled + 0.5 - r;
+        if((frac < 1e-6) || (frac > 1.0 - 1e-6)) return 0; //Within rounding error of a tie.
+        if(r >= 1000000.0)
+        {
+            //Rounded up to the next power of ten.
+            r = 100000.0;
+            if(++e > 5) return 0;
+        }
+        std::uint32_t digits = (std::uint32_t)r;
+        int decimals = 5 - e;
+        std::uint32_t unit = (std::uint32_t)pow10[decimals];
+        std::uint32_t ip = digits / unit;
+        std::uint32_t fp = digits % unit;
+        char * p = buf;
+        if(v < 0) *p++ = '-';
+        char tmp[10];
+        int n = 0;
+        do { tmp[n++] = (char)('0' + ip % 10); ip /= 10; } while(0 != ip);
+        while(n > 0) *p++ = tmp[--n];
+        if(0 != fp)
+        {
+            while(0 == fp % 10) { fp /= 10; decimals--; }
+            *p++ = '.';
+            for(int i = decimals - 1; i >= 0; i--) { p[i] = (char)('0' + fp % 10); fp /= 10; }
+            p += decimals;
+        }
+        return (int)(p - buf);
+    }
+
+    /**
+     * @brief Appends one argument in its natural text form.
+     */
+    void appendArg(std::string & out, const LogRecord & r, std::size_t i)
+    {
+        char buf[32];
+        int n = 0;
+        switch(r.kinds[i])
+        {
+            case LogArgKind::i64:  n = std::snprintf(buf, sizeof(buf), "%lld", (long long)r.args[i].i); break;
+            case LogArgKind::u64:  n = std::snprintf(buf, sizeof(buf), "%llu", (unsigned long long)r.args[i].u); break;
+            case LogArgKind::f64:
+                n = formatG(r.args[i].f, buf);
+                if(0 == n) n = std::snprintf(buf, sizeof(buf), "%g", r.args[i].f);
+                break;
+            case LogArgKind::text: out += &r.text[r.args[i].textOffset]; return;
+        }
+        out.append(buf, (std::size_t)std::max(n, 0));
+    }
+
+    /**
+     * @brief Appends a record's text, each "{}" of the format replaced by the next argument.
+     */
+    void appendRecord(std::string & out, const LogRecord & r)
+    {
+        std::size_t arg = 0;
+        const char * literal = r.format;
+        const char * p = r.format;
+        for(; '\0' != *p; p++)
+        {
+            if(('{' == p[0]) && ('}' == p[1]) && (arg < r.nArgs))
+            {
+                out.append(literal, (std::size_t)(p - literal));
+                appendArg(out, r, arg++);
+                literal = ++p + 1;
+            }
+        }
+        out.append(literal, (std::size_t)(p - literal));
+        out += '\n';
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Process-wide logger. The writer thread starts with it.
+ */
+Logger & Logger::instance()
+{
+    static Logger logger;
+    return logger;
+}
+
+/**
+ * @brief Constructor. Logs go to std::cout until setSink() or open() is called.
+ */
+Logger::Logger()
+: sink(&std::cout)
+{
+    writer = std::thread(&Logger::run, this);
+}
+
+/**
+ * @brief Destructor. Stops the writer thread after writing every pending record.
+ */
+Logger::~Logger()
+{
+    {
+        std::lock_guard<std::mutex> guard(wakeLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    writer.join();
+    this->flush();
+}
+
+/**
+ * @brief Sends later output to another stream, after writing what is pending to the current one.
+ * @param os Stream that outlives its use as the sink; nullptr restores std::cout.
+ */
+void Logger::setSink(std::ostream * os)
+{
+    this->flush();
+    std::lock_guard<std::mutex> guard(writeLock);
+    sink = (nullptr == os) ? &std::cout : os;
+    if(file.is_open() && (sink != &file)) file.close();
+}
+
+/**
+ * @brief Sends later output to a file, truncating it.
+ * @return TRUE if the file could be opened; otherwise the sink is unchanged.
+ */
+bool Logger::open(const std::string & path)
+{
+    this->flush();
+    std::lock_guard<std::mutex> guard(writeLock);
+    if(file.is_open()) file.close();
+    file.open(path, std::ios::trunc);
+    if(!file) return false;
+    sink = &file;
+    return true;
+}
+
+/**
+ * @brief Writes every record logged so far, by any thread, and flushes the sink.
+ */
+void Logger::flush()
+{
+    std::lock_guard<std::mutex> guard(writeLock);
+    this->drain();
+    sink->flush();
+}
+
+/**
+ * @brief Number of records written to a sink so far.
+ */
+std::uint64_t Logger::getRecordCount() const
+{
+    return written.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Formats one record as it is written to the sink, without the trailing newline.
+ */
+std::string Logger::format(const LogRecord & r)
+{
+    std::string s;
+    appendRecord(s, r);
+    s.pop_back();
+    return s;
+}
+
+/**
+ * @brief Number of rings, owned or released, the logger has created.
+ */
+std::size_t Logger::getRingCount() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return rings.size();
+}
+
+/**
+ * @brief The calling thread's ring, whatever write() instantiation asks for it.
+ */
+LogRing & Logger::localRing()
+{
+    thread_local RingLease lease;
+    if(nullptr == lease.ring) lease.ring = &instance().registerThread();
+    return *lease.ring;
+}
+
+/**
+ * @brief Gives the calling thread a ring: one released by an exited thread, or a new one.
+ *
+ * A taken-over ring may still hold records of its previous thread; they are older than
+ * anything the new thread logs, so the ring stays in sequence order.
+ */
+LogRing & Logger::registerThread()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for(std::unique_ptr<LogRing> & ring : rings)
+    {
+        bool released = false;
+        if(ring->owned.compare_exchange_strong(released, true, std::memory_order_acquire)) return *ring;
+    }
+    rings.emplace_back(new LogRing());
+    return *rings.back();
+}
+
+/**
+ * @brief Next free slot of a ring, waiting for the writer while the ring is full.
+ */
+LogRecord & Logger::claim(LogRing & ring)
+{
+    std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+    while(head - ring.tail.load(std::memory_order_acquire) >= LOG_RING_RECORDS)
+    {
+        this->requestDrain();
+        std::this_thread::yield();
+    }
+    return ring.records[head & LOG_RING_MASK];
+}
+
+/**
+ * @brief Asks the writer to drain now instead of at its next interval.
+ */
+void Logger::requestDrain()
+{
+    if(drainRequested.exchange(true, std::memory_order_acq_rel)) return;
+    std::lock_guard<std::mutex> guard(wakeLock);
+    wake.notify_one();
+}
+
+/**
+ * @brief Writer loop: drain every LOG_FLUSH_MS, or sooner when a filling ring asks for it.
+ */
+void Logger::run()
+{
+    while(!stopping)
+    {
+        {
+            std::unique_lock<std::mutex> guard(wakeLock);
+            wake.wait_for(guard, std::chrono::milliseconds(LOG_FLUSH_MS),
+                          [this](){ return stopping.load() || drainRequested.load(); });
+        }
+        drainRequested = false;
+        std::lock_guard<std::mutex> guard(writeLock);
+        if(this->drain() > 0) sink->flush();
+    }
+}
+
+/**
+ * @brief Formats and writes every published record. Caller holds writeLock.
+ *
+ * When a single thread has logged since the last drain, its records are formatted straight
+ * from its ring; records of several threads are copied out and merged by sequence first.
+ * @return Number of records written.
+ */
+std::size_t Logger::drain()
+{
+    batch.clear();
+    out.clear();
+    std::size_t n = 0;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        LogRing * busy = nullptr;
+        std::size_t nBusy = 0;
+        for(std::unique_ptr<LogRing> & ring : rings)
+        {
+            if(ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_relaxed)) continue;
+            busy = ring.get();
+            nBusy++;
+        }
+        if(1 == nBusy)
+        {
+            std::uint64_t tail = busy->tail.load(std::memory_order_relaxed);
+            std::uint64_t head = busy->head.load(std::memory_order_acquire);
+            for(std::uint64_t i = tail; i != head; i++) appendRecord(out, busy->records[i & LOG_RING_MASK]);
+            busy->tail.store(head, std::memory_order_release);
+            n = (std::size_t)(head - tail);
+        }
+        else if(nBusy > 1)
+        {
+            for(std::unique_ptr<LogRing> & ring : rings)
+            {
+                std::uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+                std::uint64_t head = ring->head.load(std::memory_order_acquire);
+                for(std::uint64_t i = tail; i != head; i++) batch.push_back(ring->records[i & LOG_RING_MASK]);
+                ring->tail.store(head, std::memory_order_release);
+            }
+        }
+    }
+    if(!batch.empty())
+    {
+        //Each ring is in order already; only records from several threads need merging.
+        auto bySequence = [](const LogRecord & a, const LogRecord & b){ return a.sequence < b.sequence; };
+        if(!std::is_sorted(batch.begin(), batch.end(), bySequence)) std::sort(batch.begin(), batch.end(), bySequence);
+        for(const LogRecord & r : batch) appendRecord(out, r);
+        n = batch.size();
+    }
+    if(0 == n) return 0;
+    sink->write(out.data(), (std::streamsize)out.size());
+    written.fetch_add(n, std::memory_order_relaxed);
+    return n;
+}
+
+/**
+ * @brief Captures a signed integer argument.
+ */
+void Logger::put(LogRecord & r, long long v)
+{
+    if(r.nArgs >= LOG_MAX_ARGS) return;
+    r.kinds[r.nArgs]  = LogArgKind::i64;
+    r.args[r.nArgs++].i = v;
+}
+
+/**
+ * @brief Captures an unsigned integer argument.
+ */
+void Logger::put(LogRecord & r, unsigned long long v)
+{
+    if(r.nArgs >= LOG_MAX_ARGS) return;
+    r.kinds[r.nArgs]  = LogArgKind::u64;
+    r.args[r.nArgs++].u = v;
+}
+
+/**
+ * @brief Captures a floating point argument.
+ */
+void Logger::put(LogRecord & r, double v)
+{
+    if(r.nArgs >= LOG_MAX_ARGS) return;
+    r.kinds[r.nArgs]  = LogArgKind::f64;
+    r.args[r.nArgs++].f = v;
+}
+
+/**
+ * @brief Copies a string argument into the record, truncated to the space left.
+ */
+void Logger::put(LogRecord & r, const char * v)
+{
+    if((r.nArgs >= LOG_MAX_ARGS) || (r.textUsed >= LOG_TEXT_BYTES)) return;
+    std::size_t room = LOG_TEXT_BYTES - r.textUsed - 1;
+    std::size_t n = std::min(std::strlen(v), room);
+    std::memcpy(&r.text[r.textUsed], v, n);
+    r.text[r.textUsed + n] = '\0';
+    r.kinds[r.nArgs] = LogArgKind::text;
+    r.args[r.nArgs++].textOffset = r.textUsed;
+    r.textUsed = (std::uint8_t)(r.textUsed + n + 1);
+}
+
+/**
+ * @brief Copies a string argument into the record. @see put(LogRecord&, const char*)
+ */
+void Logger::put(LogRecord & r, const std::string & v)
+{
+    put(r, v.c_str());
+}
@@ -0,0 +1,191 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file Logger.h
+ * @author Edward Martinez
+ * @brief Header file for the asynchronous engine logger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Records below MRX_LOG_LEVEL (set with -DMERKLEREX_LOG_LEVEL=N, default 1 = info) are removed
+ * at compile time, arguments included.
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE  4
+
+#ifndef MRX_LOG_LEVEL
+#define MRX_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_MAX_ARGS     6    /**< Arguments kept per record; later ones are dropped. */
+#define LOG_TEXT_BYTES   48   /**< Room for copied string arguments, which are truncated to fit. */
+#define LOG_RING_RECORDS 4096 /**< Records per thread ring, a power of two. */
+#define LOG_FLUSH_MS     20   /**< Longest time a record waits before the writer formats it. */
+
+/** Logs "{}"-formatted text at a level; compiled out when the level is below MRX_LOG_LEVEL. */
+#define MRX_LOG(level, ...) do { if((level) >= MRX_LOG_LEVEL) Logger::write((level), __VA_ARGS__); } while(0)
+#define MRX_LOG_DEBUG(...) MRX_LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define MRX_LOG_INFO(...)  MRX_LOG(LOG_LEVEL_INFO,  __VA_ARGS__)
+#define MRX_LOG_WARN(...)  MRX_LOG(LOG_LEVEL_WARN,  __VA_ARGS__)
+#define MRX_LOG_ERROR(...) MRX_LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** Type of each captured argument. */
+enum class LogArgKind:std::uint8_t {i64, u64, f64, text};
+
+/*! @struct LogRecord
+    @brief One log call, captured as fixed-size binary data (128 bytes) and formatted later.
+
+    The format must be a string literal: only its pointer is stored. String arguments are copied
+    into text, so they may be temporaries.
+*/
+struct LogRecord
+{
+    std::uint64_t sequence;             /**< Global call order, used to merge records of several threads. */
+    const char * format;
+    std::uint8_t level;
+    std::uint8_t nArgs;
+    std::uint8_t textUsed;
+    LogArgKind kinds[LOG_MAX_ARGS];
+    union
+    {
+        std::int64_t i;
+        std::uint64_t u;
+        double f;
+        std::uint8_t textOffset;
+    } args[LOG_MAX_ARGS];
+    char text[LOG_TEXT_BYTES];
+};
+static_assert(sizeof(LogRecord) == 128, "LogRecord must fill exactly two cache lines.");
+
+/*! @struct LogRing
+    @brief Single-producer single-consumer ring of records owned by one logging thread.
+
+    The owning thread fills a slot and publishes it by advancing head; the writer thread reads up
+    to head and releases the slots by advancing tail. Head and tail sit on separate cache lines.
+    When its thread exits the ring is released, and the next thread that logs takes it over.
+*/
+struct LogRing
+{
+    std::atomic<bool> owned{true};  /**< FALSE once the owning thread has exited. */
+    std::atomic<std::uint64_t> head{0};
+    char padHead[64 - sizeof(std::atomic<std::uint64_t>) - sizeof(std::atomic<bool>)];
+    std::atomic<std::uint64_t> tail{0};
+    char padTail[64 - sizeof(std::atomic<std::uint64_t>)];
+    LogRecord records[LOG_RING_RECORDS];
+};
+
+/*! @class Logger
+    @brief Process-wide asynchronous logger.
+
+    write() copies its arguments into the calling thread's ring without locking or formatting;
+    a background writer thread formats the records, in call order across threads, and writes them
+    to the sink in large blocks. A full ring makes the caller wait for the writer rather than
+    lose records. Call flush() where log output must appear before what follows (e.g. before
+    a menu is printed).
+*/
+class Logger
+{
+    public:
+        static Logger & instance();
+        ~Logger();
+        Logger(const Logger &) = delete;
+        Logger & operator=(const Logger &) = delete;
+
+        template<typename... Args>
+        static void write(int level, const char * format, const Args &... args)
+        {
+            LogRing & local = localRing();
+            LogRecord & r = instance().claim(local);
+            r.sequence = instance().sequence.fetch_add(1, std::memory_order_relaxed);
+            r.format   = format;
+            r.level    = (std::uint8_t)level;
+            r.nArgs    = 0;
+            r.textUsed = 0;
+            int expand[] = {0, (put(r, args), 0)...};
+            (void)expand;
+            std::uint64_t head = local.head.load(std::memory_order_relaxed) + 1;
+            local.head.store(head, std::memory_order_release);
+            if((head & (LOG_RING_RECORDS / 2 - 1)) == 0) instance().requestDrain(); //Wake the writer before the ring fills.
+        }
+
+        void setSink(std::ostream * os);
+        bool open(const std::string & path);
+        void flush();
+        std::uint64_t getRecordCount() const;
+        std::size_t getRingCount() const;
+        static std::string format(const LogRecord & r);
+    private:
+        Logger();
+        static LogRing & localRing();
+        LogRing & registerThread();
+        LogRecord & claim(LogRing & ring);
+        void requestDrain();
+        void run();
+        std::size_t drain();
+
+        static void put(LogRecord & r, long long v);
+        static void put(LogRecord & r, unsigned long long v);
+        static void put(LogRecord & r, double v);
+        static void put(LogRecord & r, const char * v);
+        static void put(LogRecord & r, const std::string & v);
+        static void put(LogRecord & r, int v)           { put(r, (long long)v); }
+        static void put(LogRecord & r, long v)          { put(r, (long long)v); }
+        static void put(LogRecord & r, unsigned v)      { put(r, (unsigned long long)v); }
+        static void put(LogRecord & r, unsigned long v) { put(r, (unsigned long long)v); }
+        static void put(LogRecord & r, float v)         { put(r, (double)v); }
+        static void put(LogRecord & r, bool v)          { put(r, v ? "true" : "false"); }
+
+        mutable std::mutex lock;                /**< Guards the ring list. */
+        std::vector<std::unique_ptr<LogRing>> rings;
+        std::mutex writeLock;                   /**< Held while records are drained and written. */
+        std::ostream * sink;
+        std::ofstream file;
+        std::vector<LogRecord> batch;
+        std::string out;
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint64_t> written{0};
+        std::mutex wakeLock;
+        std::condition_variable wake;
+        std::atomic<bool> stopping{false};
+        std::atomic<bool> drainRequested{false};
+        std::thread writer;
+};
@@ -0,0 +1,447 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MarketDataFeed.cpp
+ * @author Edward Martinez
+ * @brief Source file for the shared-memory market data feed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "MarketDataFeed.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Shared memory object name with the leading '/' POSIX asks for.
+     */
+    std::string shmName(const std::string & name)
+    {
+        return ('/' == name[0]) ? name : "/" + name;
+    }
+
+    std::size_t mapSize(std::size_t slots)
+    {
+        return sizeof(FeedHeader) + slots * sizeof(FeedSlot);
+    }
+
+    FeedMessage makeMessage(FeedMsgType type, FeedSide side, std::uint16_t product, std::int64_t timeMicros)
+    {
+        FeedMessage m;
+        std::memset(&m, 0, sizeof(m));
+        m.type       = type;
+        m.side       = side;
+        m.product    = product;
+        m.timeMicros = timeMicros;
+        return m;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Destructor. Removes the feed.
+ */
+MarketDataPublisher::~MarketDataPublisher()
+{
+    this->close();
+}
+
+/**
+ * @brief Creates the feed, replacing any earlier feed of the same name.
+ * @param name Shared memory object name, e.g. "merklerex" (appears as /dev/shm/merklerex).
+ * @param ringSlots Ring size in messages, rounded up to a power of two.
+ * @param depth Price levels per side covered by L2 deltas.
+ */
+void MarketDataPublisher::open(const std::string & name, std::size_t ringSlots, std::size_t depth)
+{
+    this->close();
+    if(name.empty()) throw std::runtime_error(std::string("MarketDataPublisher::open - Empty feed name."));
+    std::size_t n = 1;
+    while(n < std::max<std::size_t>(ringSlots, 2)) n <<= 1;
+
+    std::string path = shmName(name);
+    ::shm_unlink(path.c_str());
+    int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if(fd < 0) throw std::runtime_error(std::string("MarketDataPublisher::open - Cannot create feed ") + path);
+    std::size_t bytes = mapSize(n);
+    void * map = MAP_FAILED;
+    if(0 == ::ftruncate(fd, (off_t)bytes)) map = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(MAP_FAILED == map)
+    {
+        ::shm_unlink(path.c_str());
+        throw std::runtime_error(std::string("MarketDataPublisher::open - Cannot map feed ") + path);
+    }
+
+    //The new object is zero-filled, which is the initial state of every atomic in it.
+    header = static_cast<FeedHeader *>(map);
+    slots  = reinterpret_cast<FeedSlot *>(static_cast<char *>(map) + sizeof(FeedHeader));
+    header->slots     = (std::uint32_t)n;
+    header->slotBytes = (std::uint32_t)sizeof(FeedSlot);
+    header->magic.store(FEED_MAGIC, std::memory_order_release);
+
+    this->name     = path;
+    this->mapBytes = bytes;
+    this->mask     = n - 1;
+    this->next     = 0;
+    this->depth    = std::max<std::size_t>(depth, 1);
+}
+
+/**
+ * @brief Unmaps and removes the feed. Readers that have it mapped keep what was published.
+ */
+void MarketDataPublisher::close()
+{
+    if(nullptr == header) return;
+    ::munmap(header, mapBytes);
+    ::shm_unlink(name.c_str());
+    header = nullptr;
+    slots  = nullptr;
+    productIds.clear();
+    books.clear();
+}
+
+/**
+ * @brief TRUE once open() succeeded.
+ */
+bool MarketDataPublisher::isOpen() const
+{
+    return nullptr != header;
+}
+
+/**
+ * @brief Appends a message to the ring, overwriting the oldest one once the ring is full.
+ * @param message Its sequence is set to the message's position in the feed.
+ */
+void MarketDataPublisher::publish(FeedMessage & message)
+{
+    if(nullptr == header) return;
+    message.sequence = next;
+    std::uint64_t words[FEED_MESSAGE_WORDS];
+    std::memcpy(words, &message, sizeof(words));
+
+    FeedSlot & slot = slots[next & mask];
+    slot.version.store(2 * next + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for(std::size_t i = 0; i < FEED_MESSAGE_WORDS; i++) slot.words[i].store(words[i], std::memory_order_relaxed);
+    slot.version.store(2 * next + 2, std::memory_order_release);
+    next++;
+    header->published.store(next, std::memory_order_release);
+}
+
+/**
+ * @brief Announces the start of a timeframe.
+ */
+void MarketDataPublisher::publishClock(std::int64_t timeMicros)
+{
+    FeedMessage m = makeMessage(FeedMsgType::clock, FeedSide::bid, 0, timeMicros);
+    this->publish(m);
+}
+
+/**
+ * @brief Publishes how each product's book changed since the previous frame: L2 deltas, then the top of book if it moved.
+ *
+ * One pass over the frame collects the price and amount of every ask and bid; no entry is copied.
+ */
+void MarketDataPublisher::publishBooks(const OrderBookFrame & frame, std::int64_t timeMicros)
+{
+    if(nullptr == header) return;
+    for(ProductBook & b : books)
+    {
+        b.orders[0].clear();
+        b.orders[1].clear();
+    }
+    const std::string * last = nullptr;
+    std::uint16_t id = FEED_MAX_PRODUCTS;
+    for(const OrderBookEntry & e : frame.orders)
+    {
+        if((OrderBookType::bid != e._OrderType) && (OrderBookType::ask != e._OrderType)) continue;
+        //Entries of a product tend to be adjacent, so try the previous product first.
+        if((nullptr == last) || (*last != e._product))
+        {
+            last = &e._product;
+            id   = this->productIndex(e._product);
+        }
+        if(id >= FEED_MAX_PRODUCTS) continue;
+        FeedSide side = (OrderBookType::bid == e._OrderType) ? FeedSide::bid : FeedSide::ask;
+        books[id].orders[(std::size_t)side].emplace_back(e._price, e._amount);
+    }
+
+    for(std::uint16_t p = 0; p < books.size(); p++)
+    {
+        this->publishLevels(p, FeedSide::bid, timeMicros);
+        this->publishLevels(p, FeedSide::ask, timeMicros);
+
+        ProductBook & b = books[p];
+        const std::vector<std::pair<double, double>> & bids = b.levels[(std::size_t)FeedSide::bid];
+        const std::vector<std::pair<double, double>> & asks = b.levels[(std::size_t)FeedSide::ask];
+        double top[4] = {bids.empty() ? 0.0 : bids[0].first, bids.empty() ? 0.0 : bids[0].second,
+                         asks.empty() ? 0.0 : asks[0].first, asks.empty() ? 0.0 : asks[0].second};
+        if(std::equal(top, top + 4, b.top)) continue;
+        std::copy(top, top + 4, b.top);
+
+        FeedMessage m = makeMessage(FeedMsgType::topOfBook, FeedSide::bid, p, timeMicros);
+        m.price     = top[0];
+        m.amount    = top[1];
+        m.askPrice  = top[2];
+        m.askAmount = top[3];
+        this->publish(m);
+    }
+}
+
+/**
+ * @brief Publishes the sales matching produced for a product.
+ */
+void MarketDataPublisher::publishTrades(const std::string & product, const std::vector<OrderBookEntry> & sales, std::int64_t timeMicros)
+{
+    if((nullptr == header) || sales.empty()) return;
+    std::uint16_t id = this->productIndex(product);
+    if(id >= FEED_MAX_PRODUCTS) return;
+    for(const OrderBookEntry & sale : sales)
+    {
+        FeedSide side = (OrderBookType::bidsale == sale._OrderType) ? FeedSide::bid : FeedSide::ask;
+        FeedMessage m = makeMessage(FeedMsgType::trade, side, id, timeMicros);
+        m.price  = sale._price;
+        m.amount = sale._amount;
+        this->publish(m);
+    }
+}
+
+/**
+ * @brief Messages published since open().
+ */
+std::uint64_t MarketDataPublisher::getPublished() const
+{
+    return this->next;
+}
+
+/**
+ * @brief Index of a product in the feed's product table, adding it on first use.
+ * @return FEED_MAX_PRODUCTS if the table is full.
+ */
+std::uint16_t MarketDataPublisher::productIndex(const std::string & product)
+{
+    auto it = productIds.find(product);
+    if(productIds.end() != it) return it->second;
+
+    std::uint32_t id = header->productCount.load(std::memory_order_relaxed);
+    if(id >= FEED_MAX_PRODUCTS)
+    {
+        MRX_LOG_WARN("MarketDataPublisher::productIndex - Product table full, not publishing {}.", product);
+        productIds[product] = FEED_MAX_PRODUCTS;
+        return FEED_MAX_PRODUCTS;
+    }
+    std::strncpy(header->products[id], product.c_str(), FEED_PRODUCT_BYTES - 1);
+    header->productCount.store(id + 1, std::memory_order_release);
+    productIds[product] = (std::uint16_t)id;
+    books.resize(id + 1);
+    return (std::uint16_t)id;
+}
+
+/**
+ * @brief Publishes the level changes of one side of a product and remembers the new levels.
+ */
+void MarketDataPublisher::publishLevels(std::uint16_t product, FeedSide side, std::int64_t timeMicros)
+{
+    std::vector<std::pair<double, double>> & orders = books[product].orders[(std::size_t)side];
+    std::vector<std::pair<double, double>> & last = books[product].levels[(std::size_t)side];
+    if(FeedSide::bid == side) std::sort(orders.begin(), orders.end(), std::greater<std::pair<double, double>>());
+    else                      std::sort(orders.begin(), orders.end());
+
+    //Sum equal prices, keeping the best depth levels.
+    scratch.clear();
+    for(const std::pair<double, double> & o : orders)
+    {
+        if(!scratch.empty() && (scratch.back().first == o.first))
+        {
+            scratch.back().second += o.second;
+            continue;
+        }
+        if(scratch.size() == depth) break;
+        scratch.push_back(o);
+    }
+
+    FeedMessage m = makeMessage(FeedMsgType::level, side, product, timeMicros);
+    for(const std::pair<double, double> & old : last)
+    {
+        auto same = [&old](const std::pair<double, double> & l){ return l.first == old.first; };
+        if(std::none_of(scratch.begin(), scratch.end(), same))
+        {
+            m.price  = old.first;
+            m.amount = 0.0;
+            this->publish(m);
+        }
+    }
+    for(const std::pair<double, double> & level : scratch)
+    {
+        auto same = [&level](const std::pair<double, double> & l){ return l.first == level.first; };
+        auto old = std::find_if(last.begin(), last.end(), same);
+        if((last.end() != old) && (old->second == level.second)) continue;
+        m.price  = level.first;
+        m.amount = level.second;
+        this->publish(m);
+    }
+    last.swap(scratch);
+}
+
+/**
+ * @brief Destructor.
+ */
+MarketDataReader::~MarketDataReader()
+{
+    this->close();
+}
+
+/**
+ * @brief Maps a feed for reading.
+ * @param name Name given to MarketDataPublisher::open().
+ * @param fromOldest Start at the oldest message still in the ring instead of the next one published.
+ */
+void MarketDataReader::open(const std::string & name, bool fromOldest)
+{
+    this->close();
+    std::string path = shmName(name);
+    int fd = ::shm_open(path.c_str(), O_RDONLY, 0);
+    if(fd < 0) throw std::runtime_error(std::string("MarketDataReader::open - No feed named ") + path);
+    struct stat st;
+    void * map = MAP_FAILED;
+    if((0 == ::fstat(fd, &st)) && ((std::size_t)st.st_size >= sizeof(FeedHeader)))
+    {
+        map = ::mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if(MAP_FAILED == map) throw std::runtime_error(std::string("MarketDataReader::open - Cannot map feed ") + path);
+
+    const FeedHeader * h = static_cast<const FeedHeader *>(map);
+    bool valid = (FEED_MAGIC == h->magic.load(std::memory_order_acquire)) && (sizeof(FeedSlot) == h->slotBytes)
+                 && (mapSize(h->slots) <= (std::size_t)st.st_size);
+    if(!valid)
+    {
+        ::munmap(map, (std::size_t)st.st_size);
+        throw std::runtime_error(std::string("MarketDataReader::open - Not a market data feed: ") + path);
+    }
+    header   = h;
+    slots    = reinterpret_cast<const FeedSlot *>(static_cast<const char *>(map) + sizeof(FeedHeader));
+    mapBytes = (std::size_t)st.st_size;
+    mask     = h->slots - 1;
+
+    std::uint64_t published = h->published.load(std::memory_order_acquire);
+    position = (fromOldest && (published > h->slots)) ? published - h->slots : (fromOldest ? 0 : published);
+    received = 0;
+    lost     = 0;
+}
+
+/**
+ * @brief Unmaps the feed.
+ */
+void MarketDataReader::close()
+{
+    if(nullptr == header) return;
+    ::munmap(const_cast<FeedHeader *>(header), mapBytes);
+    header = nullptr;
+    slots  = nullptr;
+}
+
+/**
+ * @brief Reads the next message, if one has been published.
+ *
+ * When the writer has lapped the reader, the reader skips to the middle of the ring and counts
+ * the messages it missed in getLost(); message sequences show exactly where the gap is.
+ * @return FALSE if the reader has caught up with the writer.
+ */
+bool MarketDataReader::next(FeedMessage & message)
+{
+    if(nullptr == header) return false;
+    while(true)
+    {
+        const FeedSlot & slot = slots[position & mask];
+        std::uint64_t want = 2 * position + 2;
+        std::uint64_t before = slot.version.load(std::memory_order_acquire);
+        if(before < want) return false;         //Not published yet, or being written.
+        if(before == want)
+        {
+            std::uint64_t words[FEED_MESSAGE_WORDS];
+            for(std::size_t i = 0; i < FEED_MESSAGE_WORDS; i++) words[i] = slot.words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(slot.version.load(std::memory_order_relaxed) == want)
+            {
+                std::memcpy(&message, words, sizeof(words));
+                position++;
+                received++;
+                return true;
+            }
+        }
+        //Overwritten while or before it was read.
+        std::uint64_t published = header->published.load(std::memory_order_acquire);
+        std::uint64_t resume = published - std::min<std::uint64_t>(published, (mask + 1) / 2);
+        resume = std::max(resume, position + 1);
+        lost += resume - position;
+        position = resume;
+    }
+}
+
+/**
+ * @brief Messages read so far.
+ */
+std::uint64_t MarketDataReader::getReceived() const
+{
+    return this->received;
+}
+
+/**
+ * @brief Messages overwritten before they could be read.
+ */
+std::uint64_t MarketDataReader::getLost() const
+{
+    return this->lost;
+}
+
+/**
+ * @brief Sequence of the next message to be read.
+ */
+std::uint64_t MarketDataReader::getPosition() const
+{
+    return this->position;
+}
+
+/**
+ * @brief Name of a product in the feed's product table; empty if unknown.
+ */
+std::string MarketDataReader::getProductName(std::uint16_t product) const
+{
+    if((nullptr == header) || (product >= header->productCount.load(std::memory_order_acquire))) return std::string();
+    const char * s = header->products[product];
+    return std::string(s, strnlen(s, FEED_PRODUCT_BYTES));
+}
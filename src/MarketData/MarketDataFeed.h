@@ -0,0 +1,181 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MarketDataFeed.h
+ * @author Edward Martinez
+ * @brief Header file for the shared-memory market data feed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBook.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define FEED_MAGIC          0x3144454546585240ull /**< "@RXFEED1" */
+#define FEED_SLOTS_DEFAULT  (1u << 16)  /**< Messages kept in the ring; a reader further behind loses messages. */
+#define FEED_DEPTH_DEFAULT  10          /**< Price levels per side covered by L2 deltas. */
+#define FEED_MAX_PRODUCTS   64
+#define FEED_PRODUCT_BYTES  16
+#define FEED_MESSAGE_WORDS  7           /**< FeedMessage size in 64-bit words. */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** Feed message types. */
+enum class FeedMsgType:std::uint8_t {clock = 1, topOfBook = 2, level = 3, trade = 4};
+
+/** Book side of a level, or the side of a trade's user order (ask for dataset trades). */
+enum class FeedSide:std::uint8_t {bid = 0, ask = 1};
+
+/*! @struct FeedMessage
+    @brief One market data event.
+
+    - clock: a new timeframe starts at timeMicros; the book and trades of that timeframe follow.
+    - level: the price level now holds amount in total; 0 removes it. Only the best depth
+      levels of each side are covered, so a level pushed out of them is removed as well.
+    - topOfBook: best bid (price, amount) and best ask (askPrice, askAmount) changed; a side
+      with no orders has price and amount 0.
+    - trade: a sale of amount at price.
+*/
+struct FeedMessage
+{
+    FeedMsgType type;
+    FeedSide side;
+    std::uint16_t product;      /**< Index into the feed's product table. @see MarketDataReader::getProductName() */
+    std::uint32_t reserved;
+    std::int64_t timeMicros;
+    double price;
+    double amount;
+    double askPrice;
+    double askAmount;
+    std::uint64_t sequence;     /**< Position of the message in the feed, set on publish. */
+};
+
+/*! @struct FeedSlot
+    @brief Ring slot, one cache line. The message is stored as atomic words so readers racing the writer never read torn data undetected.
+
+    version is 2 x sequence + 1 while the writer fills the slot and 2 x sequence + 2 once it is
+    published (0 if never written).
+*/
+struct alignas(64) FeedSlot
+{
+    std::atomic<std::uint64_t> version;
+    std::atomic<std::uint64_t> words[FEED_MESSAGE_WORDS];
+};
+
+/*! @struct FeedHeader
+    @brief Start of the shared memory object, followed by the slots.
+*/
+struct alignas(64) FeedHeader
+{
+    std::atomic<std::uint64_t> magic;   /**< FEED_MAGIC once the header is valid. */
+    std::uint32_t slots;                /**< Power of two. */
+    std::uint32_t slotBytes;
+    std::atomic<std::uint32_t> productCount;
+    char products[FEED_MAX_PRODUCTS][FEED_PRODUCT_BYTES];
+    alignas(64) std::atomic<std::uint64_t> published; /**< Messages published so far. */
+};
+
+static_assert(sizeof(FeedMessage) == FEED_MESSAGE_WORDS * 8, "FeedMessage must fill FEED_MESSAGE_WORDS words.");
+static_assert(sizeof(FeedSlot) == 64, "FeedSlot must be one cache line.");
+
+/*! @class MarketDataPublisher
+    @brief Single writer of a market data feed in POSIX shared memory.
+
+    Messages go into a ring of FeedSlots, each guarded by its own sequence word (a seqlock), so
+    publishing never waits for readers and any number of readers in other processes can follow
+    at memory speed. A reader that falls more than the ring size behind loses the overwritten
+    messages and is told how many. MerkelMain::processNext() publishes, per timeframe, a clock
+    message, the L2 deltas and top-of-book changes of every product's book, and then the trades
+    of each product as it is matched.
+*/
+class MarketDataPublisher
+{
+    public:
+        MarketDataPublisher() = default;
+        ~MarketDataPublisher();
+        MarketDataPublisher(const MarketDataPublisher &) = delete;
+        MarketDataPublisher & operator=(const MarketDataPublisher &) = delete;
+        void open(const std::string & name, std::size_t ringSlots = FEED_SLOTS_DEFAULT, std::size_t depth = FEED_DEPTH_DEFAULT);
+        void close();
+        bool isOpen() const;
+        void publish(FeedMessage & message);
+        void publishClock(std::int64_t timeMicros);
+        void publishBooks(const OrderBookFrame & frame, std::int64_t timeMicros);
+        void publishTrades(const std::string & product, const std::vector<OrderBookEntry> & sales, std::int64_t timeMicros);
+        std::uint64_t getPublished() const;
+    private:
+        /*! Levels last published for one product. */
+        struct ProductBook
+        {
+            std::vector<std::pair<double, double>> levels[2];  /**< (price, amount) by FeedSide, best first. */
+            std::vector<std::pair<double, double>> orders[2];  /**< Orders of the frame being published, by FeedSide. */
+            double top[4] = {0.0, 0.0, 0.0, 0.0};               /**< Last top of book: bid price/amount, ask price/amount. */
+        };
+        std::uint16_t productIndex(const std::string & product);
+        void publishLevels(std::uint16_t product, FeedSide side, std::int64_t timeMicros);
+        std::string name;
+        FeedHeader * header = nullptr;
+        FeedSlot * slots = nullptr;
+        std::size_t mapBytes = 0;
+        std::uint64_t mask = 0;
+        std::uint64_t next = 0;
+        std::size_t depth = FEED_DEPTH_DEFAULT;
+        std::unordered_map<std::string, std::uint16_t> productIds;
+        std::vector<ProductBook> books;
+        std::vector<std::pair<double, double>> scratch;
+};
+
+/*! @class MarketDataReader
+    @brief Follows a market data feed published by MarketDataPublisher, read-only.
+*/
+class MarketDataReader
+{
+    public:
+        MarketDataReader() = default;
+        ~MarketDataReader();
+        MarketDataReader(const MarketDataReader &) = delete;
+        MarketDataReader & operator=(const MarketDataReader &) = delete;
+        void open(const std::string & name, bool fromOldest = false);
+        void close();
+        bool next(FeedMessage & message);
+        std::uint64_t getReceived() const;
+        std::uint64_t getLost() const;
+        std::uint64_t getPosition() const;
+        std::string getProductName(std::uint16_t product) const;
+    private:
+        const FeedHeader * header = nullptr;
+        const FeedSlot * slots = nullptr;
+        std::size_t mapBytes = 0;
+        std::uint64_t mask = 0;
+        std::uint64_t position = 0;
+        std::uint64_t received = 0;
+        std::uint64_t lost = 0;
+};
@@ -0,0 +1,313 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LatencyHistogram.cpp
+ * @author Edward Martinez
+ * @brief Source file for low-overhead latency histograms of engine hot paths.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "LatencyHistogram.h"
+/** @cond STDINCLUDES */
+#include <fstream>
+#include <iomanip>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LATENCY_CALIBRATION_NS 20000000 /**< Shortest interval used to measure the tick rate. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    /** Tick and wall-clock readings taken at start-up, the reference for ticksPerNano(). */
+    const std::uint64_t startTicks = LatencyClock::now();
+    const Clock::time_point startTime = Clock::now();
+
+    const LatencyOp allOps[LATENCY_NUM_OPS] = {LatencyOp::insert, LatencyOp::getOrders, LatencyOp::match, LatencyOp::tick};
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Tick rate of LatencyClock::now(), measured against steady_clock since start-up.
+ *
+ * Waits until at least 20ms have passed since start-up so the measurement is stable.
+ */
+double LatencyClock::ticksPerNano()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    std::int64_t ns;
+    std::uint64_t ticks;
+    do
+    {
+        ticks = LatencyClock::now();
+        ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+    } while(ns < LATENCY_CALIBRATION_NS);
+    return (double)(ticks - startTicks) / (double)ns;
+#else
+    return 1.0;
+#endif
+}
+
+/**
+ * @brief Constructor for an empty histogram.
+ */
+LatencyHistogram::LatencyHistogram()
+: counts(LATENCY_BUCKETS, 0),
+  total(0),
+  maxValue(0)
+{
+}
+
+/**
+ * @brief Adds one sample.
+ */
+void LatencyHistogram::record(std::uint64_t value)
+{
+    counts[bucketOf(value)]++;
+    total++;
+    if(value > maxValue) maxValue = value;
+}
+
+/**
+ * @brief Adds n samples to a bucket, e.g. when merging per-thread counters.
+ */
+void LatencyHistogram::add(std::size_t bucket, std::uint64_t n)
+{
+    if(bucket >= LATENCY_BUCKETS) return;
+    counts[bucket] += n;
+    total += n;
+}
+
+/**
+ * @brief Adds every sample of another histogram.
+ */
+void LatencyHistogram::merge(const LatencyHistogram & other)
+{
+    for(std::size_t b = 0; b < LATENCY_BUCKETS; b++) counts[b] += other.counts[b];
+    total += other.total;
+    if(other.maxValue > maxValue) maxValue = other.maxValue;
+}
+
+/**
+ * @brief Number of samples.
+ */
+std::uint64_t LatencyHistogram::count() const
+{
+    return this->total;
+}
+
+/**
+ * @brief Largest sample.
+ */
+std::uint64_t LatencyHistogram::max() const
+{
+    return this->maxValue;
+}
+
+/**
+ * @brief Raises the recorded maximum, for histograms rebuilt from bucket counts.
+ */
+void LatencyHistogram::setMax(std::uint64_t value)
+{
+    if(value > maxValue) maxValue = value;
+}
+
+/**
+ * @brief Number of samples in one bucket.
+ */
+std::uint64_t LatencyHistogram::getBucketCount(std::size_t bucket) const
+{
+    return (bucket < LATENCY_BUCKETS) ? counts[bucket] : 0;
+}
+
+/**
+ * @brief Value at or below which p percent of the samples fall.
+ * @param p Percentile in [0, 100].
+ * @return Upper bound of the bucket holding the percentile, capped at max(). 0 if empty.
+ */
+std::uint64_t LatencyHistogram::percentile(double p) const
+{
+    if(0 == total) return 0;
+    if(p < 0.0)   p = 0.0;
+    if(p > 100.0) p = 100.0;
+
+    std::uint64_t rank = (std::uint64_t)((p / 100.0) * (double)total + 0.5);
+    if(rank < 1) rank = 1;
+    std::uint64_t seen = 0;
+    for(std::size_t b = 0; b < LATENCY_BUCKETS; b++)
+    {
+        seen += counts[b];
+        if(seen >= rank)
+        {
+            std::uint64_t upper = bucketUpper(b);
+            return (upper < maxValue) ? upper : maxValue;
+        }
+    }
+    return maxValue;
+}
+
+/**
+ * @brief Largest value falling into a bucket.
+ */
+std::uint64_t LatencyHistogram::bucketUpper(std::size_t bucket)
+{
+    if(bucket < LATENCY_SUB_BUCKETS) return (std::uint64_t)bucket;
+    unsigned shift = (unsigned)(bucket / LATENCY_SUB_BUCKETS) - 1;
+    std::uint64_t sub = (std::uint64_t)(bucket % LATENCY_SUB_BUCKETS) + LATENCY_SUB_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+}
+
+/**
+ * @brief Constructor, zeroing every counter.
+ */
+ThreadLatency::ThreadLatency()
+{
+    for(std::size_t o = 0; o < LATENCY_NUM_OPS; o++)
+    {
+        for(std::size_t b = 0; b < LATENCY_BUCKETS; b++) counts[o][b].store(0, std::memory_order_relaxed);
+        max[o].store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Process-wide registry.
+ */
+LatencyRegistry & LatencyRegistry::instance()
+{
+    static LatencyRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Creates the calling thread's buffer. Called once per thread by record().
+ */
+ThreadLatency & LatencyRegistry::registerThread()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    threads.emplace_back(new ThreadLatency());
+    return *threads.back();
+}
+
+/**
+ * @brief Sums the samples of one operation over every thread.
+ */
+LatencyHistogram LatencyRegistry::merged(LatencyOp op) const
+{
+    LatencyHistogram h;
+    std::size_t o = (std::size_t)op;
+    std::lock_guard<std::mutex> guard(lock);
+    for(const std::unique_ptr<ThreadLatency> & t : threads)
+    {
+        for(std::size_t b = 0; b < LATENCY_BUCKETS; b++)
+        {
+            std::uint64_t n = t->counts[o][b].load(std::memory_order_relaxed);
+            if(n > 0) h.add(b, n);
+        }
+        h.setMax(t->max[o].load(std::memory_order_relaxed));
+    }
+    return h;
+}
+
+/**
+ * @brief Clears every thread's samples. Samples recorded concurrently may be lost.
+ */
+void LatencyRegistry::reset()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for(std::unique_ptr<ThreadLatency> & t : threads)
+    {
+        for(std::size_t o = 0; o < LATENCY_NUM_OPS; o++)
+        {
+            for(std::size_t b = 0; b < LATENCY_BUCKETS; b++) t->counts[o][b].store(0, std::memory_order_relaxed);
+            t->max[o].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Prints count, p50, p99, p99.9 and max in nanoseconds for every operation.
+ */
+void LatencyRegistry::print(std::ostream & os) const
+{
+#ifdef MRX_NO_LATENCY
+    os << "Latency instrumentation was compiled out (MRX_NO_LATENCY).\n";
+#endif
+    double perNano = LatencyClock::ticksPerNano();
+    os << std::left << std::setw(12) << "Operation" << std::right
+       << std::setw(12) << "Count" << std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns"
+       << std::setw(12) << "p99.9 ns" << std::setw(12) << "max ns" << '\n';
+    os << std::fixed << std::setprecision(0);
+    for(LatencyOp op : allOps)
+    {
+        LatencyHistogram h = this->merged(op);
+        os << std::left << std::setw(12) << opName(op) << std::right
+           << std::setw(12) << h.count()
+           << std::setw(12) << (double)h.percentile(50.0) / perNano
+           << std::setw(12) << (double)h.percentile(99.0) / perNano
+           << std::setw(12) << (double)h.percentile(99.9) / perNano
+           << std::setw(12) << (double)h.max() / perNano << '\n';
+    }
+}
+
+/**
+ * @brief Writes the summary plus every non-empty bucket (operation, upper bound in ns, count) to a file.
+ * @return TRUE if the file was written.
+ */
+bool LatencyRegistry::dump(const std::string & path) const
+{
+    std::ofstream out{path};
+    if(!out) return false;
+
+    this->print(out);
+    double perNano = LatencyClock::ticksPerNano();
+    out << "\noperation,bucket_upper_ns,count\n";
+    for(LatencyOp op : allOps)
+    {
+        LatencyHistogram h = this->merged(op);
+        for(std::size_t b = 0; b < LATENCY_BUCKETS; b++)
+        {
+            std::uint64_t n = h.getBucketCount(b);
+            if(n > 0) out << opName(op) << ',' << (double)LatencyHistogram::bucketUpper(b) / perNano << ',' << n << '\n';
+        }
+    }
+    return (bool)out;
+}
+
+/**
+ * @brief Display name of an operation.
+ */
+const char * LatencyRegistry::opName(LatencyOp op)
+{
+    switch(op)
+    {
+        case LatencyOp::insert:    return "insert";
+        case LatencyOp::getOrders: return "getOrders";
+        case LatencyOp::match:     return "match";
+        case LatencyOp::tick:      return "tick";
+    }
+    return "unknown";
+}
@@ -0,0 +1,176 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LatencyHistogram.h
+ * @author Edward Martinez
+ * @brief Header file for low-overhead latency histograms of engine hot paths.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Instrumentation is on by default. Building with MRX_NO_LATENCY defined (CMake option
+ * MERKLEREX_LATENCY=OFF) turns MRX_LATENCY_SCOPE() into nothing, so no clock is read at all.
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LATENCY_SUB_BITS    5                                  /**< 32 sub-buckets per power of two, ~3% precision. */
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+#define LATENCY_BUCKETS     ((64 - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS)
+#define LATENCY_NUM_OPS     4
+
+#ifndef MRX_NO_LATENCY
+/** Times the rest of the enclosing scope as one sample of the given LatencyOp. */
+#define MRX_LATENCY_SCOPE(op) LatencyScope latencyScope_{op}
+#else
+#define MRX_LATENCY_SCOPE(op) do {} while(0)
+#endif
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/** Instrumented operations. */
+enum class LatencyOp:std::uint8_t {insert = 0, getOrders = 1, match = 2, tick = 3};
+
+/*! @class LatencyClock
+    @brief Cheap monotonic tick source: the TSC on x86, steady_clock elsewhere.
+
+    Samples are kept in raw ticks; ticksPerNano() converts them when a report is made.
+*/
+class LatencyClock
+{
+    public:
+        static inline std::uint64_t now()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+        static double ticksPerNano();
+};
+
+/*! @class LatencyHistogram
+    @brief HDR-style log-linear histogram of tick counts.
+
+    Values below LATENCY_SUB_BUCKETS get one bucket each; above that every power of two is split
+    into LATENCY_SUB_BUCKETS equal buckets, so the relative error is bounded at about 3% across
+    the whole 64-bit range with a fixed 15KB of counters.
+*/
+class LatencyHistogram
+{
+    public:
+        LatencyHistogram();
+        void record(std::uint64_t value);
+        void add(std::size_t bucket, std::uint64_t n);
+        void merge(const LatencyHistogram & other);
+        std::uint64_t count() const;
+        std::uint64_t max() const;
+        std::uint64_t percentile(double p) const;
+        std::uint64_t getBucketCount(std::size_t bucket) const;
+        void setMax(std::uint64_t value);
+
+        static inline std::size_t bucketOf(std::uint64_t value)
+        {
+            if(value < LATENCY_SUB_BUCKETS) return (std::size_t)value;
+            unsigned msb = 63u - (unsigned)__builtin_clzll(value);
+            unsigned shift = msb - LATENCY_SUB_BITS;
+            return (std::size_t)(shift + 1) * LATENCY_SUB_BUCKETS + (std::size_t)((value >> shift) - LATENCY_SUB_BUCKETS);
+        }
+        static std::uint64_t bucketUpper(std::size_t bucket);
+    private:
+        std::vector<std::uint64_t> counts;
+        std::uint64_t total;
+        std::uint64_t maxValue;
+};
+
+/*! @struct ThreadLatency
+    @brief Per-thread counters, written only by their owning thread.
+
+    Counters are atomics updated with relaxed load/store pairs (plain moves on x86), so the
+    owner never locks and readers merging from another thread see no data race.
+*/
+struct ThreadLatency
+{
+    std::atomic<std::uint64_t> counts[LATENCY_NUM_OPS][LATENCY_BUCKETS];
+    std::atomic<std::uint64_t> max[LATENCY_NUM_OPS];
+    ThreadLatency();
+};
+
+/*! @class LatencyRegistry
+    @brief Owns every thread's latency buffers and merges them on demand.
+
+    Buffers outlive their threads so samples from finished workers still show up in reports.
+*/
+class LatencyRegistry
+{
+    public:
+        static LatencyRegistry & instance();
+        static inline void record(LatencyOp op, std::uint64_t ticks)
+        {
+            thread_local ThreadLatency * local = nullptr;
+            if(nullptr == local) local = &instance().registerThread();
+
+            std::size_t o = (std::size_t)op;
+            std::atomic<std::uint64_t> & c = local->counts[o][LatencyHistogram::bucketOf(ticks)];
+            c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            if(ticks > local->max[o].load(std::memory_order_relaxed)) local->max[o].store(ticks, std::memory_order_relaxed);
+        }
+        LatencyHistogram merged(LatencyOp op) const;
+        void reset();
+        void print(std::ostream & os) const;
+        bool dump(const std::string & path) const;
+        static const char * opName(LatencyOp op);
+    private:
+        LatencyRegistry() = default;
+        ThreadLatency & registerThread();
+        mutable std::mutex lock;
+        std::vector<std::unique_ptr<ThreadLatency>> threads;
+};
+
+/*! @class LatencyScope
+    @brief Records the time between construction and destruction. @see MRX_LATENCY_SCOPE
+*/
+class LatencyScope
+{
+    public:
+        explicit LatencyScope(LatencyOp op) : op(op), start(LatencyClock::now()) {}
+        ~LatencyScope() { LatencyRegistry::record(op, LatencyClock::now() - start); }
+        LatencyScope(const LatencyScope &) = delete;
+        LatencyScope & operator=(const LatencyScope &) = delete;
+    private:
+        LatencyOp op;
+        std::uint64_t start;
+};
@@ -0,0 +1,205 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MetricsExporter.cpp
+ * @author Edward Martinez
+ * @brief Source file for the background Prometheus text exporter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "MetricsExporter.h"
+#include "MetricsRegistry.h"
+/** @cond STDINCLUDES */
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define METRICS_POLL_MS 100 /**< Longest wait before the socket thread re-checks for stop(). */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    std::string renderMetrics()
+    {
+        std::ostringstream os;
+        MetricsRegistry::instance().render(os);
+        return os.str();
+    }
+
+    void sendAll(int fd, const std::string & text)
+    {
+        std::size_t sent = 0;
+        while(sent < text.size())
+        {
+            ssize_t n = ::send(fd, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+            if(n <= 0) return;
+            sent += (std::size_t)n;
+        }
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Destructor. Stops the exporter thread.
+ */
+MetricsExporter::~MetricsExporter()
+{
+    this->stop();
+}
+
+/**
+ * @brief Starts publishing metrics. A running exporter is stopped first.
+ * @param target File path, or "unix:<path>" for a Unix socket.
+ * @param intervalMs Time between renderings.
+ */
+void MetricsExporter::start(const std::string & target, unsigned intervalMs)
+{
+    this->stop();
+    if(0 == intervalMs) intervalMs = METRICS_INTERVAL_MS_DEFAULT;
+    stopping = false;
+
+    const std::string prefix{METRICS_UNIX_PREFIX};
+    if(0 != target.compare(0, prefix.size(), prefix))
+    {
+        worker = std::thread(&MetricsExporter::runFile, this, target, intervalMs);
+        return;
+    }
+
+    std::string path = target.substr(prefix.size());
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if(path.empty() || (path.size() >= sizeof(addr.sun_path)))
+    {
+        throw std::runtime_error(std::string("MetricsExporter::start - Invalid socket path: ") + path);
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if(fd < 0) throw std::runtime_error(std::string("MetricsExporter::start - socket() failed."));
+    ::unlink(path.c_str());
+    if((::bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0) || (::listen(fd, 8) != 0))
+    {
+        ::close(fd);
+        throw std::runtime_error(std::string("MetricsExporter::start - Cannot listen on ") + path);
+    }
+    worker = std::thread(&MetricsExporter::runSocket, this, fd, path, intervalMs);
+}
+
+/**
+ * @brief Stops the exporter thread, writing a final rendering in file mode.
+ */
+void MetricsExporter::stop()
+{
+    if(!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+/**
+ * @brief TRUE while the exporter thread runs.
+ */
+bool MetricsExporter::isRunning() const
+{
+    return worker.joinable();
+}
+
+/**
+ * @brief Renders the registry to a file, replacing it atomically.
+ * @return TRUE if the file was written.
+ */
+bool MetricsExporter::writeFile(const std::string & path)
+{
+    std::string tmp = path + ".tmp";
+    {
+        std::ofstream out{tmp, std::ios::trunc};
+        if(!out) return false;
+        out << renderMetrics();
+        if(!out) return false;
+    }
+    return 0 == std::rename(tmp.c_str(), path.c_str());
+}
+
+/**
+ * @brief File mode loop: render, then sleep for the interval or until stop().
+ */
+void MetricsExporter::runFile(std::string path, unsigned intervalMs)
+{
+    while(true)
+    {
+        writeFile(path);
+        std::unique_lock<std::mutex> guard(lock);
+        if(wake.wait_for(guard, std::chrono::milliseconds(intervalMs), [this](){ return stopping.load(); }))
+        {
+            guard.unlock();
+            writeFile(path);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Socket mode loop: re-render every interval and serve the latest text to each client.
+ */
+void MetricsExporter::runSocket(int listenFd, std::string path, unsigned intervalMs)
+{
+    typedef std::chrono::steady_clock Clock;
+    std::string text = renderMetrics();
+    Clock::time_point next = Clock::now() + std::chrono::milliseconds(intervalMs);
+
+    while(!stopping)
+    {
+        pollfd pfd{listenFd, POLLIN, 0};
+        if(::poll(&pfd, 1, METRICS_POLL_MS) > 0)
+        {
+            int client = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+            if(client >= 0)
+            {
+                sendAll(client, text);
+                ::close(client);
+            }
+        }
+        if(Clock::now() >= next)
+        {
+            text = renderMetrics();
+            next = Clock::now() + std::chrono::milliseconds(intervalMs);
+        }
+    }
+    ::close(listenFd);
+    ::unlink(path.c_str());
+}
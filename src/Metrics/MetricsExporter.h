@@ -0,0 +1,70 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MetricsExporter.h
+ * @author Edward Martinez
+ * @brief Header file for the background Prometheus text exporter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define METRICS_INTERVAL_MS_DEFAULT 1000
+#define METRICS_UNIX_PREFIX "unix:"
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class MetricsExporter
+    @brief Publishes MetricsRegistry in Prometheus text format from a background thread.
+
+    A target of the form "unix:<path>" listens on a Unix stream socket: every connecting
+    client is sent the most recent rendering and the connection is closed. Any other target
+    is a file path that is atomically replaced (write to .tmp, rename) at each interval,
+    suitable for node_exporter's textfile collector.
+*/
+class MetricsExporter
+{
+    public:
+        MetricsExporter() = default;
+        ~MetricsExporter();
+        MetricsExporter(const MetricsExporter &) = delete;
+        MetricsExporter & operator=(const MetricsExporter &) = delete;
+        void start(const std::string & target, unsigned intervalMs = METRICS_INTERVAL_MS_DEFAULT);
+        void stop();
+        bool isRunning() const;
+        static bool writeFile(const std::string & path);
+    private:
+        void runFile(std::string path, unsigned intervalMs);
+        void runSocket(int listenFd, std::string path, unsigned intervalMs);
+        std::thread worker;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::atomic<bool> stopping{false};
+};
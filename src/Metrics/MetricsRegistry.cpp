@@ -0,0 +1,135 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MetricsRegistry.cpp
+ * @author Edward Martinez
+ * @brief Source file for the engine's counters and gauges.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "MetricsRegistry.h"
+/** @cond STDINCLUDES */
+#include <iomanip>
+#include <set>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Process-wide registry.
+ */
+MetricsRegistry & MetricsRegistry::instance()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Registers (or finds) a counter.
+ * @param name Metric name, e.g. "mrx_fills_total".
+ * @param help One line description for the HELP comment.
+ * @param labels Label set without braces, e.g. built with label(). Empty for none.
+ */
+MetricsCounter & MetricsRegistry::counter(const std::string & name, const std::string & help, const std::string & labels)
+{
+    return this->find(name, help, labels, true).counter;
+}
+
+/**
+ * @brief Registers (or finds) a gauge. @see counter()
+ */
+MetricsGauge & MetricsRegistry::gauge(const std::string & name, const std::string & help, const std::string & labels)
+{
+    return this->find(name, help, labels, false).gauge;
+}
+
+/**
+ * @brief Builds a label pair, escaping the value as required by the text format.
+ */
+std::string MetricsRegistry::label(const std::string & key, const std::string & value)
+{
+    std::string out = key + "=\"";
+    for(char c : value)
+    {
+        if(('\\' == c) || ('"' == c)) out += '\\';
+        if('\n' == c)
+        {
+            out += "\\n";
+            continue;
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+/**
+ * @brief Writes every metric in Prometheus text exposition format.
+ *
+ * Series sharing a name are grouped under one HELP/TYPE header, in registration order.
+ */
+void MetricsRegistry::render(std::ostream & os) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::set<std::string> done;
+    os << std::setprecision(15);
+    for(const Entry & head : entries)
+    {
+        if(!done.insert(head.name).second) continue;
+
+        os << "# HELP " << head.name << ' ' << head.help << '\n'
+           << "# TYPE " << head.name << ' ' << (head.isCounter ? "counter" : "gauge") << '\n';
+        for(const Entry & e : entries)
+        {
+            if(e.name != head.name) continue;
+            os << e.name;
+            if(!e.labels.empty()) os << '{' << e.labels << '}';
+            if(e.isCounter) os << ' ' << e.counter.get() << '\n';
+            else            os << ' ' << e.gauge.get() << '\n';
+        }
+    }
+}
+
+/**
+ * @brief Finds a series by name and labels, creating it if needed.
+ */
+MetricsRegistry::Entry & MetricsRegistry::find(const std::string & name, const std::string & help,
+                                                const std::string & labels, bool isCounter)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for(Entry & e : entries)
+    {
+        if((e.name != name) || (e.labels != labels)) continue;
+        if(e.isCounter != isCounter)
+        {
+            throw std::runtime_error(std::string("MetricsRegistry::find - Metric type mismatch for ") + name);
+        }
+        return e;
+    }
+    entries.emplace_back();
+    Entry & e   = entries.back();
+    e.name      = name;
+    e.help      = help;
+    e.labels    = labels;
+    e.isCounter = isCounter;
+    return e;
+}
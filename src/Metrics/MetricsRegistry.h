@@ -0,0 +1,96 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MetricsRegistry.h
+ * @author Edward Martinez
+ * @brief Header file for the engine's counters and gauges.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class MetricsCounter
+    @brief Monotonic counter. Updates are a single relaxed atomic add.
+*/
+class MetricsCounter
+{
+    public:
+        MetricsCounter() : value(0) {}
+        void inc(std::uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+        std::uint64_t get() const { return value.load(std::memory_order_relaxed); }
+    private:
+        std::atomic<std::uint64_t> value;
+};
+
+/*! @class MetricsGauge
+    @brief Value that can go up and down. Updates are a single relaxed atomic store.
+*/
+class MetricsGauge
+{
+    public:
+        MetricsGauge() : value(0.0) {}
+        void set(double v) { value.store(v, std::memory_order_relaxed); }
+        double get() const { return value.load(std::memory_order_relaxed); }
+    private:
+        std::atomic<double> value;
+};
+
+/*! @class MetricsRegistry
+    @brief Process-wide set of named counters and gauges, rendered in Prometheus text format.
+
+    Registering a metric takes a lock and returns a reference that stays valid for the life of
+    the process; callers keep that reference so updates on hot paths never lock or look up names.
+    Registering the same name and labels twice returns the same metric.
+*/
+class MetricsRegistry
+{
+    public:
+        static MetricsRegistry & instance();
+        MetricsCounter & counter(const std::string & name, const std::string & help, const std::string & labels = "");
+        MetricsGauge & gauge(const std::string & name, const std::string & help, const std::string & labels = "");
+        void render(std::ostream & os) const;
+        static std::string label(const std::string & key, const std::string & value);
+    private:
+        /*! One registered time series. */
+        struct Entry
+        {
+            std::string name;
+            std::string help;
+            std::string labels;
+            bool isCounter;
+            MetricsCounter counter;
+            MetricsGauge gauge;
+        };
+        MetricsRegistry() = default;
+        Entry & find(const std::string & name, const std::string & help, const std::string & labels, bool isCounter);
+        mutable std::mutex lock;
+        std::deque<Entry> entries;
+};
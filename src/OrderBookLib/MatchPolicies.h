@@ -0,0 +1,349 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MatchPolicies.h
+ * @author Edward Martinez
+ * @brief Compile-time policies and the policy-based bid/ask matcher.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * A market model is a MatchPolicy<Price, Rule, Fill, Owners>. Every policy is a type whose
+ * members are static inline functions (or a tag selecting an overload), so each model is
+ * compiled into its own matching loop with no runtime dispatch or policy flags inside it.
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "OrderBookLib.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define MATCH_USER_NAME "simuser"
+/********************************************//**
+ *  Price/quantity representation policies
+ ***********************************************/
+/*! @struct FloatPrice
+    @brief Prices and amounts kept as double, exactly as stored in OrderBookEntry.
+*/
+struct FloatPrice
+{
+    typedef double value_type;
+    static inline value_type from(double v) { return v; }
+    static inline double to(value_type v) { return v; }
+};
+
+/*! @struct FixedPrice
+    @brief Prices and amounts kept as integer multiples of 1/Scale, e.g. Scale = 100000000 for satoshis.
+
+    Comparisons and remainders are exact, so equal prices and amounts really compare equal.
+*/
+template<std::int64_t Scale>
+struct FixedPrice
+{
+    typedef std::int64_t value_type;
+    static inline value_type from(double v) { return (value_type)std::llround(v * (double)Scale); }
+    static inline double to(value_type v) { return (double)v / (double)Scale; }
+};
+/********************************************//**
+ *  Matching rules (tags)
+ ***********************************************/
+/** Lowest ask first; each ask fills the highest bids first, earlier orders first at equal prices. */
+struct PriceTimeRule {};
+/** Lowest ask first; each ask is shared among all crossing bids in proportion to their size. */
+struct ProRataRule {};
+/********************************************//**
+ *  Fill pricing policies
+ ***********************************************/
+/** Sales execute at the ask price, even if the bid is higher. */
+struct AskPriceFill
+{
+    template<typename T>
+    static inline T price(T ask, T) { return ask; }
+};
+/** Sales execute halfway between the ask and the bid. */
+struct MidpointFill
+{
+    template<typename T>
+    static inline T price(T ask, T bid) { return (ask + bid) / 2; }
+};
+/********************************************//**
+ *  Owner tracking policies
+ ***********************************************/
+/*! @struct RestingOrder
+    @brief One order as seen by the matching loop, in the price policy's value type.
+*/
+template<typename T>
+struct RestingOrder
+{
+    T price;
+    T amount;
+    AccountId account;
+    OrderId order;
+    bool user;
+};
+
+/** Sales record the buyer and seller accounts; those involving the simulated user are marked as
+ *  bidsale/asksale and carry the user's order id. */
+struct TrackOwners
+{
+    template<typename R>
+    static inline void load(R & r, const OrderBookEntry & e)
+    {
+        r.account = e.account;
+        r.order   = e.orderId;
+        r.user    = (MATCH_USER_NAME == e.username);
+    }
+    template<typename R>
+    static inline void tag(OrderBookEntry & sale, const R & ask, const R & bid)
+    {
+        sale.seller = ask.account;
+        sale.buyer  = bid.account;
+        if(bid.user)
+        {
+            sale.username   = MATCH_USER_NAME;
+            sale._OrderType = OrderBookType::bidsale;
+            sale.orderId    = bid.order;
+        }
+        else if(ask.user)
+        {
+            sale.username   = MATCH_USER_NAME;
+            sale._OrderType = OrderBookType::asksale;
+            sale.orderId    = ask.order;
+        }
+    }
+};
+/** Every sale is a plain ask sale; order owners are never looked at. */
+struct IgnoreOwners
+{
+    template<typename R>
+    static inline void load(R & r, const OrderBookEntry &)
+    {
+        r.account = ACCOUNT_NONE;
+        r.order   = ORDER_ID_NONE;
+        r.user    = false;
+    }
+    template<typename R>
+    static inline void tag(OrderBookEntry &, const R &, const R &) {}
+};
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct MatchPolicy
+    @brief Bundles the four policies describing one market model.
+*/
+template<typename PriceP, typename RuleP, typename FillP, typename OwnerP>
+struct MatchPolicy
+{
+    typedef PriceP price_policy;
+    typedef RuleP  rule;
+    typedef FillP  fill;
+    typedef OwnerP owner;
+};
+
+/** The exchange's historical behaviour: double prices, price-time priority, ask-price fills, user tracking. */
+typedef MatchPolicy<FloatPrice, PriceTimeRule, AskPriceFill, TrackOwners> DefaultMatchPolicy;
+
+/*! @class OrderMatcher
+    @brief Matches the asks and bids of one product in one timeframe under a MatchPolicy.
+
+    Orders are converted once into compact RestingOrder records in the policy's value
+    type; the matching loop then works only on those records and creates an OrderBookEntry
+    per sale.
+*/
+template<typename Policy>
+class OrderMatcher
+{
+    public:
+        typedef typename Policy::price_policy PriceP;
+        typedef typename PriceP::value_type value_type;
+
+        /**
+         * @brief Matches the asks and bids of a product found in a timeframe's orders.
+         * @param orders Orders of one timeframe, any products and types.
+         * @param product Product to match.
+         * @param timestamp Timestamp given to the sales.
+         * @return Sales in execution order.
+         */
+        static std::vector<OrderBookEntry> match(const std::vector<OrderBookEntry> & orders,
+                                                 const std::string & product,
+                                                 const std::string & timestamp)
+        {
+            std::vector<Resting> asks, bids;
+            collect(orders, product, asks, bids);
+            return sortAndRun(asks, bids, product, timestamp);
+        }
+
+        /**
+         * @brief Matches a timeframe's orders together with extra orders laid over them, without
+         *        copying either range.
+         *
+         * The result is the same as matching the timeframe with the overlay appended to it, so
+         * at equal prices overlay orders queue behind the timeframe's own orders.
+         * @param orders Orders of one timeframe, any products and types.
+         * @param overlay Additional orders of the same timeframe, any products and types.
+         * @param product Product to match.
+         * @param timestamp Timestamp given to the sales.
+         * @return Sales in execution order.
+         */
+        static std::vector<OrderBookEntry> match(const std::vector<OrderBookEntry> & orders,
+                                                 const std::vector<OrderBookEntry> & overlay,
+                                                 const std::string & product,
+                                                 const std::string & timestamp)
+        {
+            std::vector<Resting> asks, bids;
+            collect(orders, product, asks, bids);
+            collect(overlay, product, asks, bids);
+            return sortAndRun(asks, bids, product, timestamp);
+        }
+
+    private:
+        typedef RestingOrder<value_type> Resting;
+
+        static void collect(const std::vector<OrderBookEntry> & orders, const std::string & product,
+                            std::vector<Resting> & asks, std::vector<Resting> & bids)
+        {
+            for(const OrderBookEntry & e : orders)
+            {
+                if(e._product != product) continue;
+                if(OrderBookType::ask == e._OrderType)      asks.push_back(load(e));
+                else if(OrderBookType::bid == e._OrderType) bids.push_back(load(e));
+            }
+        }
+
+        static std::vector<OrderBookEntry> sortAndRun(std::vector<Resting> & asks, std::vector<Resting> & bids,
+                                                      const std::string & product, const std::string & timestamp)
+        {
+            std::stable_sort(asks.begin(), asks.end(), [](const Resting & x, const Resting & y){ return x.price < y.price; });
+            std::stable_sort(bids.begin(), bids.end(), [](const Resting & x, const Resting & y){ return x.price > y.price; });
+
+            std::vector<OrderBookEntry> sales;
+            run(asks, bids, product, timestamp, sales, typename Policy::rule());
+            return sales;
+        }
+
+        static inline Resting load(const OrderBookEntry & e)
+        {
+            Resting r;
+            r.price  = PriceP::from(e._price);
+            r.amount = PriceP::from(e._amount);
+            Policy::owner::load(r, e);
+            return r;
+        }
+
+        static inline void emit(std::vector<OrderBookEntry> & sales, const std::string & product,
+                                const std::string & timestamp, const Resting & ask, const Resting & bid,
+                                value_type amount)
+        {
+            sales.emplace_back(timestamp, product, OrderBookType::ask,
+                               PriceP::to(Policy::fill::price(ask.price, bid.price)), PriceP::to(amount));
+            Policy::owner::tag(sales.back(), ask, bid);
+        }
+
+        /**
+         * @brief Price-time priority.
+         *
+         * 1. Lowest priced ask is processed first.
+         * 2. The highest bid that matches the current ask is given priority over any lower bids.
+         * 3. Partial sales are allowed and sell the largest possible amount.
+         * 4. Partially matched bids or asks can be matched against further bids or asks.
+         */
+        static void run(std::vector<Resting> & asks, std::vector<Resting> & bids, const std::string & product,
+                        const std::string & timestamp, std::vector<OrderBookEntry> & sales, PriceTimeRule)
+        {
+            std::size_t first = 0; //Bids clear in order, so the cleared ones are a prefix that is skipped once.
+            for(Resting & ask : asks)
+            {
+                while((first < bids.size()) && (value_type(0) == bids[first].amount)) first++;
+                for(std::size_t b = first; b < bids.size(); b++)
+                {
+                    Resting & bid = bids[b];
+                    if(bid.price < ask.price) break; //Bids are sorted, no lower bid can match.
+                    if(value_type(0) == bid.amount) continue; //Skip bids that have been cleared.
+
+                    if(bid.amount >= ask.amount)
+                    {
+                        //Bid clears the ask, possibly with some bid remaining.
+                        emit(sales, product, timestamp, ask, bid, ask.amount);
+                        bid.amount = (bid.amount == ask.amount) ? value_type(0) : bid.amount - ask.amount;
+                        break;
+                    }
+                    //Bid partially clears ask.
+                    emit(sales, product, timestamp, ask, bid, bid.amount);
+                    ask.amount = ask.amount - bid.amount;
+                    bid.amount = value_type(0);
+                }
+            }
+        }
+
+        /**
+         * @brief Pro-rata allocation.
+         *
+         * Each ask, lowest first, is shared among every bid priced at or above it in proportion
+         * to the bids' remaining amounts. Rounding leftovers go to the highest bids first.
+         */
+        static void run(std::vector<Resting> & asks, std::vector<Resting> & bids, const std::string & product,
+                        const std::string & timestamp, std::vector<OrderBookEntry> & sales, ProRataRule)
+        {
+            std::vector<value_type> share;
+            for(Resting & ask : asks)
+            {
+                std::size_t n = 0;
+                value_type total = value_type(0);
+                while((n < bids.size()) && (bids[n].price >= ask.price)) total += bids[n++].amount;
+                if(value_type(0) == total) break; //No bid left at or above this (or any higher) ask.
+
+                share.assign(n, value_type(0));
+                if(total <= ask.amount)
+                {
+                    for(std::size_t i = 0; i < n; i++) share[i] = bids[i].amount;
+                }
+                else
+                {
+                    value_type given = value_type(0);
+                    for(std::size_t i = 0; i < n; i++)
+                    {
+                        share[i] = (value_type)((long double)ask.amount * (long double)bids[i].amount / (long double)total);
+                        if(share[i] > bids[i].amount) share[i] = bids[i].amount;
+                        given += share[i];
+                    }
+                    for(std::size_t i = 0; (i < n) && (given < ask.amount); i++)
+                    {
+                        value_type room = bids[i].amount - share[i];
+                        value_type extra = std::min(room, ask.amount - given);
+                        share[i] += extra;
+                        given    += extra;
+                    }
+                }
+
+                for(std::size_t i = 0; i < n; i++)
+                {
+                    if(share[i] <= value_type(0)) continue;
+                    emit(sales, product, timestamp, ask, bids[i], share[i]);
+                    bids[i].amount -= share[i];
+                    ask.amount     -= share[i];
+                }
+            }
+        }
+};
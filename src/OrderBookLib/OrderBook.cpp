@@ -28,45 +28,82 @@
  ***********************************************/
 #include "OrderBook.h"
 #include "../CsvReader/CsvReader.h"
+#include "../Metrics/LatencyHistogram.h"
 /** @cond STDINCLUDES*/
-#include <map>
 #include <algorithm>
 #include <stdexcept>
 /** @cond */
 /********************************************//**
  *  Method Implementations
  ***********************************************/
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    /**
+     * @brief Orders frames by timestamp, for binary searches over the frame list.
+     */
+    bool frameBefore(const OrderBookFrame & frame, const std::string & timestamp)
+    {
+        return frame.timestamp < timestamp;
+    }
+
+    /**
+     * @brief Groups entries into timestamp-ordered frames. Entry order within a timestamp is kept.
+     */
+    OrderBookFrames::Slots buildFrames(std::vector<OrderBookEntry> && entries)
+    {
+        if(!std::is_sorted(entries.begin(),entries.end(),OrderBookEntry::compareByTimestamp))
+        {
+            std::stable_sort(entries.begin(),entries.end(),OrderBookEntry::compareByTimestamp);
+        }
+        OrderBookFrames::Slots frames;
+        for(OrderBookEntry & e : entries)
+        {
+            if(frames.empty() || (frames.back()->timestamp != e._timestamp))
+            {
+                frames.push_back(std::make_shared<OrderBookFrame>(OrderBookFrame{e._timestamp, {}}));
+            }
+            frames.back()->orders.push_back(std::move(e));
+        }
+        return frames;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor for an empty orderbook.
+ */
+OrderBook::OrderBook()
+: frames(std::make_shared<OrderBookFrames>()),
+  nOrders(0)
+{
+}
+
 /**
  * @brief Constructor
  * @param filename Path to csv file containing order data set.
  */
 OrderBook::OrderBook(std::string filename)
+: OrderBook()
 {
-    this->orders = CsvReader::readCSV(filename);
-    if(this->orders.size() == 0)
+    this->restore(CsvReader::readCSV(filename));
+    if(this->nOrders == 0)
     {
         throw std::runtime_error(std::string("Failed to read data for OrderBook."));
     }
 }
 
 /**
- * @brief Searches this->orders for all unique product types (e.g. "BTC/DOGE") and returns a vector containing this info.
+ * @brief Returns all unique product types (e.g. "BTC/DOGE") seen in the orderbook, in sorted order.
+ * 
+ * The list is maintained as orders are added, so no scan of the orders is needed.
  */
 std::vector<std::string> OrderBook::getKnownProducts()
 {
-    std::vector<std::string> products;
-    std::map<std::string,bool> prodMap;
-
-    for(const OrderBookEntry& e: orders)
-    {
-        prodMap[e._product] = true;
-    }
-    
-    for(const auto &e : prodMap)
-    {
-        products.push_back(e.first);
-    }
-    return products;
+    return this->products;
 }
 /**
  * @brief Gets a vector of OrderBookEntry objects matching the specified filters (type, product, time window).
@@ -76,12 +113,15 @@ std::vector<std::string> OrderBook::getKnownProducts()
  */
 std::vector<OrderBookEntry> OrderBook::getOrders(OrderBookType type, std::string product, std::string timestamp)
 {
+    MRX_LATENCY_SCOPE(LatencyOp::getOrders);
     std::vector<OrderBookEntry> OrdersFiltered;
-    for(const OrderBookEntry &entry : orders)
+    const OrderBookFrame * frame = this->findFrame(timestamp);
+    if(nullptr == frame) return OrdersFiltered;
+
+    for(const OrderBookEntry &entry : frame->orders)
     {
         if((entry._OrderType == type   )&&
-           (entry._product   == product)&&
-           (entry._timestamp == timestamp))
+           (entry._product   == product))
         {
             OrdersFiltered.push_back(entry);
         }
@@ -134,57 +174,254 @@ double OrderBook::getSpread(std::vector<OrderBookEntry>& OrdersSub)
  * Assumes timestamps are strings with purely numerical values. This is so that the timestamps
  * may be compared.
  * 
- * @return string containing the earliest found timestamp. 
+ * @return string containing the earliest found timestamp, or an empty string if the orderbook is empty. 
  */
 std::string OrderBook::getEarliestTime()
 {
-    std::string first_timestamp = this->orders[0]._timestamp; //Get first timestamp in entry list
-
-    for(OrderBookEntry &e : this->orders)
-    {
-        if(e._timestamp < first_timestamp) first_timestamp = e._timestamp;
-    }
-    return first_timestamp;
+    if(this->frames->empty()) return "";
+    return this->frames->front().timestamp;
 }
 
 /**
  * @brief Gets the next timestamp for the simulation.
  * 
  * Assumes timestamps are strings with purely numerical values. This is so that the timestamps
- * may be compared.
+ * may be compared. Wraps around to the earliest timestamp after the last timeframe.
  * 
  * @return string containing the next timestamp in the orderbook. 
  */
 std::string OrderBook::getNextTime(const std::string & timestamp)
 {
-    std::string next_timestamp = "";
-    for(OrderBookEntry &e : orders)
+    auto it = std::upper_bound(frames->begin(),frames->end(),timestamp,
+                               [](const std::string & t, const OrderBookFrame & f){ return t < f.timestamp; });
+    if(it == frames->end()) return getEarliestTime();
+    return it->timestamp;
+}
+
+/**
+ * @brief Number of entries in the orderbook.
+ */
+std::size_t OrderBook::getOrderCount() const
+{
+    return this->nOrders;
+}
+
+/**
+ * @brief Number of entries in the orderbook for one timeframe.
+ * @param timestamp Timeframe to count.
+ */
+std::size_t OrderBook::getOrderCount(const std::string & timestamp) const
+{
+    const OrderBookFrame * frame = this->findFrame(timestamp);
+    return (nullptr == frame) ? 0 : frame->orders.size();
+}
+
+/**
+ * @brief Number of entries per product for one timeframe, in one pass over the frame.
+ * @param timestamp Timeframe to count.
+ * @return Counts in the order of getKnownProducts().
+ */
+std::vector<std::size_t> OrderBook::getOrderCounts(const std::string & timestamp) const
+{
+    std::vector<std::size_t> counts(products.size(), 0);
+    const OrderBookFrame * frame = this->findFrame(timestamp);
+    if(nullptr == frame) return counts;
+
+    std::size_t last = 0;
+    for(const OrderBookEntry & e : frame->orders)
     {
-        if(e._timestamp > timestamp) 
+        //Entries of a product tend to be adjacent, so try the previous product first.
+        if((last >= products.size()) || (products[last] != e._product))
         {
-            next_timestamp = e._timestamp;
-            break;
+            last = std::lower_bound(products.begin(),products.end(),e._product) - products.begin();
         }
+        if(last < products.size()) counts[last]++;
     }
+    return counts;
+}
 
-    if( next_timestamp == "") next_timestamp = getEarliestTime();
-    return next_timestamp;
+/**
+ * @brief Rebuilds a product's book as it stood at any past (or future) time.
+ * 
+ * Each frame already holds the complete book of its timeframe, so the state at a time is the
+ * latest frame at or before it: one binary search over the frames plus a pass over that frame,
+ * without replaying the timeframes in between.
+ * @param product Product to rebuild, e.g. "ETH/BTC".
+ * @param timestamp Time of interest. Need not match a timeframe exactly.
+ * @param out Receives the timeframe in effect and its sorted asks and bids.
+ * @return TRUE if a timeframe exists at or before the requested time.
+ */
+bool OrderBook::getBookAt(const std::string & product, const std::string & timestamp, OrderBookDepth & out) const
+{
+    out.asks.clear();
+    out.bids.clear();
+    auto it = std::upper_bound(frames->begin(),frames->end(),timestamp,
+                               [](const std::string & t, const OrderBookFrame & f){ return t < f.timestamp; });
+    if(it == frames->begin())
+    {
+        out.timestamp.clear();
+        return false;
+    }
+    --it;
+
+    out.timestamp = it->timestamp;
+    for(const OrderBookEntry & e : it->orders)
+    {
+        if(e._product != product) continue;
+        if(e._OrderType == OrderBookType::ask)      out.asks.push_back(e);
+        else if(e._OrderType == OrderBookType::bid) out.bids.push_back(e);
+    }
+    std::stable_sort(out.asks.begin(),out.asks.end(),OrderBookEntry::compareByPriceAsc);
+    std::stable_sort(out.bids.begin(),out.bids.end(),OrderBookEntry::compareByPriceDesc);
+    return true;
+}
+
+/**
+ * @brief Every entry of one timeframe, read in place.
+ * @return nullptr if there is no frame with exactly this timestamp. Valid until the book is next modified.
+ */
+const OrderBookFrame * OrderBook::getFrame(const std::string & timestamp) const
+{
+    return this->findFrame(timestamp);
 }
 
 /**
  * @brief Add an OrderBookEntry to the orderbook.
  * 
- * Appends new OBE to orders vector then performs a sort based on simulation timestamp values.
+ * Appends the new OBE to the frame matching its timestamp, creating the frame if needed.
  */
 void OrderBook::insertOrder(OrderBookEntry &order)
 {
-    orders.push_back(order);
-    std::sort(orders.begin(),orders.end(),OrderBookEntry::compareByTimestamp);
+    MRX_LATENCY_SCOPE(LatencyOp::insert);
+    this->frameFor(order._timestamp).orders.push_back(order);
+    this->addProduct(order._product);
+    this->nOrders++;
+}
+
+/**
+ * @brief Removes a held user order from its timeframe.
+ * @param timestamp Timeframe the order was entered in.
+ * @param id Order id given by Wallet::reserve().
+ * @return TRUE if the order was found and removed.
+ */
+bool OrderBook::cancelOrder(const std::string & timestamp, OrderId id)
+{
+    if(ORDER_ID_NONE == id) return false;
+    const OrderBookFrame * found = this->findFrame(timestamp);
+    if(nullptr == found) return false;
+    auto byId = [id](const OrderBookEntry & e){ return e.orderId == id; };
+    if(std::none_of(found->orders.begin(), found->orders.end(), byId)) return false;
+
+    std::vector<OrderBookEntry> & orders = this->frameFor(timestamp).orders;
+    orders.erase(std::find_if(orders.begin(), orders.end(), byId));
+    this->nOrders--;
+    return true;
+}
+
+/**
+ * @brief Add a batch of OrderBookEntry objects to the orderbook.
+ * 
+ * Intended for bulk loads (e.g. journal recovery). Consecutive entries with the same timestamp
+ * reuse the frame found for the previous entry, so a time-ordered batch costs one frame
+ * lookup per timeframe. The whole batch is timed as a single insert sample.
+ * @param batch Entries to be added. Contents are moved into the orderbook.
+ */
+void OrderBook::insertOrders(std::vector<OrderBookEntry> &batch)
+{
+    MRX_LATENCY_SCOPE(LatencyOp::insert);
+    OrderBookFrame * frame = nullptr;
+    for(OrderBookEntry & e : batch)
+    {
+        if((nullptr == frame) || (frame->timestamp != e._timestamp))
+        {
+            frame = &this->frameFor(e._timestamp);
+        }
+        this->addProduct(e._product);
+        frame->orders.push_back(std::move(e));
+        this->nOrders++;
+    }
+    batch.clear();
+}
+
+/**
+ * @brief Returns a read-only view of the current orderbook frames.
+ * 
+ * Taking the view is O(1). It stays valid and unchanged while the orderbook continues to be
+ * modified, and later writes duplicate only the frames they touch, so it can be handed to
+ * background threads (e.g. checkpoint writers or reports) without stalling the engine or
+ * doubling the book's memory.
+ */
+OrderBookSnapshot OrderBook::snapshot() const
+{
+    return this->frames;
+}
+
+/**
+ * @brief Replaces the orderbook contents, e.g. with entries read back from a checkpoint.
+ * @param entries New orderbook entries.
+ */
+void OrderBook::restore(std::vector<OrderBookEntry> && entries)
+{
+    this->nOrders = entries.size();
+    this->products.clear();
+    for(const OrderBookEntry & e : entries) this->addProduct(e._product);
+    this->frames = std::make_shared<OrderBookFrames>();
+    this->frames->slots = buildFrames(std::move(entries));
+}
+
+/**
+ * @brief Finds the frame holding a timeframe's orders.
+ * @return Pointer to the frame, or nullptr if no orders exist for the timestamp.
+ */
+const OrderBookFrame * OrderBook::findFrame(const std::string & timestamp) const
+{
+    auto it = std::lower_bound(frames->begin(),frames->end(),timestamp,frameBefore);
+    if((it == frames->end()) || (it->timestamp != timestamp)) return nullptr;
+    return &(*it);
+}
+
+/**
+ * @brief Gives write access to the frame for a timestamp, creating it if needed.
+ * 
+ * Detaches the frame from any copies or snapshots first: a shared frame list is replaced by
+ * a copy of its pointers, and the frame itself is copied only if something else still refers
+ * to it. Every other frame stays shared.
+ */
+OrderBookFrame & OrderBook::frameFor(const std::string & timestamp)
+{
+    if(this->frames.use_count() > 1)
+    {
+        this->frames = std::make_shared<OrderBookFrames>(*this->frames);
+    }
+    OrderBookFrames::Slots & slots = this->frames->slots;
+    auto it = std::lower_bound(slots.begin(),slots.end(),timestamp,
+                               [](const std::shared_ptr<OrderBookFrame> & f, const std::string & t){ return f->timestamp < t; });
+    if((it == slots.end()) || ((*it)->timestamp != timestamp))
+    {
+        it = slots.insert(it,std::make_shared<OrderBookFrame>(OrderBookFrame{timestamp, {}}));
+    }
+    else if(it->use_count() > 1)
+    {
+        *it = std::make_shared<OrderBookFrame>(**it);
+    }
+    return **it;
+}
+
+/**
+ * @brief Records a product in the sorted list of known products.
+ */
+void OrderBook::addProduct(const std::string & product)
+{
+    if(!this->products.empty() && (this->products.back() == product)) return;
+    auto it = std::lower_bound(products.begin(),products.end(),product);
+    if((it == products.end()) || (*it != product)) products.insert(it,product);
 }
 
 /**
  * @brief Match bid OBEs to ask OBEs for a specified timeframe.
  * 
+ * Uses DefaultMatchPolicy; other market models call matchAsksToBidsWith<Policy>().
+ * 
  * @param product Product to match
  * @param timestamp Timeframe in which to perform the matching.
  * 
@@ -197,68 +434,6 @@ void OrderBook::insertOrder(OrderBookEntry &order)
  */
 std::vector<OrderBookEntry> OrderBook::matchAsksToBids(std::string product, std::string timestamp)
 {
-    std::vector<OrderBookEntry> asks = getOrders(OrderBookType::ask,product,timestamp);
-    std::vector<OrderBookEntry> bids = getOrders(OrderBookType::bid,product,timestamp);
-    std::vector<OrderBookEntry> sales;
-
-    std::sort(asks.begin(),asks.end(),OrderBookEntry::compareByPriceAsc);
-    std::sort(bids.begin(),bids.end(),OrderBookEntry::compareByPriceDesc);
-
-    for(OrderBookEntry & cAsk:asks)
-    {
-        for(OrderBookEntry & cBid:bids)
-        {
-            if(0 == cBid._amount) continue; //Skip bids that have been cleared.
-
-            if(cBid._price >= cAsk._price)
-            {
-                OrderBookEntry sale = OrderBookEntry{timestamp,
-                                                     product,
-                                                     OrderBookType::ask,
-                                                     0.0,
-                                                     0.0};
-                sale._price = cAsk._price;
-                if("simuser" == cBid.username)
-                {
-                    sale.username   = "simuser";
-                    sale._OrderType = OrderBookType::bidsale; 
-                }
-                else if("simuser" == cAsk.username)
-                {
-                    sale.username   = "simuser";
-                    sale._OrderType = OrderBookType::asksale; 
-                }
-
-                //Both bid and ask are completely cleared.
-                if(cBid._amount == cAsk._amount)
-                {
-                    sale._amount = cAsk._amount;
-                    sales.push_back(sale);
-
-                    cBid._amount = 0; //This bid can do no more work
-                    break;
-                }
-                //Bid completely clears ask, some bid remains.
-                if(cBid._amount > cAsk._amount)
-                {
-                    sale._amount = cAsk._amount;
-                    sales.push_back(sale);
-                    cBid._amount = cBid._amount - sale._amount; //Update bid amount for future possible sales.
-                    break;
-                }
-                //Bid partially clears ask.
-                if(cBid._amount < cAsk._amount)
-                {
-                    sale._amount = cBid._amount;
-                    sales.push_back(sale);
-                    cAsk._amount = cAsk._amount - cBid._amount; //Update ask amount for future possible sales.
-                    cBid._amount = 0; //This bid can do no more work
-                    continue;
-                }
-            }//end if(cBid.price >= ask.price)
-
-        } //end for(OrderBookEntry cBid:bids)
-
-    } //end for(OrderBookEntry cAsk:asks)
-    return sales;
+    MRX_LATENCY_SCOPE(LatencyOp::match);
+    return this->matchAsksToBidsWith<DefaultMatchPolicy>(product, timestamp);
 }
\ No newline at end of file
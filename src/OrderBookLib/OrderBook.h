@@ -27,22 +27,108 @@
  *  Includes
  ***********************************************/
 #include "../OrderBookLib/OrderBookLib.h"
+#include "../OrderBookLib/MatchPolicies.h"
 /** @cond STDINCLUDES */
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <string>
 #include <vector>
 /** @endcond */
 /********************************************//**
  *  Class Definitions
  ***********************************************/
+/*! @struct OrderBookFrame
+    @brief All orderbook entries sharing one timestamp (i.e. one simulation timeframe).
+*/
+struct OrderBookFrame
+{
+    std::string timestamp;
+    std::vector<OrderBookEntry> orders;
+};
+
+/*! @struct OrderBookDepth
+    @brief Resting asks and bids of one product as of a point in time. @see OrderBook::getBookAt()
+*/
+struct OrderBookDepth
+{
+    std::string timestamp;              /**< Timeframe in effect at the queried time. */
+    std::vector<OrderBookEntry> asks;   /**< Sorted by ascending price. */
+    std::vector<OrderBookEntry> bids;   /**< Sorted by descending price. */
+};
+
+/*! @class OrderBookFrames
+    @brief Timestamp-ordered frames of an OrderBook, each held through its own shared pointer.
+
+    Copying the list copies one pointer per frame and shares every frame, so a book and its
+    snapshots only part ways on the frames modified afterwards (see OrderBook::frameFor()).
+    Iteration and indexing give the frames themselves, read-only.
+*/
+class OrderBookFrames
+{
+    public:
+        typedef std::vector<std::shared_ptr<OrderBookFrame>> Slots;
+
+        /*! Random access iterator over the frames. */
+        class const_iterator
+        {
+            public:
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef OrderBookFrame value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const OrderBookFrame * pointer;
+                typedef const OrderBookFrame & reference;
+
+                const_iterator() = default;
+                explicit const_iterator(Slots::const_iterator it) : it(it) {}
+                reference operator*() const { return **it; }
+                pointer operator->() const { return it->get(); }
+                reference operator[](difference_type n) const { return *it[n]; }
+                const_iterator & operator++() { ++it; return *this; }
+                const_iterator operator++(int) { return const_iterator(it++); }
+                const_iterator & operator--() { --it; return *this; }
+                const_iterator operator--(int) { return const_iterator(it--); }
+                const_iterator & operator+=(difference_type n) { it += n; return *this; }
+                const_iterator & operator-=(difference_type n) { it -= n; return *this; }
+                const_iterator operator+(difference_type n) const { return const_iterator(it + n); }
+                const_iterator operator-(difference_type n) const { return const_iterator(it - n); }
+                difference_type operator-(const const_iterator & o) const { return it - o.it; }
+                bool operator==(const const_iterator & o) const { return it == o.it; }
+                bool operator!=(const const_iterator & o) const { return it != o.it; }
+                bool operator<(const const_iterator & o) const { return it < o.it; }
+            private:
+                Slots::const_iterator it;
+        };
+
+        std::size_t size() const { return slots.size(); }
+        bool empty() const { return slots.empty(); }
+        const OrderBookFrame & operator[](std::size_t i) const { return *slots[i]; }
+        const OrderBookFrame & front() const { return *slots.front(); }
+        const OrderBookFrame & back() const { return *slots.back(); }
+        const_iterator begin() const { return const_iterator(slots.begin()); }
+        const_iterator end() const { return const_iterator(slots.end()); }
+    private:
+        friend class OrderBook;
+        Slots slots;
+};
+
+/** Read-only, point-in-time view of every frame in an OrderBook. @see OrderBook::snapshot() */
+typedef std::shared_ptr<const OrderBookFrames> OrderBookSnapshot;
+
 /*! @class OrderBook
     @brief Class for exchange orderbook data.
 
     Serves as a wrapper for handling orderbook data entries and performing statistical analyses.
+    Entries are grouped into frames kept in timestamp order, so per-timeframe lookups are a
+    binary search rather than a scan of the whole book.
+    Frames are held in shared, copy-on-write storage: copying an OrderBook or taking a
+    snapshot() is O(1). When a shared book is modified, its list of frame pointers is copied
+    once and only the frames actually written to are duplicated; all others stay shared.
 */
 class OrderBook
 {
     public:
-        OrderBook() = default;
+        OrderBook();
         OrderBook(std::string filename);
         std::vector<std::string> getKnownProducts();
         std::vector<OrderBookEntry> getOrders(OrderBookType type,
@@ -54,9 +140,46 @@ class OrderBook
         static double getSpread(std::vector<OrderBookEntry>& OrdersSub);
         std::string getEarliestTime();
         std::string getNextTime(const std::string & timestamp);
+        std::size_t getOrderCount() const;
+        std::size_t getOrderCount(const std::string & timestamp) const;
+        std::vector<std::size_t> getOrderCounts(const std::string & timestamp) const;
         void insertOrder(OrderBookEntry &order);
+        void insertOrders(std::vector<OrderBookEntry> &batch);
+        bool cancelOrder(const std::string & timestamp, OrderId id);
+        bool getBookAt(const std::string & product, const std::string & timestamp, OrderBookDepth & out) const;
+        const OrderBookFrame * getFrame(const std::string & timestamp) const;
         std::vector<OrderBookEntry> matchAsksToBids(std::string product, std::string timestamp);
+        template<typename Policy>
+        std::vector<OrderBookEntry> matchAsksToBidsWith(const std::string & product, const std::string & timestamp) const;
+        OrderBookSnapshot snapshot() const;
+        void restore(std::vector<OrderBookEntry> && entries);
 
     private:
-        std::vector<OrderBookEntry> orders;
-};
\ No newline at end of file
+        const OrderBookFrame * findFrame(const std::string & timestamp) const;
+        OrderBookFrame & frameFor(const std::string & timestamp);
+        void addProduct(const std::string & product);
+        std::shared_ptr<OrderBookFrames> frames;
+        std::vector<std::string> products;
+        std::size_t nOrders;
+};
+
+/********************************************//**
+ *  Template Method Implementations
+ ***********************************************/
+/**
+ * @brief Matches the asks and bids of a product in a timeframe under a compile-time MatchPolicy.
+ *
+ * The frame's orders are handed to OrderMatcher<Policy> directly, without copying them out
+ * through getOrders(). The book itself is not modified.
+ * @tparam Policy A MatchPolicy, e.g. DefaultMatchPolicy.
+ * @param product Product to match.
+ * @param timestamp Timeframe to match.
+ * @return Sales in execution order.
+ */
+template<typename Policy>
+std::vector<OrderBookEntry> OrderBook::matchAsksToBidsWith(const std::string & product, const std::string & timestamp) const
+{
+    const OrderBookFrame * frame = this->findFrame(timestamp);
+    if(nullptr == frame) return std::vector<OrderBookEntry>{};
+    return OrderMatcher<Policy>::match(frame->orders, product, timestamp);
+}
@@ -26,8 +26,10 @@
  *  Includes
  ***********************************************/
 #include "OrderBookLib.h"
+#include "../Log/Logger.h"
 /** @cond STDINCLUDES */
 #include <iostream>
+#include <stdexcept>
 /** @endcond */
 OrderBookEntry::OrderBookEntry(std::string timestamp,std::string product,OrderBookType OrderType,double price, double amount)
 : _timestamp(timestamp),
@@ -52,6 +54,56 @@ OrderBookType OrderBookEntry::stringToObeType(const std::string& s)
     else                return OrderBookType::unknown;
 }
 
+/**
+ * @brief Converts a timestamp string to microseconds since the Unix epoch (UTC).
+ * 
+ * Expects the data set format "YYYY/MM/DD HH:MM:SS.ffffff"; the fractional part may be
+ * shorter or missing. Parsing is done by hand since it runs once per trade in analytics.
+ * @param timestamp Timestamp string, e.g. "2020/03/17 17:01:24.884492"
+ * @return Microseconds since 1970/01/01 00:00:00, or -1 if the string is malformed.
+ */
+std::int64_t OrderBookEntry::timestampToMicros(const std::string& timestamp)
+{
+    const char * s = timestamp.c_str();
+    auto digits = [s](std::size_t pos, std::size_t n, std::int64_t & out) -> bool
+    {
+        out = 0;
+        for(std::size_t i = pos; i < pos + n; i++)
+        {
+            if((s[i] < '0') || (s[i] > '9')) return false;
+            out = out * 10 + (s[i] - '0');
+        }
+        return true;
+    };
+
+    std::int64_t y, mo, d, h, mi, sec;
+    if((timestamp.size() < 19) ||
+       !digits(0,4,y) || !digits(5,2,mo) || !digits(8,2,d) ||
+       !digits(11,2,h) || !digits(14,2,mi) || !digits(17,2,sec))
+    {
+        return -1;
+    }
+
+    std::int64_t micros = 0;
+    std::size_t nFrac = 0;
+    for(std::size_t i = 20; (i < timestamp.size()) && (nFrac < 6); i++, nFrac++)
+    {
+        if((s[i] < '0') || (s[i] > '9')) return -1;
+        micros = micros * 10 + (s[i] - '0');
+    }
+    for(; nFrac < 6; nFrac++) micros *= 10;
+
+    //Days since epoch from a civil date (proleptic Gregorian calendar).
+    y -= (mo <= 2);
+    std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    std::int64_t yoe = y - era * 400;
+    std::int64_t doy = (153 * (mo + (mo > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    std::int64_t days = era * 146097 + doe - 719468;
+
+    return ((days * 86400 + h * 3600 + mi * 60 + sec) * 1000000) + micros;
+}
+
 /**
  * @brief Compares two orderbook entries. 
  * 
@@ -69,7 +121,7 @@ bool OrderBookEntry::compareByTimestamp(const OrderBookEntry &e1, const OrderBoo
  * 
  * Returns true if the first OBE has a lower price than the second.
  */
-bool OrderBookEntry::compareByPriceAsc(OrderBookEntry & e1,OrderBookEntry & e2)
+bool OrderBookEntry::compareByPriceAsc(const OrderBookEntry &e1, const OrderBookEntry &e2)
 {
     return e1._price < e2._price;
 }
@@ -79,7 +131,7 @@ bool OrderBookEntry::compareByPriceAsc(OrderBookEntry & e1,OrderBookEntry & e2)
  * 
  * Returns true if the first OBE has a higher price than the second.
  */
-bool OrderBookEntry::compareByPriceDesc(OrderBookEntry & e1,OrderBookEntry & e2)
+bool OrderBookEntry::compareByPriceDesc(const OrderBookEntry &e1, const OrderBookEntry &e2)
 {
     return e1._price > e2._price;
 }
@@ -88,7 +140,7 @@ bool OrderBookEntry::compareByPriceDesc(OrderBookEntry & e1,OrderBookEntry & e2)
  * @brief Generates a OrderBookEntry object.
  * 
  * Takes a vector of strings and converts types to return a new OBE.
- * @param tokens Vector containing OBE attributes as strings.
+ * @param tokens Vector containing OBE attributes as strings, optionally followed by an account id.
  */
 OrderBookEntry OrderBookEntry::stringsToOBE(std::vector<std::string> tokens)
 {
@@ -101,8 +153,7 @@ OrderBookEntry OrderBookEntry::stringsToOBE(std::vector<std::string> tokens)
     }
     catch(const std::exception& e)
     {
-        std::cout << "CsvReader::stringsToOBE - Error in string to OBE type conversion." << std::endl;
-        std::cout << "   " << e.what() << std::endl;
+        MRX_LOG_WARN("CsvReader::stringsToOBE - Error in string to OBE type conversion: {}", e.what());
         throw;
     }
     OrderBookEntry obe{tokens[0],
@@ -110,6 +161,17 @@ OrderBookEntry OrderBookEntry::stringsToOBE(std::vector<std::string> tokens)
                        OrderBookEntry::stringToObeType(tokens[2]),
                        price,
                        amount};
+    if(tokens.size() > 5)
+    {
+        //Optional sixth column: owning account id.
+        std::size_t used = 0;
+        unsigned long long account = std::stoull(tokens[5], &used);
+        if((used != tokens[5].size()) || ('-' == tokens[5][0]) || (account > ACCOUNT_ID_MAX))
+        {
+            throw std::runtime_error(std::string("OrderBookEntry::stringsToOBE - Invalid account id: ") + tokens[5]);
+        }
+        obe.account = (AccountId)account;
+    }
     return obe;
 }
 
@@ -136,8 +198,7 @@ OrderBookEntry OrderBookEntry::stringsToOBE(std::string priceString,
         amount = std::stod(amountString);
     }catch(const std::exception& e)
     {
-        std::cout << "CSVReader::stringsToOBE Bad float! " << priceString<< std::endl;
-        std::cout << "CSVReader::stringsToOBE Bad float! " << amountString<< std::endl;
+        MRX_LOG_WARN("CSVReader::stringsToOBE Bad float! {} {}", priceString, amountString);
         throw; // throw up to the calling function
     }
     OrderBookEntry obe{timestamp,
@@ -27,14 +27,27 @@
  *  Includes
  ***********************************************/
 /** @cond STDINCLUDES */
+#include <cstdint>
 #include <string>
 #include <vector>
 /** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define ACCOUNT_NONE 0xFFFFFFFFu /**< Order or sale side without a ledger account (e.g. anonymous dataset orders). */
+#define ACCOUNT_ID_MAX 0x00FFFFFFu /**< Highest account id a data set row may carry; bounds the ledger opened for it. */
+#define ORDER_ID_NONE 0u        /**< Order without a wallet hold. */
 /********************************************//**
  *  Class Definitions
  ***********************************************/
 enum class OrderBookType:char {bid,ask,unknown,asksale,bidsale};
 
+/** Compact ledger account identifier. @see Ledger */
+typedef std::uint32_t AccountId;
+
+/** Identifier of a user order and its wallet hold. @see Wallet::reserve() */
+typedef std::uint64_t OrderId;
+
 /*! @class OrderBookEntry
     @brief Class for an entry of order book data.
 */
@@ -47,11 +60,16 @@ class OrderBookEntry
         double _price;
         double _amount;
         std::string username = "dataset";
+        AccountId account = ACCOUNT_NONE;   /**< Owner of an ask/bid. */
+        AccountId buyer   = ACCOUNT_NONE;   /**< Bidding account of a sale. */
+        AccountId seller  = ACCOUNT_NONE;   /**< Asking account of a sale. */
+        OrderId orderId   = ORDER_ID_NONE;  /**< Held user order, or for a sale the user order it fills. */
         OrderBookEntry(std::string timestamp,std::string product,OrderBookType OrderType,double price, double amount);
         static OrderBookType stringToObeType(const std::string& s);
+        static std::int64_t timestampToMicros(const std::string& timestamp);
         static bool compareByTimestamp(const OrderBookEntry &e1, const OrderBookEntry &e2);
-        static bool compareByPriceAsc(OrderBookEntry & e1,OrderBookEntry & e2);
-        static bool compareByPriceDesc(OrderBookEntry & e1,OrderBookEntry & e2);
+        static bool compareByPriceAsc(const OrderBookEntry &e1, const OrderBookEntry &e2);
+        static bool compareByPriceDesc(const OrderBookEntry &e1, const OrderBookEntry &e2);
         static OrderBookEntry stringsToOBE(std::string price,
                                     std::string amount,
                                     std::string timestamp,
@@ -0,0 +1,127 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SymbolTable.cpp
+ * @author Edward Martinez
+ * @brief Source file for interned currency and product symbols.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "SymbolTable.h"
+/** @cond STDINCLUDES */
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Process-wide table.
+ */
+SymbolTable & SymbolTable::instance()
+{
+    static SymbolTable table;
+    return table;
+}
+
+/**
+ * @brief Id of a currency, assigning the next free id on first use.
+ */
+CurrencyId SymbolTable::currency(const std::string & name)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return this->intern(name);
+}
+
+/**
+ * @brief Id of a currency without interning it.
+ * @return The id, or SYMBOL_INVALID_ID if the currency was never seen.
+ */
+CurrencyId SymbolTable::findCurrency(const std::string & name) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = currencyIds.find(name);
+    return (it == currencyIds.end()) ? SYMBOL_INVALID_ID : it->second;
+}
+
+/**
+ * @brief Base and quote currency ids of a product, e.g. "ETH/BTC" -> {ETH, BTC}.
+ *
+ * The product string is split the first time it is seen; later calls are a single hash lookup.
+ * Pairs never change once interned, so each thread also keeps the pairs it has looked up and
+ * threads resolving products concurrently (e.g. parallel backtests) do not contend on the lock.
+ */
+ProductPair SymbolTable::product(const std::string & name)
+{
+    thread_local std::unordered_map<std::string, ProductPair> seen;
+    auto hit = seen.find(name);
+    if(hit != seen.end()) return hit->second;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = products.find(name);
+    if(it != products.end())
+    {
+        seen.emplace(name, it->second);
+        return it->second;
+    }
+
+    std::size_t slash = name.find('/');
+    if((std::string::npos == slash) || (0 == slash) || (slash + 1 >= name.size()) ||
+       (std::string::npos != name.find('/', slash + 1)))
+    {
+        throw std::runtime_error(std::string("SymbolTable::product - Malformed product: ") + name);
+    }
+    ProductPair pair{this->intern(name.substr(0, slash)), this->intern(name.substr(slash + 1))};
+    products.emplace(name, pair);
+    seen.emplace(name, pair);
+    return pair;
+}
+
+/**
+ * @brief Name of an interned currency. Empty for unknown ids.
+ */
+std::string SymbolTable::currencyName(CurrencyId id) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return (id < currencyNames.size()) ? currencyNames[id] : std::string{};
+}
+
+/**
+ * @brief Number of currencies interned so far; every id is below this value.
+ */
+std::size_t SymbolTable::currencyCount() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return currencyNames.size();
+}
+
+/**
+ * @brief Finds or assigns a currency id. Caller holds the lock.
+ */
+CurrencyId SymbolTable::intern(const std::string & name)
+{
+    auto it = currencyIds.find(name);
+    if(it != currencyIds.end()) return it->second;
+    CurrencyId id = (CurrencyId)currencyNames.size();
+    currencyNames.push_back(name);
+    currencyIds.emplace(name, id);
+    return id;
+}
@@ -0,0 +1,79 @@
+/*  
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file SymbolTable.h
+ * @author Edward Martinez
+ * @brief Header file for interned currency and product symbols.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define SYMBOL_INVALID_ID 0xFFFFFFFFu
+/********************************************//**
+ *  Type Definitions
+ ***********************************************/
+typedef std::uint32_t CurrencyId;
+
+/*! @struct ProductPair
+    @brief A product such as "ETH/BTC" split into its base (ETH) and quote (BTC) currency ids.
+*/
+struct ProductPair
+{
+    CurrencyId base;
+    CurrencyId quote;
+};
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @class SymbolTable
+    @brief Process-wide interning of currency names and product pairs.
+
+    Currencies get small, dense ids in order of first use, so balances can be kept in arrays
+    indexed by id. Products are split once, on first use, and later lookups return the cached
+    pair. Ids are never reused or removed.
+*/
+class SymbolTable
+{
+    public:
+        static SymbolTable & instance();
+        CurrencyId currency(const std::string & name);
+        CurrencyId findCurrency(const std::string & name) const;
+        ProductPair product(const std::string & name);
+        std::string currencyName(CurrencyId id) const;
+        std::size_t currencyCount() const;
+    private:
+        SymbolTable() = default;
+        CurrencyId intern(const std::string & name);
+        mutable std::mutex lock;
+        std::unordered_map<std::string, CurrencyId> currencyIds;
+        std::deque<std::string> currencyNames;
+        std::unordered_map<std::string, ProductPair> products;
+};
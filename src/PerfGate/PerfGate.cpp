@@ -0,0 +1,409 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file PerfGate.cpp
+ * @author Edward Martinez
+ * @brief Source file for the performance regression gate.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "PerfGate.h"
+#include "CsvReader.h"
+#include "DataGenerator.h"
+#include "LatencyHistogram.h"
+#include "OrderBook.h"
+#include "ReplayRunner.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <sys/resource.h>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define PERF_TOL_THROUGHPUT 0.30
+#define PERF_TOL_P50        0.30
+#define PERF_TOL_TAIL       0.60 /**< p99 and hot-path loops are noisier on shared machines. */
+#define PERF_TOL_RSS        0.20
+#define PERF_REPEATS        5    /**< Hot-path loops are repeated and the median kept. */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    PerfMetric metric(const std::string & name, double value, bool higherIsBetter, double tolerance)
+    {
+        PerfMetric m;
+        m.name           = name;
+        m.value          = value;
+        m.higherIsBetter = higherIsBetter;
+        m.tolerance      = tolerance;
+        return m;
+    }
+
+    /**
+     * @brief Median over PERF_REPEATS runs of the nanoseconds per call of a loop of n calls.
+     */
+    template<typename F>
+    double nsPerCall(std::size_t n, F body)
+    {
+        std::vector<double> runs;
+        for(int r = 0; r < PERF_REPEATS; r++)
+        {
+            Clock::time_point start = Clock::now();
+            for(std::size_t i = 0; i < n; i++) body(i);
+            runs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double)n);
+        }
+        std::sort(runs.begin(), runs.end());
+        return runs[runs.size() / 2];
+    }
+
+    /*! Minimal JSON reader covering the objects, strings and numbers used by result files. */
+    class JsonReader
+    {
+        public:
+            explicit JsonReader(const std::string & text) : s(text), pos(0) {}
+
+            /** Reads {"metrics": {"<name>": {"value": x, "better": "higher", "tolerance": t}, ...}} */
+            std::vector<PerfMetric> readMetrics()
+            {
+                std::vector<PerfMetric> out;
+                expect('{');
+                while(!consume('}'))
+                {
+                    std::string key = readString();
+                    expect(':');
+                    if("metrics" == key)
+                    {
+                        expect('{');
+                        while(!consume('}'))
+                        {
+                            PerfMetric m;
+                            m.name = readString();
+                            expect(':');
+                            expect('{');
+                            while(!consume('}'))
+                            {
+                                std::string field = readString();
+                                expect(':');
+                                if("value" == field)          m.value = readNumber();
+                                else if("tolerance" == field) m.tolerance = readNumber();
+                                else if("better" == field)    m.higherIsBetter = ("higher" == readString());
+                                else skipValue();
+                                consume(',');
+                            }
+                            out.push_back(m);
+                            consume(',');
+                        }
+                    }
+                    else skipValue();
+                    consume(',');
+                }
+                return out;
+            }
+        private:
+            void skipSpace()
+            {
+                while((pos < s.size()) && std::isspace((unsigned char)s[pos])) pos++;
+            }
+            bool consume(char c)
+            {
+                skipSpace();
+                if((pos < s.size()) && (s[pos] == c))
+                {
+                    pos++;
+                    return true;
+                }
+                return false;
+            }
+            void expect(char c)
+            {
+                if(!consume(c)) fail(std::string("expected '") + c + "'");
+            }
+            std::string readString()
+            {
+                expect('"');
+                std::string out;
+                while((pos < s.size()) && (s[pos] != '"'))
+                {
+                    if(('\\' == s[pos]) && (pos + 1 < s.size())) pos++;
+                    out += s[pos++];
+                }
+                expect('"');
+                return out;
+            }
+            double readNumber()
+            {
+                skipSpace();
+                const char * begin = s.c_str() + pos;
+                char * end = nullptr;
+                double v = std::strtod(begin, &end);
+                if(end == begin) fail("expected a number");
+                pos += (std::size_t)(end - begin);
+                return v;
+            }
+            void skipValue()
+            {
+                skipSpace();
+                if(pos >= s.size()) fail("unexpected end");
+                if('"' == s[pos])
+                {
+                    readString();
+                }
+                else if(('{' == s[pos]) || ('[' == s[pos]))
+                {
+                    char close = ('{' == s[pos]) ? '}' : ']';
+                    pos++;
+                    while(!consume(close))
+                    {
+                        if('}' == close)
+                        {
+                            readString();
+                            expect(':');
+                        }
+                        skipValue();
+                        consume(',');
+                    }
+                }
+                else
+                {
+                    while((pos < s.size()) && (std::string(",}] \t\r\n").find(s[pos]) == std::string::npos)) pos++;
+                }
+            }
+            void fail(const std::string & what)
+            {
+                throw std::runtime_error("PerfGate::readJson - " + what + " at offset " + std::to_string(pos));
+            }
+            const std::string & s;
+            std::size_t pos;
+    };
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ */
+PerfGate::PerfGate(const PerfGateOptions & options)
+: options(options)
+{
+}
+
+/**
+ * @brief Generates the data set, replays it and measures every metric.
+ *
+ * The data set is written next to the results file and removed afterwards.
+ * @return Measured metrics.
+ */
+std::vector<PerfMetric> PerfGate::run()
+{
+    std::vector<PerfMetric> out;
+    std::string dataset = options.outPath + ".csv";
+
+    DataGenOptions gen;
+    gen.frames         = options.frames;
+    gen.ordersPerFrame = options.ordersPerFrame;
+    gen.seed           = 1;
+    DataGenerator{gen}.write(dataset);
+
+    //End-to-end replay, with the latency histograms of this run only.
+    LatencyRegistry::instance().reset();
+    ReplayOptions replay;
+    replay.datasets.push_back(dataset);
+    ReplayStats stats = ReplayRunner{replay}.run();
+    if(0 == stats.datasets)
+    {
+        std::remove(dataset.c_str());
+        throw std::runtime_error(std::string("PerfGate::run - Replay of the generated data set failed."));
+    }
+    out.push_back(metric("replay_orders_per_s", stats.orders / stats.replaySeconds, true, PERF_TOL_THROUGHPUT));
+    out.push_back(metric("replay_ticks_per_s",  stats.ticks  / stats.replaySeconds, true, PERF_TOL_THROUGHPUT));
+    out.push_back(metric("load_rows_per_s",     stats.orders / stats.loadSeconds,   true, PERF_TOL_THROUGHPUT));
+
+    double perNano = LatencyClock::ticksPerNano();
+    const LatencyOp ops[] = {LatencyOp::tick, LatencyOp::match, LatencyOp::getOrders};
+    for(LatencyOp op : ops)
+    {
+        LatencyHistogram h = LatencyRegistry::instance().merged(op);
+        if(0 == h.count()) continue; //Instrumentation compiled out.
+        std::string name = LatencyRegistry::opName(op);
+        out.push_back(metric(name + "_p50_ns", (double)h.percentile(50.0) / perNano, false, PERF_TOL_P50));
+        out.push_back(metric(name + "_p99_ns", (double)h.percentile(99.0) / perNano, false, PERF_TOL_TAIL));
+    }
+
+    this->measureHotPaths(dataset, out);
+    std::remove(dataset.c_str());
+
+    rusage usage;
+    if(0 == getrusage(RUSAGE_SELF, &usage))
+    {
+        out.push_back(metric("peak_rss_kb", (double)usage.ru_maxrss, false, PERF_TOL_RSS));
+    }
+    return out;
+}
+
+/**
+ * @brief Times the individual operations the replay is built from, on the middle timeframe of the data set.
+ */
+void PerfGate::measureHotPaths(const std::string & dataset, std::vector<PerfMetric> & out)
+{
+    OrderBook book{dataset};
+    std::string ts = book.getEarliestTime();
+    for(std::size_t i = 0; i < options.frames / 2; i++) ts = book.getNextTime(ts);
+    std::vector<std::string> products = book.getKnownProducts();
+
+    out.push_back(metric("hot_match_ns", nsPerCall(500, [&](std::size_t i)
+    {
+        book.matchAsksToBids(products[i % products.size()], ts);
+    }), false, PERF_TOL_TAIL));
+
+    out.push_back(metric("hot_getorders_ns", nsPerCall(2000, [&](std::size_t i)
+    {
+        book.getOrders((i & 1) ? OrderBookType::ask : OrderBookType::bid, products[i % products.size()], ts);
+    }), false, PERF_TOL_TAIL));
+
+    std::vector<std::string> tokens = CsvReader::tokenise("2020/03/17 17:01:24.884492,ETH/BTC,bid,0.02187308,7.44564869", ',');
+    out.push_back(metric("hot_parse_ns", nsPerCall(20000, [&](std::size_t)
+    {
+        OrderBookEntry::stringsToOBE(tokens);
+    }), false, PERF_TOL_TAIL));
+
+    OrderBookEntry order{ts, products[0], OrderBookType::bid, 0.02, 1.0};
+    book.insertOrder(order);
+    out.push_back(metric("hot_insert_ns", nsPerCall(20000, [&](std::size_t)
+    {
+        book.insertOrder(order);
+    }), false, PERF_TOL_TAIL));
+}
+
+/**
+ * @brief Compares results with a baseline and reports every metric.
+ *
+ * A metric regresses when it moves in its bad direction by more than the baseline tolerance.
+ * Metrics missing on either side are reported but never fail the gate.
+ * @return Number of regressions.
+ */
+std::size_t PerfGate::compare(const std::vector<PerfMetric> & results,
+                              const std::vector<PerfMetric> & baseline,
+                              std::ostream & report)
+{
+    std::size_t regressions = 0;
+    report << std::left << std::setw(22) << "Metric" << std::right << std::setw(16) << "Baseline"
+           << std::setw(16) << "Current" << std::setw(10) << "Change" << "  Status\n";
+    for(const PerfMetric & base : baseline)
+    {
+        auto it = std::find_if(results.begin(), results.end(),
+                               [&](const PerfMetric & r){ return r.name == base.name; });
+        report << std::left << std::setw(22) << base.name << std::right << std::fixed << std::setprecision(1)
+               << std::setw(16) << base.value;
+        if(it == results.end())
+        {
+            report << std::setw(16) << "-" << std::setw(10) << "-" << "  MISSING\n";
+            continue;
+        }
+        double change = (base.value != 0.0) ? (it->value - base.value) / base.value : 0.0;
+        double worse  = base.higherIsBetter ? -change : change;
+        bool regressed = worse > base.tolerance;
+        if(regressed) regressions++;
+        report << std::setw(16) << it->value << std::setw(9) << change * 100.0 << "%"
+               << (regressed ? "  REGRESSION" : "  ok") << '\n';
+    }
+    for(const PerfMetric & r : results)
+    {
+        auto it = std::find_if(baseline.begin(), baseline.end(),
+                               [&](const PerfMetric & b){ return r.name == b.name; });
+        if(it == baseline.end()) report << std::left << std::setw(22) << r.name << std::right << "  (not in baseline)\n";
+    }
+    return regressions;
+}
+
+/**
+ * @brief Writes metrics in the results/baseline JSON format.
+ */
+void PerfGate::writeJson(std::ostream & os, const std::vector<PerfMetric> & metrics)
+{
+    os << "{\n  \"metrics\": {\n" << std::setprecision(6) << std::fixed;
+    for(std::size_t i = 0; i < metrics.size(); i++)
+    {
+        const PerfMetric & m = metrics[i];
+        os << "    \"" << m.name << "\": {\"value\": " << m.value
+           << ", \"better\": \"" << (m.higherIsBetter ? "higher" : "lower")
+           << "\", \"tolerance\": " << m.tolerance << "}" << ((i + 1 < metrics.size()) ? "," : "") << '\n';
+    }
+    os << "  }\n}\n";
+}
+
+/**
+ * @brief Reads metrics from a results/baseline JSON file.
+ */
+std::vector<PerfMetric> PerfGate::readJson(const std::string & path)
+{
+    std::ifstream in{path};
+    if(!in) throw std::runtime_error(std::string("PerfGate::readJson - Cannot open ") + path);
+    std::stringstream text;
+    text << in.rdbuf();
+    std::string s = text.str();
+    return JsonReader{s}.readMetrics();
+}
+
+/**
+ * @brief Parses command line arguments.
+ * @return TRUE if the arguments are valid.
+ */
+bool PerfGate::parseArgs(int argc, char ** argv, PerfGateOptions & options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--baseline" == arg))              options.baselinePath   = argv[++i];
+        else if(hasValue && ("--out" == arg))              options.outPath        = argv[++i];
+        else if(hasValue && ("--frames" == arg))           options.frames         = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--orders-per-frame" == arg)) options.ordersPerFrame = std::strtoull(argv[++i], nullptr, 10);
+        else if("--update-baseline" == arg)                options.updateBaseline = true;
+        else return false;
+    }
+    return (options.frames > 0) && (options.ordersPerFrame > 0) &&
+           (!options.updateBaseline || !options.baselinePath.empty());
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void PerfGate::printUsage(std::ostream & os, const char * program)
+{
+    os << "Usage: " << program << " [--baseline <json>] [--out <json>] [--frames N] [--orders-per-frame N] [--update-baseline]\n"
+       << "   --baseline <json>     Compare against this baseline; exit 3 on regression\n"
+       << "   --out <json>          Results file (default perf_results.json)\n"
+       << "   --frames N            Timeframes in the generated data set (default 5000)\n"
+       << "   --orders-per-frame N  Orders per generated timeframe (default 100)\n"
+       << "   --update-baseline     Write the results to the baseline instead of comparing\n";
+}
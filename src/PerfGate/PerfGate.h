@@ -0,0 +1,82 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file PerfGate.h
+ * @author Edward Martinez
+ * @brief Header file for the performance regression gate.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct PerfMetric
+    @brief One measured value and how it may move before it counts as a regression.
+*/
+struct PerfMetric
+{
+    std::string name;
+    double value          = 0.0;
+    bool higherIsBetter   = true;
+    double tolerance      = 0.25; /**< Allowed relative change in the bad direction, e.g. 0.25 = 25%. */
+};
+
+/*! @struct PerfGateOptions
+    @brief Command line configuration of a gate run.
+*/
+struct PerfGateOptions
+{
+    std::string baselinePath;          /**< Baseline to compare against; empty only records results. */
+    std::string outPath = "perf_results.json";
+    std::size_t frames = 5000;         /**< Timeframes in the generated data set. */
+    std::size_t ordersPerFrame = 100;  /**< Orders per generated timeframe. */
+    bool updateBaseline = false;       /**< Overwrite the baseline with the results instead of comparing. */
+};
+
+/*! @class PerfGate
+    @brief Measures replay throughput, latency percentiles, hot-path timings and peak RSS on a generated data set.
+
+    Results are written as JSON in the same format as the checked-in baseline, so a baseline is
+    refreshed by copying a results file (or running with --update-baseline).
+*/
+class PerfGate
+{
+    public:
+        PerfGate(const PerfGateOptions & options);
+        std::vector<PerfMetric> run();
+        static std::size_t compare(const std::vector<PerfMetric> & results,
+                                   const std::vector<PerfMetric> & baseline,
+                                   std::ostream & report);
+        static void writeJson(std::ostream & os, const std::vector<PerfMetric> & metrics);
+        static std::vector<PerfMetric> readJson(const std::string & path);
+        static bool parseArgs(int argc, char ** argv, PerfGateOptions & options);
+        static void printUsage(std::ostream & os, const char * program);
+    private:
+        void measureHotPaths(const std::string & dataset, std::vector<PerfMetric> & out);
+        PerfGateOptions options;
+};
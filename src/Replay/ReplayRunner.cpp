@@ -0,0 +1,311 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ReplayRunner.cpp
+ * @author Edward Martinez
+ * @brief Source file for headless, full-speed replay of order data sets.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "ReplayRunner.h"
+#include "UserMenuIF.h"
+#include "LatencyHistogram.h"
+#include "MetricsExporter.h"
+#include "MarketDataFeed.h"
+#include "VenueSet.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    double secondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double perSecond(std::size_t count, double seconds)
+    {
+        return (seconds > 0.0) ? (double)count / seconds : 0.0;
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param options Data sets and limits for the replay.
+ */
+ReplayRunner::ReplayRunner(const ReplayOptions & options)
+: options(options)
+{
+}
+
+/**
+ * @brief Replays every configured data set in turn.
+ *
+ * Each data set is loaded into its own MerkelMain and processNext() is called for each
+ * timeframe, from the earliest timestamp until the simulation clock wraps around.
+ * Data sets that fail to load are reported and skipped. With options.venues the data sets
+ * are replayed side by side instead. @see runVenues()
+ * @return Totals over all data sets.
+ */
+ReplayStats ReplayRunner::run()
+{
+    ReplayStats stats;
+    Clock::time_point wallStart = Clock::now();
+    if(!options.logPath.empty() && !Logger::instance().open(options.logPath))
+    {
+        std::cerr << "ReplayRunner::run - Could not open log file " << options.logPath << '\n';
+    }
+    MetricsExporter exporter;
+    if(!options.metricsTarget.empty())
+    {
+        try
+        {
+            exporter.start(options.metricsTarget);
+        }
+        catch(const std::exception &e)
+        {
+            std::cerr << "ReplayRunner::run - Metrics export disabled: " << e.what() << '\n';
+        }
+    }
+
+    MarketDataPublisher feed;
+    if(!options.feedName.empty() && !options.venues)
+    {
+        try
+        {
+            feed.open(options.feedName);
+        }
+        catch(const std::exception &e)
+        {
+            std::cerr << "ReplayRunner::run - Market data feed disabled: " << e.what() << '\n';
+        }
+    }
+
+    if(options.venues) this->runVenues(stats);
+    else for(const std::string & path : options.datasets)
+    {
+        Clock::time_point loadStart = Clock::now();
+        MerkelMain app{path};
+        app.setVerbose(options.verbose);
+        app.setSettlementThreads(options.settleThreads);
+        if(feed.isOpen()) app.setMarketData(&feed);
+        app.init(true);
+        stats.loadSeconds += secondsSince(loadStart);
+
+        if(MerkelState::READY != app.getCurrentState())
+        {
+            std::cerr << "ReplayRunner::run - Skipping data set " << path << '\n';
+            continue;
+        }
+        stats.datasets++;
+
+        Clock::time_point replayStart = Clock::now();
+        std::size_t ticks = 0;
+        std::string previous;
+        do
+        {
+            previous = app.getCurrentTime();
+            TickStats tick = app.processNext();
+            stats.orders += tick.orders;
+            stats.fills  += tick.sales;
+            stats.settled += tick.settled;
+            ticks++;
+        } while((app.getCurrentTime() > previous) && ((0 == options.maxTicks) || (ticks < options.maxTicks)));
+        stats.ticks += ticks;
+        stats.accounts += app.getLedger().getAccountCount();
+        stats.replaySeconds += secondsSince(replayStart);
+    }
+    Logger::instance().flush();
+    stats.wallSeconds = secondsSince(wallStart);
+
+    if(!options.latencyPath.empty() && !LatencyRegistry::instance().dump(options.latencyPath))
+    {
+        std::cerr << "ReplayRunner::run - Could not write latency histograms to " << options.latencyPath << '\n';
+    }
+    return stats;
+}
+
+/**
+ * @brief Replays every configured data set as a venue of one VenueSet.
+ *
+ * The data sets are loaded concurrently and stepped on the merged clock, venues with
+ * coinciding timestamps in parallel. Load and replay times are wall times of the whole set.
+ * With a feed name, venue i publishes to its own feed "<name>.<i>", since a feed has a single
+ * writer.
+ */
+void ReplayRunner::runVenues(ReplayStats & stats)
+{
+    Clock::time_point loadStart = Clock::now();
+    VenueSet venues{options.venueThreads};
+    stats.datasets = venues.load(options.datasets);
+    venues.setTickLimit(options.maxTicks);
+    std::vector<std::unique_ptr<MarketDataPublisher>> feeds;
+    for(std::size_t i = 0; i < venues.getVenueCount(); i++)
+    {
+        MerkelMain & app = *venues.getVenue(i).engine;
+        app.setVerbose(options.verbose);
+        app.setSettlementThreads(options.settleThreads);
+        if(options.feedName.empty()) continue;
+        std::string name = options.feedName + "." + std::to_string(i);
+        try
+        {
+            feeds.emplace_back(new MarketDataPublisher);
+            feeds.back()->open(name);
+            app.setMarketData(feeds.back().get());
+        }
+        catch(const std::exception &e)
+        {
+            std::cerr << "ReplayRunner::runVenues - Market data feed " << name << " disabled: " << e.what() << '\n';
+        }
+    }
+    stats.loadSeconds += secondsSince(loadStart);
+    if(stats.datasets < options.datasets.size())
+    {
+        std::cerr << "ReplayRunner::runVenues - Skipped " << (options.datasets.size() - stats.datasets) << " data set(s)\n";
+    }
+
+    Clock::time_point replayStart = Clock::now();
+    while(!venues.isDone())
+    {
+        VenueStepStats step = venues.step();
+        stats.orders  += step.orders;
+        stats.fills   += step.sales;
+        stats.settled += step.settled;
+        stats.clockSteps++;
+    }
+    for(std::size_t i = 0; i < venues.getVenueCount(); i++)
+    {
+        stats.ticks    += venues.getVenue(i).ticks;
+        stats.accounts += venues.getVenue(i).engine->getLedger().getAccountCount();
+    }
+    stats.replaySeconds += secondsSince(replayStart);
+}
+
+/**
+ * @brief Parses command line arguments into replay options.
+ * @return TRUE if the arguments are valid and at least one data set was given.
+ */
+bool ReplayRunner::parseArgs(int argc, char ** argv, ReplayOptions & options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        if(("--max-ticks" == arg) && (i + 1 < argc))
+        {
+            options.maxTicks = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if(("--latency" == arg) && (i + 1 < argc))
+        {
+            options.latencyPath = argv[++i];
+        }
+        else if(("--metrics" == arg) && (i + 1 < argc))
+        {
+            options.metricsTarget = argv[++i];
+        }
+        else if(("--log" == arg) && (i + 1 < argc))
+        {
+            options.logPath = argv[++i];
+        }
+        else if(("--feed" == arg) && (i + 1 < argc))
+        {
+            options.feedName = argv[++i];
+        }
+        else if(("--settle-threads" == arg) && (i + 1 < argc))
+        {
+            options.settleThreads = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if(("--venue-threads" == arg) && (i + 1 < argc))
+        {
+            options.venueThreads = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if("--venues" == arg)
+        {
+            options.venues = true;
+        }
+        else if("--verbose" == arg)
+        {
+            options.verbose = true;
+        }
+        else if((arg.size() > 1) && ('-' == arg[0]))
+        {
+            return false;
+        }
+        else
+        {
+            options.datasets.push_back(arg);
+        }
+    }
+    return !options.datasets.empty();
+}
+
+/**
+ * @brief Prints command line usage.
+ */
+void ReplayRunner::printUsage(std::ostream & os, const char * program)
+{
+    os << "Usage: " << program << " [--max-ticks N] [--verbose] [--latency <path>] [--metrics <target>] [--settle-threads N] [--log <path>] [--feed <name>] [--venues [--venue-threads N]] <dataset.csv> [dataset.csv ...]\n"
+       << "   --max-ticks N       Stop each data set after N timeframes (default: all)\n"
+       << "   --verbose           Print per-timeframe matching output\n"
+       << "   --latency <path>    Write latency histograms of the replay to <path>\n"
+       << "   --metrics <target>  Export Prometheus metrics every second to a file or unix:<path>\n"
+       << "   --settle-threads N  Threads applying large netted ledger settlements (default 1)\n"
+       << "   --log <path>        Write log output to <path> instead of the console\n"
+       << "   --feed <name>       Publish book changes and trades to shared memory (see MerkleRex_FeedReader)\n"
+       << "   --venues            Replay the data sets side by side as venues on one merged clock\n"
+       << "   --venue-threads N   Threads loading and stepping venues (default: all hardware threads)\n";
+}
+
+/**
+ * @brief Prints replay totals and throughput.
+ */
+void ReplayRunner::printStats(std::ostream & os, const ReplayStats & stats)
+{
+    os << std::fixed << std::setprecision(3)
+       << "Replay summary\n"
+       << "   Data sets    : " << stats.datasets << '\n'
+       << "   Orders       : " << stats.orders << '\n'
+       << "   Ticks        : " << stats.ticks << '\n'
+       << "   Fills        : " << stats.fills << '\n'
+       << "   Settled      : " << stats.settled << '\n'
+       << "   Accounts     : " << stats.accounts << '\n';
+    if(stats.clockSteps > 0) os << "   Clock steps  : " << stats.clockSteps << '\n';
+    os << "   Load time    : " << stats.loadSeconds << " s\n"
+       << "   Replay time  : " << stats.replaySeconds << " s\n"
+       << "   Wall time    : " << stats.wallSeconds << " s\n"
+       << std::setprecision(0)
+       << "   Orders/s     : " << perSecond(stats.orders, stats.replaySeconds) << '\n'
+       << "   Ticks/s      : " << perSecond(stats.ticks,  stats.replaySeconds) << '\n'
+       << "   Fills/s      : " << perSecond(stats.fills,  stats.replaySeconds) << '\n';
+}
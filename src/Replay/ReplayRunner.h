@@ -0,0 +1,86 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ReplayRunner.h
+ * @author Edward Martinez
+ * @brief Header file for headless, full-speed replay of order data sets.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct ReplayOptions
+    @brief Command line configuration of a replay.
+*/
+struct ReplayOptions
+{
+    std::vector<std::string> datasets;
+    std::size_t maxTicks = 0;  /**< Per data set limit on timeframes; 0 replays every timeframe. */
+    bool verbose = false;      /**< Print the usual per-timeframe matching output. */
+    std::string latencyPath;   /**< If set, latency histograms are written here after the replay. */
+    std::string metricsTarget; /**< If set, metrics are exported here during the replay. @see MetricsExporter */
+    unsigned settleThreads = 1; /**< Threads applying each tick's ledger settlement. */
+    std::string logPath;       /**< If set, log output (e.g. --verbose matching) goes to this file. */
+    std::string feedName;      /**< If set, book changes and trades are published to this shared memory feed. */
+    bool venues = false;       /**< Replay the data sets side by side as venues on one merged clock. @see VenueSet */
+    unsigned venueThreads = 0; /**< Threads loading and stepping venues; 0 uses every hardware thread. */
+};
+
+/*! @struct ReplayStats
+    @brief Totals gathered over every replayed data set.
+*/
+struct ReplayStats
+{
+    std::size_t datasets = 0;
+    std::size_t orders   = 0;
+    std::size_t ticks    = 0;
+    std::size_t fills    = 0;
+    std::size_t settled  = 0;   /**< Fills booked to ledger accounts. */
+    std::size_t accounts = 0;   /**< Ledger accounts at the end of each data set, summed. */
+    std::size_t clockSteps = 0; /**< Merged clock timestamps processed, in a venue replay. */
+    double loadSeconds   = 0.0;
+    double replaySeconds = 0.0;
+    double wallSeconds   = 0.0;
+};
+
+/*! @class ReplayRunner
+    @brief Steps MerkelMain through every timeframe of one or more data sets without user interaction.
+*/
+class ReplayRunner
+{
+    public:
+        ReplayRunner(const ReplayOptions & options);
+        ReplayStats run();
+        static bool parseArgs(int argc, char ** argv, ReplayOptions & options);
+        static void printUsage(std::ostream & os, const char * program);
+        static void printStats(std::ostream & os, const ReplayStats & stats);
+    private:
+        void runVenues(ReplayStats & stats);
+        ReplayOptions options;
+};
@@ -0,0 +1,318 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ScriptRunner.cpp
+ * @author Edward Martinez
+ * @brief Source file for the non-interactive command script runner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "ScriptRunner.h"
+#include "UserMenuIF.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    const ScriptCommand allCommands[SCRIPT_NUM_COMMANDS] = {ScriptCommand::ask, ScriptCommand::bid, ScriptCommand::cancel,
+                                                            ScriptCommand::next, ScriptCommand::stats, ScriptCommand::wallet};
+
+    double secondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    bool isSpace(char c)
+    {
+        return (' ' == c) || ('\t' == c) || ('\r' == c);
+    }
+
+    /**
+     * @brief TRUE if [begin, end) is exactly the given word.
+     */
+    bool isWord(const char * begin, const char * end, const char * word)
+    {
+        std::size_t n = std::strlen(word);
+        return ((std::size_t)(end - begin) == n) && (0 == std::memcmp(begin, word, n));
+    }
+
+    /**
+     * @brief Parses one number of [begin, end), which must contain nothing else but surrounding blanks.
+     */
+    bool parseNumber(const char * begin, const char * end, double & value)
+    {
+        char buf[64];
+        std::size_t n = (std::size_t)(end - begin);
+        if((0 == n) || (n >= sizeof(buf))) return false;
+        std::memcpy(buf, begin, n);
+        buf[n] = '\0';
+        char * stop = nullptr;
+        value = std::strtod(buf, &stop);
+        while(isSpace(*stop)) stop++;
+        return (stop != buf) && ('\0' == *stop);
+    }
+
+    /**
+     * @brief Parses one order id of [begin, end): decimal digits and surrounding blanks only.
+     *
+     * Ids carry a hold generation in their high 32 bits (see Wallet), so they are read as
+     * 64-bit integers; a double would lose the low bits of large ids.
+     */
+    bool parseOrderId(const char * begin, const char * end, OrderId & value)
+    {
+        char buf[32];
+        while((begin < end) && isSpace(*begin)) begin++;
+        std::size_t n = (std::size_t)(end - begin);
+        if((0 == n) || (n >= sizeof(buf)) || (*begin < '0') || (*begin > '9')) return false;
+        std::memcpy(buf, begin, n);
+        buf[n] = '\0';
+        char * stop = nullptr;
+        errno = 0;
+        value = (OrderId)std::strtoull(buf, &stop, 10);
+        if(ERANGE == errno) return false;
+        while(isSpace(*stop)) stop++;
+        return '\0' == *stop;
+    }
+
+    /**
+     * @brief Reads the command word at the start of a line.
+     * @param pos Start of the line; on success, moved past the word and the blanks after it.
+     * @return FALSE if the word is not a known command.
+     */
+    bool parseCommand(const char * & pos, const char * end, ScriptCommand & command)
+    {
+        const char * word = pos;
+        while((pos < end) && !isSpace(*pos)) pos++;
+        bool known = false;
+        for(ScriptCommand c : allCommands)
+        {
+            if(isWord(word, pos, ScriptRunner::commandName(c)))
+            {
+                command = c;
+                known   = true;
+                break;
+            }
+        }
+        while((pos < end) && isSpace(*pos)) pos++;
+        return known;
+    }
+
+    /**
+     * @brief Parses "PRODUCT,PRICE,AMOUNT" into an order.
+     */
+    bool parseOrder(const char * begin, const char * end, OrderBookEntry & order)
+    {
+        const char * c1 = (const char *)std::memchr(begin, ',', (std::size_t)(end - begin));
+        if(nullptr == c1) return false;
+        const char * c2 = (const char *)std::memchr(c1 + 1, ',', (std::size_t)(end - c1 - 1));
+        if(nullptr == c2) return false;
+
+        const char * p = c1;
+        while((p > begin) && isSpace(p[-1])) p--;
+        if(p == begin) return false;
+        order._product.assign(begin, p);
+        return parseNumber(c1 + 1, c2, order._price) && parseNumber(c2 + 1, end, order._amount);
+    }
+}
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param app Simulation the script drives. It should be initialised (MerkelMain::init(true)).
+ */
+ScriptRunner::ScriptRunner(MerkelMain & app)
+: app(app)
+{
+}
+
+/**
+ * @brief Runs every command of a script.
+ *
+ * Verbose output is turned off; only the stats and wallet commands print.
+ * A line that cannot be run is counted and skipped.
+ * @return Per-command counts and timings.
+ */
+ScriptStats ScriptRunner::run(std::istream & in)
+{
+    ScriptStats stats;
+    Clock::time_point wallStart = Clock::now();
+    app.setVerbose(false);
+
+    OrderBookEntry order{"", "", OrderBookType::ask, 0.0, 0.0}; //Reused, so parsing keeps its string buffers.
+    std::vector<char> block(SCRIPT_BLOCK_BYTES);
+    std::size_t kept = 0;                       //Bytes of an unfinished line carried over from the previous block.
+    bool inRun = false;
+    ScriptCommand runCommand = ScriptCommand::ask;
+    Clock::time_point runStart;
+
+    while(true)
+    {
+        if(kept == block.size()) block.resize(block.size() * 2); //A line longer than the block.
+        in.read(block.data() + kept, (std::streamsize)(block.size() - kept));
+        std::size_t got = (std::size_t)in.gcount();
+        bool last = (0 == got);
+        stats.bytes += got;
+
+        const char * pos = block.data();
+        const char * end = block.data() + kept + got;
+        while(pos < end)
+        {
+            const char * eol = (const char *)std::memchr(pos, '\n', (std::size_t)(end - pos));
+            if(nullptr == eol)
+            {
+                if(!last) break;
+                eol = end;
+            }
+            const char * line = pos;
+            pos = eol + 1;
+            while((line < eol) && isSpace(*line)) line++;
+            if((line == eol) || ('#' == *line)) continue;
+            stats.lines++;
+
+            ScriptCommand command;
+            if(!parseCommand(line, eol, command))
+            {
+                stats.unknown++;
+                continue;
+            }
+            if(!inRun || (command != runCommand))
+            {
+                Clock::time_point now = Clock::now();
+                if(inRun) stats.seconds[(std::size_t)runCommand] += std::chrono::duration<double>(now - runStart).count();
+                inRun      = true;
+                runCommand = command;
+                runStart   = now;
+            }
+            stats.count[(std::size_t)command]++;
+            if(!this->execute(command, line, eol, order)) stats.rejected[(std::size_t)command]++;
+        }
+        if(inRun)
+        {
+            stats.seconds[(std::size_t)runCommand] += secondsSince(runStart);
+            inRun = false;
+        }
+        app.commitJournal();                    //Group commit per block.
+        if(last) break;
+
+        kept = (std::size_t)(end - pos);
+        std::memmove(block.data(), pos, kept);
+    }
+    Logger::instance().flush();
+    stats.wallSeconds = secondsSince(wallStart);
+    return stats;
+}
+
+/**
+ * @brief Runs one command.
+ * @param args Arguments after the command word, up to the end of the line.
+ * @param order Scratch order for ask and bid.
+ * @return FALSE if the command was rejected.
+ */
+bool ScriptRunner::execute(ScriptCommand command, const char * args, const char * end, OrderBookEntry & order)
+{
+    switch(command)
+    {
+        case ScriptCommand::ask:
+        case ScriptCommand::bid:
+            if(!parseOrder(args, end, order)) return false;
+            order._OrderType = (ScriptCommand::ask == command) ? OrderBookType::ask : OrderBookType::bid;
+            try
+            {
+                return ORDER_ID_NONE != app.submitOrder(order);
+            }
+            catch(const std::exception &)
+            {
+                return false;                   //E.g. a product that is not BASE/QUOTE.
+            }
+        case ScriptCommand::cancel:
+        {
+            OrderId id = ORDER_ID_NONE;
+            if(!parseOrderId(args, end, id) || (ORDER_ID_NONE == id)) return false;
+            return app.cancelUserOrder(id);
+        }
+        case ScriptCommand::next:
+            app.processNext();
+            return true;
+        case ScriptCommand::stats:
+            app.printExchangeStats();
+            return true;
+        case ScriptCommand::wallet:
+            app.printWallet();
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Prints the per-command counts and throughput of a script run.
+ */
+void ScriptRunner::printStats(std::ostream & os, const ScriptStats & stats)
+{
+    os << std::fixed << std::setprecision(3)
+       << "Script summary\n"
+       << "   Lines        : " << stats.lines << '\n'
+       << "   Unknown      : " << stats.unknown << '\n'
+       << "   Bytes        : " << stats.bytes << '\n'
+       << "   Wall time    : " << stats.wallSeconds << " s\n"
+       << std::left << std::setw(12) << "   Command" << std::right << std::setw(12) << "Count"
+       << std::setw(12) << "Rejected" << std::setw(12) << "Seconds" << std::setw(14) << "Per second" << '\n';
+    for(ScriptCommand c : allCommands)
+    {
+        std::size_t i = (std::size_t)c;
+        if(0 == stats.count[i]) continue;
+        double rate = (stats.seconds[i] > 0.0) ? (double)stats.count[i] / stats.seconds[i] : 0.0;
+        os << "   " << std::left << std::setw(9) << commandName(c) << std::right
+           << std::setw(12) << stats.count[i] << std::setw(12) << stats.rejected[i]
+           << std::setprecision(3) << std::setw(12) << stats.seconds[i]
+           << std::setprecision(0) << std::setw(14) << rate << '\n';
+    }
+}
+
+/**
+ * @brief Script keyword of a command.
+ */
+const char * ScriptRunner::commandName(ScriptCommand command)
+{
+    switch(command)
+    {
+        case ScriptCommand::ask:    return "ask";
+        case ScriptCommand::bid:    return "bid";
+        case ScriptCommand::cancel: return "cancel";
+        case ScriptCommand::next:   return "next";
+        case ScriptCommand::stats:  return "stats";
+        case ScriptCommand::wallet: return "wallet";
+    }
+    return "unknown";
+}
@@ -0,0 +1,86 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ScriptRunner.h
+ * @author Edward Martinez
+ * @brief Header file for the non-interactive command script runner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+/** @cond STDINCLUDES */
+#include <cstddef>
+#include <istream>
+#include <ostream>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define SCRIPT_BLOCK_BYTES (1u << 20) /**< Bytes read from the script at a time. */
+#define SCRIPT_NUM_COMMANDS 6
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+class MerkelMain;
+class OrderBookEntry;
+
+/*! Script commands, in report order. */
+enum class ScriptCommand:unsigned char {ask, bid, cancel, next, stats, wallet};
+
+/*! @struct ScriptStats
+    @brief Per-command counts and time spent running a script.
+*/
+struct ScriptStats
+{
+    std::size_t count[SCRIPT_NUM_COMMANDS]    = {}; /**< Commands run, by ScriptCommand. */
+    std::size_t rejected[SCRIPT_NUM_COMMANDS] = {}; /**< Malformed, unfunded or unknown-id commands. */
+    double seconds[SCRIPT_NUM_COMMANDS]       = {}; /**< Time spent in each command type. */
+    std::size_t lines   = 0;
+    std::size_t unknown = 0;   /**< Lines that are not a known command. */
+    std::size_t bytes   = 0;
+    double wallSeconds  = 0.0;
+};
+
+/*! @class ScriptRunner
+    @brief Feeds a command script through MerkelMain's user entry path without prompts or echo.
+
+    One command per line; blank lines and lines starting with '#' are skipped:
+    - ask PRODUCT,PRICE,AMOUNT   e.g. "ask ETH/BTC,0.02,1"
+    - bid PRODUCT,PRICE,AMOUNT
+    - cancel ORDER_ID
+    - next                       match the current timeframe and advance
+    - stats                      print market statistics
+    - wallet                     print the user's wallet
+    The script is read in SCRIPT_BLOCK_BYTES blocks and parsed in place, and the journal is
+    committed once per block, so millions of orders can be pushed through submitOrder().
+    Time is charged to a command type per run of consecutive commands of that type.
+*/
+class ScriptRunner
+{
+    public:
+        ScriptRunner(MerkelMain & app);
+        ScriptStats run(std::istream & in);
+        static void printStats(std::ostream & os, const ScriptStats & stats);
+        static const char * commandName(ScriptCommand command);
+    private:
+        bool execute(ScriptCommand command, const char * args, const char * end, OrderBookEntry & order);
+        MerkelMain & app;
+};
@@ -24,7 +24,7 @@
  * The MerkelMain class acts as the main engine for the currency exchange simulator.
  * 
  * Assumptions, Restrictions and limitations:
- * 1. Limited to a single input dataset.
+ * 1. Limited to a single input dataset; VenueSet runs several MerkelMain venues on one clock.
  * 2. Data set must be specified upon initialization.
  * 
  */
@@ -34,16 +34,26 @@
 #include "UserMenuIF.h"
 #include "CsvReader.h"
 #include "OrderBookLib.h"
+#include "MetricsRegistry.h"
+#include "Logger.h"
 /** @cond STDINCLUDES */
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <map>
 #include <string>
 #include <sstream>
+#include <utility>
 /** @endcond */
 /********************************************//**
  *  Defines
  ***********************************************/
 #define USER_BIDASK_NTOKENS 3
+#define MENU_OPTION_EXIT 10
+#define FNAME_CHECKPOINT_DEFAULT "MerkleRex.ckpt"
+#define FNAME_LATENCY_DEFAULT "MerkleRex_latency.txt"
+#define STATS_CANDLE_RESOLUTION 1 /**< Index of the 1m resolution in the default CandleBuilder. */
+#define STATS_ROLLING_WINDOW    1 /**< Index of the 5m window in the default RollingStats. */
 /********************************************//**
  *  Local Params
  ***********************************************/
@@ -58,19 +68,65 @@
  */
 MerkelMain::MerkelMain(std::string filename)
 {
+    this->registerMetrics();
     try
     {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
         this->orderBook = OrderBook{filename};
         this->state = MerkelState::READY;
+        metrics.loadSeconds->set(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        metrics.orders->inc(orderBook.getOrderCount());
     }
     catch(const std::exception& e)
     {
         this->state = MerkelState::WAITING;
-        std::cout << "MerkelMain - Warning: failed to initialize MerkelMain data set." << std::endl;
+        MRX_LOG_WARN("MerkelMain - Warning: failed to initialize MerkelMain data set.");
         // throw;
     }
 }
 
+/**
+ * @brief Destructor. Waits for a checkpoint still being written and reports it if it failed.
+ */
+MerkelMain::~MerkelMain()
+{
+    this->reportCheckpointFailure();
+}
+
+/**
+ * @brief Looks up the engine metrics once, so later updates are plain atomic operations.
+ */
+void MerkelMain::registerMetrics()
+{
+    MetricsRegistry & reg = MetricsRegistry::instance();
+    metrics.orders      = &reg.counter("mrx_orders_ingested_total", "Orders added from data sets, journals and the user.");
+    metrics.fills       = &reg.counter("mrx_fills_total", "Sales produced by matching.");
+    metrics.ticks       = &reg.counter("mrx_ticks_total", "Timeframes processed.");
+    metrics.tickSeconds = &reg.gauge("mrx_tick_duration_seconds", "Duration of the last processed timeframe.");
+    metrics.loadSeconds = &reg.gauge("mrx_dataset_load_seconds", "Time taken to load the last data set.");
+    metrics.currencies  = &reg.gauge("mrx_wallet_currencies", "Currencies held in the user wallet.");
+}
+
+/**
+ * @brief Publishes the resting orders per product for the current timeframe.
+ * 
+ * Gauges are registered the first time a product is seen; afterwards this is one pass over
+ * the timeframe plus one atomic store per product.
+ */
+void MerkelMain::updateRestingMetrics(const std::vector<std::string> & products)
+{
+    if(metrics.resting.size() != products.size())
+    {
+        metrics.resting.clear();
+        for(const std::string & p : products)
+        {
+            metrics.resting.push_back(&MetricsRegistry::instance().gauge("mrx_resting_orders",
+                                      "Orders in the current timeframe.", MetricsRegistry::label("product", p)));
+        }
+    }
+    std::vector<std::size_t> counts = orderBook.getOrderCounts(currentTime);
+    for(std::size_t i = 0; i < counts.size(); i++) metrics.resting[i]->set((double)counts[i]);
+}
 
 /***************************************************************************//**
  * printMenu(void)
@@ -88,7 +144,10 @@ void MerkelMain::printMenu()
     //4 make a bid
     //5 print wallet
     //6 continue 
-    //7 Exit program
+    //7 save checkpoint
+    //8 print latency stats
+    //9 cancel an order
+    //10 Exit program
     */
     std::cout << "The current time is: " << currentTime << std::endl;
     std::cout << "1: Print help" << std::endl;
@@ -97,7 +156,10 @@ void MerkelMain::printMenu()
     std::cout << "4: Make a bid" << std::endl;
     std::cout << "5: Print wallet" << std::endl;
     std::cout << "6: Go to next timeframe" << std::endl;
-    std::cout << "7: Exit" << std::endl;
+    std::cout << "7: Save checkpoint" << std::endl;
+    std::cout << "8: Print latency stats" << std::endl;
+    std::cout << "9: Cancel an order" << std::endl;
+    std::cout << "10: Exit" << std::endl;
     std::cout << "=================================" << std::endl;
 }
 
@@ -108,7 +170,7 @@ void MerkelMain::printMenu()
  * 
  * Limitations,assumptions & restrictions:
  * 1. Only integer-type inputs are valid.
- * 2. Valid range integer value is 1-7
+ * 2. Valid range integer value is 1-MENU_OPTION_EXIT
  *
  * @return User selection
  ******************************************************************************/
@@ -118,8 +180,8 @@ int MerkelMain::getUserOption()
     int userOption = 0;
     int ret        = -1;
 
-    std::cout << "Type in 1-6" << std::endl;
-    getline(std::cin,strIn);
+    std::cout << "Type in 1-" << MENU_OPTION_EXIT << std::endl;
+    if(!getline(std::cin,strIn)) return MENU_OPTION_EXIT; //End of input: nothing more can be read.
 
     std::stringstream str(strIn);
     str >> userOption;
@@ -128,7 +190,7 @@ int MerkelMain::getUserOption()
     {
         std::cout << "   ERROR: Invalid input type." << std::endl;
     }
-    else if((userOption > 0) && (userOption < 8))
+    else if((userOption > 0) && (userOption <= MENU_OPTION_EXIT))
     {
         std::cout << "   You chose: " << userOption << std::endl;
         ret = userOption;
@@ -172,13 +234,40 @@ void MerkelMain::processUserOption(int selection)
         case 6:
             this->processNext();
             break;
+        case 7:
+            this->saveCheckpoint();
+            break;
+        case 8:
+            this->printLatency();
+            break;
+        case 9:
+            this->cancelOrder();
+            break;
         default:
             break;
 
     }
+    //Group commit: everything the selected option journaled goes out in one write.
+    this->commitJournal();
+    Logger::instance().flush(); //Show the option's log output before the menu.
     std::cout << std::endl;
 }
 
+/**
+ * @brief Writes out everything journaled since the last commit, warning instead of throwing on failure.
+ */
+void MerkelMain::commitJournal()
+{
+    try
+    {
+        journal.commit();
+    }
+    catch(const std::exception &e)
+    {
+        std::cout << "MerkelMain::commitJournal - Warning: " << e.what() << std::endl;
+    }
+}
+
 /**
  * @brief Prints exchange help message.
  */
@@ -211,7 +300,83 @@ void MerkelMain::printExchangeStats()
                   << "   Max Bid  : " << orderBook.getHighPrice(entriesBids) << std::endl
                   << "   Min Bid  : " << orderBook.getLowPrice(entriesBids) << std::endl
                   << "   Spread   : " << orderBook.getSpread(entriesBids) << std::endl << std::endl;
+
+        const Candle * candle = candles.getCurrent(prod, STATS_CANDLE_RESOLUTION);
+        if(nullptr != candle)
+        {
+            std::cout << "   Last 1m candle (O/H/L/C/V): " << candle->open << " / " << candle->high << " / "
+                      << candle->low << " / " << candle->close << " / " << candle->volume << std::endl << std::endl;
+        }
+
+        RollingSnapshot rs;
+        if(rolling.get(prod, STATS_ROLLING_WINDOW, rs))
+        {
+            std::cout << "   5m VWAP  : " << rs.vwap << std::endl
+                      << "   5m TWAP  : " << rs.twap << std::endl
+                      << "   5m Vol.  : " << rs.volatility << std::endl << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Prints p50/p99/p99.9/max latencies of the instrumented operations and dumps the full histograms to a file.
+ */
+void MerkelMain::printLatency()
+{
+    LatencyRegistry & latency = LatencyRegistry::instance();
+    latency.print(std::cout);
+
+    if(this->latencyPath.empty()) this->latencyPath = FNAME_LATENCY_DEFAULT;
+    if(latency.dump(this->latencyPath))
+    {
+        std::cout << "Latency histograms written to " << latencyPath << std::endl;
     }
+    else
+    {
+        std::cout << "MerkelMain::printLatency - Warning: could not write " << latencyPath << std::endl;
+    }
+}
+
+/**
+ * @brief Sets the file written by the "Print latency stats" menu option.
+ */
+void MerkelMain::setLatencyDump(std::string path)
+{
+    this->latencyPath = path;
+}
+
+/**
+ * @brief Sets how many threads apply each tick's ledger settlement. @see SettlementBatch::apply()
+ *
+ * With one thread fills are settled directly, which on the dense ledger is cheaper than netting.
+ */
+void MerkelMain::setSettlementThreads(unsigned threads)
+{
+    this->settlementThreads = (0 == threads) ? 1 : threads;
+}
+
+/**
+ * @brief Public method for reading sliding-window VWAP, TWAP and volatility of the sales matched so far.
+ */
+const RollingStats & MerkelMain::getRollingStats() const
+{
+    return this->rolling;
+}
+
+/**
+ * @brief Balances of every ledger account that took part in a fill.
+ */
+const Ledger & MerkelMain::getLedger() const
+{
+    return this->ledger;
+}
+
+/**
+ * @brief Public method for reading the OHLCV candles built from the sales matched so far.
+ */
+const CandleBuilder & MerkelMain::getCandles() const
+{
+    return this->candles;
 }
 
 /**
@@ -247,12 +412,9 @@ void MerkelMain::enterAsk()
                                                         currentTime,
                                                         tokens[0],
                                                         OrderBookType::ask);
-            obe.username = "simuser";
-
-            if(this->wallet.canFulfillOrder(obe))
+            if(ORDER_ID_NONE != this->submitOrder(obe))
             {
-                std::cout << "   MerkelMain::enterAsk - Wallet looks good." << std::endl;
-                orderBook.insertOrder(obe);
+                std::cout << "   MerkelMain::enterAsk - Wallet looks good. Order id: " << obe.orderId << std::endl;
             }
             else
             {
@@ -301,11 +463,9 @@ void MerkelMain::makeBid()
                                                         currentTime,
                                                         tokens[0],
                                                         OrderBookType::bid);
-            obe.username = "simuser";
-            if(this->wallet.canFulfillOrder(obe))
+            if(ORDER_ID_NONE != this->submitOrder(obe))
             {
-                std::cout << "   MerkelMain::makeBid - Wallet looks good." << std::endl;
-                orderBook.insertOrder(obe);
+                std::cout << "   MerkelMain::makeBid - Wallet looks good. Order id: " << obe.orderId << std::endl;
             }
             else
             {
@@ -320,6 +480,127 @@ void MerkelMain::makeBid()
     }
 }
 
+/**
+ * @brief Cancels one of the user's orders in the current timeframe and releases the funds it holds.
+ *
+ * Orders of earlier timeframes have already been matched and their holds released.
+ */
+void MerkelMain::cancelOrder()
+{
+    std::string idStr;
+    std::cout << "Cancel an order - enter the order id." << std::endl;
+    std::getline(std::cin, idStr);
+
+    OrderId id = (OrderId)std::strtoull(idStr.c_str(), nullptr, 10);
+    if(this->cancelUserOrder(id))
+    {
+        std::cout << "   MerkelMain::cancelOrder - Cancelled order " << id << std::endl;
+    }
+    else
+    {
+        std::cout << "   MerkelMain::cancelOrder - No open order " << idStr << " in the current timeframe." << std::endl;
+    }
+}
+
+/**
+ * @brief Entry path shared by every user order: holds the funds, adds the order to the current timeframe and journals it.
+ *
+ * The order's timestamp is set to the current time and it is attributed to the user.
+ * @param order Ask or bid. On success its orderId is set.
+ * @return Id of the order, or ORDER_ID_NONE if the wallet cannot fund it.
+ */
+OrderId MerkelMain::submitOrder(OrderBookEntry & order)
+{
+    order._timestamp = currentTime;
+    order.username   = "simuser";
+    order.orderId    = this->wallet.reserve(order);
+    if(ORDER_ID_NONE == order.orderId) return ORDER_ID_NONE;
+    orderBook.insertOrder(order);
+    journal.appendOrder(order);
+    metrics.orders->inc();
+    return order.orderId;
+}
+
+/**
+ * @brief Entry path for orders owned by ledger accounts (e.g. simulated agents), in bulk.
+ *
+ * Each order is timestamped with the current time (callers that already set it save a string
+ * copy per order) and added if its account can pay for it
+ * (Ledger::canFulfillOrder()); funds are not held, so the owner must not commit the same
+ * balance twice within a timeframe. Accepted orders are journaled and then moved into the
+ * book in one batch.
+ * @param orders Asks and bids with their account set. Left empty.
+ * @return Number of orders accepted.
+ */
+std::size_t MerkelMain::submitOrders(std::vector<OrderBookEntry> & orders)
+{
+    std::size_t accepted = 0;
+    for(std::size_t i = 0; i < orders.size(); i++)
+    {
+        if(!ledger.canFulfillOrder(orders[i])) continue;
+        if(orders[i]._timestamp != currentTime) orders[i]._timestamp = currentTime;
+        journal.appendOrder(orders[i]);
+        if(accepted != i) orders[accepted] = std::move(orders[i]);
+        accepted++;
+    }
+    orders.erase(orders.begin() + accepted, orders.end());
+    orderBook.insertOrders(orders);
+    metrics.orders->inc(accepted);
+    return accepted;
+}
+
+/**
+ * @brief Opens the ledger accounts that own orders of the book (data set rows with an account
+ *        column, restored or journaled orders), so their fills settle.
+ */
+void MerkelMain::openBookAccounts()
+{
+    std::size_t count = 0;
+    for(const OrderBookFrame & frame : *orderBook.snapshot())
+    {
+        for(const OrderBookEntry & e : frame.orders)
+        {
+            if((ACCOUNT_NONE != e.account) && (e.account >= count)) count = (std::size_t)e.account + 1;
+        }
+    }
+    if(count > ledger.getAccountCount()) ledger.openAccounts(count - ledger.getAccountCount());
+}
+
+/**
+ * @brief Opens n ledger accounts, each funded with amount of every listed currency.
+ * @return Id of the first account; the others follow consecutively.
+ */
+AccountId MerkelMain::openAccounts(std::size_t n, const std::vector<std::string> & currencies, double amount)
+{
+    AccountId first = ledger.openAccounts(n);
+    for(const std::string & c : currencies)
+    {
+        CurrencyId id = SymbolTable::instance().currency(c);
+        for(std::size_t i = 0; i < n; i++) ledger.deposit(first + (AccountId)i, id, amount);
+    }
+    return first;
+}
+
+/**
+ * @brief Cancels a user order of the current timeframe, releasing its funds and journaling the cancel.
+ * @return TRUE if the order was open.
+ */
+bool MerkelMain::cancelUserOrder(OrderId id)
+{
+    if(!orderBook.cancelOrder(currentTime, id)) return false;
+    this->wallet.release(id);
+    journal.appendCancel(currentTime, id);
+    return true;
+}
+
+/**
+ * @brief The user's wallet.
+ */
+const Wallet & MerkelMain::getWallet() const
+{
+    return this->wallet;
+}
+
 /**
  * @brief Prints contents of wallet to console.
  */
@@ -328,28 +609,97 @@ void MerkelMain::printWallet()
     std::cout << "Your wallet has " << this->wallet.getWalletLen() << " currencies" << std::endl;
     std::cout << this->wallet << std::endl;
 }
-void MerkelMain::processNext()
+/**
+ * @brief Matches bids and asks for every product in the current timeframe, then advances the simulation time.
+ * 
+ * Sales involving the user are applied to the user wallet. Sales between ledger accounts settle
+ * both counterparties in the ledger; with several settlement threads they are first netted per
+ * account and currency over the whole timeframe and applied in parallel, one update per net
+ * position. With a market data feed (see setMarketData()) the timeframe's book changes are
+ * published first and each product's trades as it is matched. When verbose output is disabled
+ * (see setVerbose()) nothing is printed, which is how headless replays drive the simulation.
+ * @return Number of orders and sales processed in the timeframe.
+ */
+TickStats MerkelMain::processNext()
 {
-   std::cout << "Going to next time step." << std::endl;
+   MRX_LATENCY_SCOPE(LatencyOp::tick);
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   TickStats stats;
+   if(verbose) MRX_LOG_INFO("Going to next time step.");
 
-   for(std::string &p : orderBook.getKnownProducts())
+   stats.orders = orderBook.getOrderCount(currentTime);
+   std::vector<std::string> products = orderBook.getKnownProducts();
+   this->updateRestingMetrics(products);
+   std::int64_t micros = 0;
+   if(nullptr != marketData)
+   {
+        micros = OrderBookEntry::timestampToMicros(currentTime);
+        marketData->publishClock(micros);
+        const OrderBookFrame * frame = orderBook.getFrame(currentTime);
+        if(nullptr != frame) marketData->publishBooks(*frame, micros);
+   }
+   for(std::string &p : products)
    {
-        std::cout << "Matching bids/asks for : " << p << std::endl;
+        if(verbose) MRX_LOG_INFO("Matching bids/asks for : {}", p);
         std::vector<OrderBookEntry> sales = orderBook.matchAsksToBids(p,currentTime);
-        std::cout << "Sales: "<< sales.size() << std::endl;
+        if(nullptr != marketData) marketData->publishTrades(p, sales, micros);
+        if(verbose) MRX_LOG_INFO("Sales: {}", sales.size());
+        stats.sales += sales.size();
         for(OrderBookEntry & sale : sales)
         {
-            std::cout << "   Sale price: " << sale._price << " amount " << sale._amount << std::endl;
+            candles.onSale(sale);
+            rolling.onSale(sale);
+            if(verbose) MRX_LOG_INFO("   Sale price: {} amount {}", sale._price, sale._amount);
             //Verification that user wallet can support sale is performed when bid/ask is added 
             //to orderbook. This could be changed . . .
             if(("simuser" == sale.username))
             {
+                journal.appendFill(sale);
                 this->wallet.processSale(sale);
+                if(fillListener) fillListener(sale);
             }
         }
+        if(settlementThreads > 1) stats.settled += settlement.addAll(sales);
+        else                      stats.settled += ledger.settleAll(sales);
    }
+   settlement.apply(ledger, settlementThreads);
+   this->wallet.releaseAll(); //Unfilled user orders expire with their timeframe.
    currentTime = orderBook.getNextTime(currentTime); 
+   journal.appendTime(currentTime);
+
+   metrics.fills->inc(stats.sales);
+   metrics.ticks->inc();
+   metrics.currencies->set((double)wallet.getWalletLen());
+   metrics.tickSeconds->set(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+   return stats;
+}
+
+/**
+ * @brief Sets the function told about each user fill by processNext(), after the wallet is updated.
+ * @param listener Replaces any earlier listener; an empty function removes it.
+ */
+void MerkelMain::setFillListener(FillListener listener)
+{
+    this->fillListener = std::move(listener);
+}
+
+/**
+ * @brief Publishes each timeframe's book changes and trades to a market data feed from processNext().
+ * @param feed Open publisher that outlives its use here; nullptr stops publishing.
+ */
+void MerkelMain::setMarketData(MarketDataPublisher * feed)
+{
+    this->marketData = feed;
+}
+
+/**
+ * @brief Enables or disables the per-timeframe console output of processNext().
+ */
+void MerkelMain::setVerbose(bool verbose)
+{
+    this->verbose = verbose;
 }
+
 /**
  * @brief Public method for viewing current time in simulation.
  */
@@ -360,6 +710,9 @@ std::string MerkelMain::getCurrentTime()
 
 /**
  * @brief Public method for obtaining a copy of the current orders in simulation.
+ *
+ * The copy is independent of the simulation but costs O(1): frames are shared copy-on-write
+ * and only duplicated, one at a time, when either side modifies them.
  */
 OrderBook MerkelMain::getOrders()
 {
@@ -374,6 +727,137 @@ MerkelState MerkelMain::getCurrentState()
     return this->state;
 }
 
+/**
+ * @brief Enables the write-ahead journal for user orders, fills and clock advances.
+ * 
+ * Must be called before init(). If the journal file already holds records from a previous
+ * run, init() replays them so the simulation resumes where it stopped.
+ * @param path Path to the journal file.
+ */
+void MerkelMain::setJournal(std::string path)
+{
+    this->journalPath = path;
+}
+
+/**
+ * @brief Replays the journal (if any) on top of the loaded state, then re-opens it for appending.
+ * @param from Offset of the first record not yet part of the state: 0 on top of a freshly
+ *             loaded data set, the checkpoint's journal length on top of a restored checkpoint.
+ * @param holds Holds already re-created for journaled order ids.
+ */
+void MerkelMain::recoverJournal(std::size_t from, const JournalHoldMap & holds)
+{
+    try
+    {
+        JournalRecoveryStats stats = Journal::recover(journalPath, orderBook, wallet, currentTime, from, holds);
+        metrics.orders->inc(stats.nOrders);
+        if(stats.nOrders + stats.nFills + stats.nTimes > 0)
+        {
+            std::cout << "MerkelMain - Recovered " << stats.nOrders << " orders, "
+                      << stats.nFills << " fills from journal " << journalPath << std::endl;
+        }
+        if(stats.nSkipped > 0)
+        {
+            std::cout << "MerkelMain - Warning: skipped " << stats.nSkipped
+                      << " unreadable journal records" << std::endl;
+        }
+        if(stats.tornTail)
+        {
+            std::cout << "MerkelMain - Warning: discarding incomplete journal tail after byte "
+                      << stats.validBytes << std::endl;
+        }
+        journal.open(journalPath, stats.validBytes);
+    }
+    catch(const std::exception &e)
+    {
+        std::cout << "MerkelMain - Warning: journal disabled." << std::endl;
+        std::cout << "   Exception:" << e.what() << std::endl;
+    }
+}
+
+/**
+ * @brief Configures where checkpoints are saved and whether init() resumes from one.
+ * 
+ * Must be called before init().
+ * @param path Path to the checkpoint file.
+ * @param restore TRUE to restore the simulation from the checkpoint during init().
+ */
+void MerkelMain::setCheckpoint(std::string path, bool restore)
+{
+    this->checkpointPath    = path;
+    this->checkpointRestore = restore;
+}
+
+/**
+ * @brief Saves orderbook, wallet and simulation time to the checkpoint file.
+ * 
+ * The state is captured as a copy-on-write snapshot and written by a background thread,
+ * so the simulation can continue immediately. The outcome is known on the next save or at
+ * shutdown, where a failed write is reported.
+ */
+void MerkelMain::saveCheckpoint()
+{
+    if(this->checkpointPath.empty()) this->checkpointPath = FNAME_CHECKPOINT_DEFAULT;
+    this->reportCheckpointFailure();
+
+    CheckpointState state;
+    state.currentTime = this->currentTime;
+    state.orders      = this->orderBook.snapshot();
+    state.balances    = this->wallet.getBalances();
+    state.journalBytes = journal.isOpen() ? journal.size() : CHECKPOINT_NO_JOURNAL;
+    this->checkpointWriter.start(this->checkpointPath, std::move(state));
+    std::cout << "Saving checkpoint at " << currentTime << " to " << checkpointPath << std::endl;
+}
+
+/**
+ * @brief Waits for the checkpoint started last, if any, and prints why it failed.
+ */
+void MerkelMain::reportCheckpointFailure()
+{
+    this->checkpointWriter.wait();
+    if(this->checkpointWriter.lastWriteOk()) return;
+    std::cout << "MerkelMain - Warning: failed to save checkpoint " << checkpointPath << std::endl;
+    std::cout << "   Exception:" << this->checkpointWriter.lastError() << std::endl;
+}
+
+/**
+ * @brief Replaces the loaded data set, wallet and simulation time with the contents of the checkpoint file.
+ * @param journalBytes Receives the journal length saved with the checkpoint.
+ * @param holds Receives the saved order id -> re-created hold of each open user order.
+ * @return TRUE if the checkpoint was restored.
+ */
+bool MerkelMain::restoreCheckpoint(std::uint64_t & journalBytes, JournalHoldMap & holds)
+{
+    try
+    {
+        std::vector<OrderBookEntry> entries;
+        CheckpointState state = Checkpoint::read(checkpointPath, entries);
+        this->wallet.setBalances(state.balances);
+        for(OrderBookEntry & e : entries)
+        {
+            //User orders of the current timeframe are still open: hold their funds again.
+            if(("simuser" == e.username) && (e._timestamp == state.currentTime))
+            {
+                OrderId saved = e.orderId;
+                e.orderId = this->wallet.reserve(e);
+                if(ORDER_ID_NONE != saved) holds[saved] = e.orderId;
+            }
+        }
+        this->orderBook.restore(std::move(entries));
+        this->currentTime = state.currentTime;
+        this->state       = MerkelState::READY;
+        journalBytes      = state.journalBytes;
+        std::cout << "MerkelMain - Restored checkpoint " << checkpointPath << " at " << currentTime << std::endl;
+        return true;
+    }
+    catch(const std::exception &e)
+    {
+        std::cout << "MerkelMain - Warning: failed to restore checkpoint." << std::endl;
+        std::cout << "   Exception:" << e.what() << std::endl;
+        return false;
+    }
+}
+
 /**
  * @brief Executes the main loop for the MerkelMain exchange sim.
  */
@@ -385,7 +869,7 @@ void MerkelMain::run()
         this->printMenu();
         option = this->getUserOption();
 
-        if(option == 7) break; //Exit program
+        if(option == MENU_OPTION_EXIT) break; //Exit program
         else if(option > 0) this->processUserOption(option);
     }
 }
@@ -402,6 +886,12 @@ void MerkelMain::run()
  * wallet, but NOT enter the main loop (i.e. user input will not be 
  * acepted from terminal).
  * 
+ * If a checkpoint restore was requested with setCheckpoint(), the simulation
+ * resumes from it, and a journal configured with setJournal() replays only the
+ * records written after the checkpoint was taken. Otherwise (or if the restore
+ * fails) the data set starts from its earliest time and the whole journal is
+ * replayed. Either way the journal is then open for new records.
+ * 
  * @param debug Boolean flag to indicate whether application should run in debug mode.
  */
 void MerkelMain::init(bool debug)
@@ -409,10 +899,27 @@ void MerkelMain::init(bool debug)
     std::string initProd = "BTC";
     double initAmt       = 10.0f;
     this->wallet.insertCurrency("BTC",10);
-    if((MerkelState::READY == this->state))
+    std::uint64_t journalBytes = 0;
+    JournalHoldMap holds;
+    if(this->checkpointRestore && this->restoreCheckpoint(journalBytes, holds))
+    {
+        if(!journalPath.empty())
+        {
+            if(CHECKPOINT_NO_JOURNAL == journalBytes)
+            {
+                //Nothing ties the checkpoint to a journal position: append without replaying.
+                std::cout << "MerkelMain - Warning: checkpoint was saved without a journal; journal not replayed." << std::endl;
+                journalBytes = SIZE_MAX;
+            }
+            this->recoverJournal((std::size_t)journalBytes, holds);
+        }
+    }
+    else if((MerkelState::READY == this->state))
     {
         currentTime = orderBook.getEarliestTime();
+        if(!journalPath.empty()) this->recoverJournal(0, holds);
     }
+    if(MerkelState::READY == this->state) this->openBookAccounts();
     if((MerkelState::READY == this->state) && (!debug))
     {
         std::cout << "Initializing MerkelMain . . ." << std::endl;
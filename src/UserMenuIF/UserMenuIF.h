@@ -29,7 +29,17 @@
 
 #include "OrderBook.h"
 #include "Wallet.h"
+#include "Ledger.h"
+#include "SettlementBatch.h"
+#include "Journal.h"
+#include "Checkpoint.h"
+#include "CandleBuilder.h"
+#include "RollingStats.h"
+#include "LatencyHistogram.h"
+#include "MetricsRegistry.h"
+#include "MarketDataFeed.h"
 /** @cond STDINCLUDES */
+#include <functional>
 #include <vector>
 /** @endcond */
 /********************************************//**
@@ -45,6 +55,33 @@
  ***********************************************/
 enum class MerkelState:char {WAITING,READY,RUN};
 
+/** Called by MerkelMain::processNext() for every sale that fills a user order. */
+typedef std::function<void(const OrderBookEntry &)> FillListener;
+
+/*! @struct TickStats
+    @brief Work done by one call to MerkelMain::processNext().
+*/
+struct TickStats
+{
+    std::size_t orders = 0; /**< Orderbook entries in the processed timeframe. */
+    std::size_t sales  = 0; /**< Sales produced by matching. */
+    std::size_t settled = 0; /**< Sales booked to at least one ledger account. */
+};
+
+/*! @struct EngineMetrics
+    @brief Handles to the registered engine metrics. @see MetricsRegistry
+*/
+struct EngineMetrics
+{
+    MetricsCounter * orders = nullptr;
+    MetricsCounter * fills  = nullptr;
+    MetricsCounter * ticks  = nullptr;
+    MetricsGauge * tickSeconds = nullptr;
+    MetricsGauge * loadSeconds = nullptr;
+    MetricsGauge * currencies  = nullptr;
+    std::vector<MetricsGauge *> resting; /**< Per product, in getKnownProducts() order. */
+};
+
 /*! @class MerkelMain
     @brief Class for currency exchange application.
 
@@ -54,25 +91,66 @@ class MerkelMain
 {
     public:
         MerkelMain(std::string filename);
+        ~MerkelMain();
         void init(bool debug);
         std::string getCurrentTime();
         MerkelState getCurrentState();
         OrderBook getOrders();
+        void setJournal(std::string path);
+        void setCheckpoint(std::string path, bool restore);
+        void saveCheckpoint();
+        void setVerbose(bool verbose);
+        void setLatencyDump(std::string path);
+        void setSettlementThreads(unsigned threads);
+        void setFillListener(FillListener listener);
+        void setMarketData(MarketDataPublisher * feed);
+        TickStats processNext();
+        OrderId submitOrder(OrderBookEntry & order);
+        std::size_t submitOrders(std::vector<OrderBookEntry> & orders);
+        AccountId openAccounts(std::size_t n, const std::vector<std::string> & currencies, double amount);
+        bool cancelUserOrder(OrderId id);
+        void commitJournal();
+        void printExchangeStats();
+        void printWallet();
+        const Wallet & getWallet() const;
+        const CandleBuilder & getCandles() const;
+        const RollingStats & getRollingStats() const;
+        const Ledger & getLedger() const;
     private:
         void printHelp();
-        void printExchangeStats();
         void enterAsk();
         void makeBid();
-        void printWallet();
-        void processNext();
+        void cancelOrder();
+        void printLatency();
         void processUserOption(int selection);
         int getUserOption();
         void printMenu();
         void run();
+        void recoverJournal(std::size_t from, const JournalHoldMap & holds);
+        bool restoreCheckpoint(std::uint64_t & journalBytes, JournalHoldMap & holds);
+        void reportCheckpointFailure();
+        void openBookAccounts();
+        void registerMetrics();
+        void updateRestingMetrics(const std::vector<std::string> & products);
         std::string currentTime;
         OrderBook orderBook;
         MerkelState state;
         Wallet wallet;
+        Ledger ledger;
+        SettlementBatch settlement;
+        unsigned settlementThreads = 1;
+        Journal journal;
+        std::string journalPath;
+        CheckpointWriter checkpointWriter;
+        std::string checkpointPath;
+        bool checkpointRestore = false;
+        bool verbose = true;
+        std::string latencyPath;
+        FillListener fillListener;
+        MarketDataPublisher * marketData = nullptr;
+        EngineMetrics metrics;
+        CandleBuilder candles;
+        RollingStats rolling;
 };
 /********************************************//**
  *  Function Prototypes
@@ -0,0 +1,273 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file VenueSet.cpp
+ * @author Edward Martinez
+ * @brief Source file for replaying several venues' data sets on one merged clock.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "VenueSet.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+/** @endcond */
+/********************************************//**
+ *  Method Implementations
+ ***********************************************/
+/**
+ * @brief Constructor.
+ * @param threads Threads loading and stepping venues, the caller included; 0 uses every hardware thread.
+ */
+VenueSet::VenueSet(unsigned threads)
+{
+    if(0 == threads) threads = std::max(1u, std::thread::hardware_concurrency());
+    for(unsigned t = 1; t < threads; t++)
+    {
+        workers.emplace_back([this](){ this->workerLoop(); });
+    }
+}
+
+/**
+ * @brief Destructor. Stops the worker threads.
+ */
+VenueSet::~VenueSet()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(std::thread & w : workers) w.join();
+}
+
+/**
+ * @brief Loads data sets as venues, reading the files concurrently.
+ *
+ * Each venue gets its own MerkelMain, initialised headless with verbose output off and its
+ * clock at its earliest timestamp. Data sets that fail to load are logged and skipped, and
+ * venues keep the order of paths.
+ * @param paths Data sets to add.
+ * @return Number of venues added.
+ */
+std::size_t VenueSet::load(const std::vector<std::string> & paths)
+{
+    std::vector<std::unique_ptr<MerkelMain>> engines(paths.size());
+    this->parallelFor(paths.size(), [&](std::size_t i)
+    {
+        std::unique_ptr<MerkelMain> engine{new MerkelMain{paths[i]}};
+        engine->setVerbose(false);
+        engine->init(true);
+        engines[i] = std::move(engine);
+    });
+
+    std::size_t added = 0;
+    for(std::size_t i = 0; i < paths.size(); i++)
+    {
+        if(MerkelState::READY != engines[i]->getCurrentState())
+        {
+            MRX_LOG_WARN("VenueSet::load - Skipping data set {}", paths[i]);
+            continue;
+        }
+        Venue venue;
+        venue.name   = paths[i];
+        venue.engine = std::move(engines[i]);
+        venues.push_back(std::move(venue));
+        added++;
+    }
+    return added;
+}
+
+/**
+ * @brief Limits every venue to maxTicks timeframes; 0 (the default) processes them all.
+ */
+void VenueSet::setTickLimit(std::size_t maxTicks)
+{
+    this->maxTicks = maxTicks;
+}
+
+/**
+ * @brief Number of loaded venues.
+ */
+std::size_t VenueSet::getVenueCount() const
+{
+    return venues.size();
+}
+
+/**
+ * @brief A loaded venue, e.g. to configure its engine before stepping.
+ */
+Venue & VenueSet::getVenue(std::size_t index)
+{
+    if(index >= venues.size())
+    {
+        throw std::runtime_error(std::string("VenueSet::getVenue - No venue ") + std::to_string(index));
+    }
+    return venues[index];
+}
+
+/**
+ * @brief The merged clock: the earliest current time of the venues that are not done.
+ * @return Empty once every venue is done.
+ */
+std::string VenueSet::getCurrentTime() const
+{
+    std::string earliest;
+    for(const Venue & v : venues)
+    {
+        if(v.done) continue;
+        std::string t = v.engine->getCurrentTime();
+        if(earliest.empty() || (t < earliest)) earliest = std::move(t);
+    }
+    return earliest;
+}
+
+/**
+ * @brief TRUE once every venue is done.
+ */
+bool VenueSet::isDone() const
+{
+    for(const Venue & v : venues)
+    {
+        if(!v.done) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Advances the merged clock by one timestamp.
+ *
+ * Every venue whose current time equals the merged clock processes that timeframe, one
+ * venue per thread. A venue is done when its clock wraps around to its earliest timestamp
+ * or it reaches the tick limit.
+ * @return Totals over the venues that stepped; venues is 0 once every venue is done.
+ */
+VenueStepStats VenueSet::step()
+{
+    VenueStepStats stats;
+    std::string now = this->getCurrentTime();
+    if(now.empty()) return stats;
+
+    due.clear();
+    for(std::size_t i = 0; i < venues.size(); i++)
+    {
+        if(!venues[i].done && (venues[i].engine->getCurrentTime() == now)) due.push_back(i);
+    }
+    dueStats.assign(due.size(), TickStats{});
+    this->parallelFor(due.size(), [&](std::size_t k)
+    {
+        Venue & v = venues[due[k]];
+        dueStats[k] = v.engine->processNext();
+        v.ticks++;
+        if(!(v.engine->getCurrentTime() > now) || ((0 != maxTicks) && (v.ticks >= maxTicks))) v.done = true;
+    });
+
+    stats.venues = due.size();
+    for(const TickStats & t : dueStats)
+    {
+        stats.orders  += t.orders;
+        stats.sales   += t.sales;
+        stats.settled += t.settled;
+    }
+    return stats;
+}
+
+/**
+ * @brief Calls job(0) ... job(count - 1) across the worker threads and the caller, and waits for all of them.
+ *
+ * A single job runs inline. The first exception thrown by a job is rethrown here once every
+ * job has finished.
+ */
+void VenueSet::parallelFor(std::size_t count, const std::function<void(std::size_t)> & job)
+{
+    if((count <= 1) || workers.empty())
+    {
+        for(std::size_t i = 0; i < count; i++) job(i);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->job      = &job;
+        this->jobCount = count;
+        this->nextJob.store(0, std::memory_order_relaxed);
+        this->error    = nullptr;
+        this->generation++;
+    }
+    wake.notify_all();
+    this->runJobs();
+
+    std::exception_ptr failed;
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        finished.wait(guard, [this](){ return 0 == active; });
+        this->job = nullptr;
+        failed = std::move(this->error);
+    }
+    if(failed) std::rethrow_exception(failed);
+}
+
+/**
+ * @brief Claims and runs jobs of the current parallelFor() until none are left.
+ */
+void VenueSet::runJobs()
+{
+    for(;;)
+    {
+        std::size_t i = nextJob.fetch_add(1, std::memory_order_relaxed);
+        if(i >= jobCount) return;
+        try
+        {
+            (*job)(i);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if(!error) error = std::current_exception();
+        }
+    }
+}
+
+/**
+ * @brief Worker thread body: joins each parallelFor() as it starts.
+ *
+ * A worker that wakes after the caller has claimed every job finds nothing left to run. The
+ * caller waits for workers that have joined, so job stays valid while any of them uses it.
+ */
+void VenueSet::workerLoop()
+{
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> guard(lock);
+    for(;;)
+    {
+        wake.wait(guard, [&](){ return stopping || (generation != seen); });
+        if(stopping) return;
+        seen = generation;
+        if(nullptr == job) continue;
+        active++;
+        guard.unlock();
+        this->runJobs();
+        guard.lock();
+        if(0 == --active) finished.notify_all();
+    }
+}
@@ -0,0 +1,109 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file VenueSet.h
+ * @author Edward Martinez
+ * @brief Header file for replaying several venues' data sets on one merged clock.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "UserMenuIF.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+/** @endcond */
+/********************************************//**
+ *  Class Definitions
+ ***********************************************/
+/*! @struct Venue
+    @brief One exchange's data set, with its own book, wallet and ledger.
+*/
+struct Venue
+{
+    std::string name;                   /**< Path of the data set. */
+    std::unique_ptr<MerkelMain> engine;
+    std::size_t ticks = 0;              /**< Timeframes processed so far. */
+    bool done = false;                  /**< Every timeframe (or the tick limit) has been processed. */
+};
+
+/*! @struct VenueStepStats
+    @brief Work done by one VenueSet::step(), summed over the venues that stepped.
+*/
+struct VenueStepStats
+{
+    std::size_t venues  = 0;    /**< Venues whose timeframe was at the merged time. */
+    std::size_t orders  = 0;
+    std::size_t sales   = 0;
+    std::size_t settled = 0;
+};
+
+/*! @class VenueSet
+    @brief Several venues, each a MerkelMain over its own data set, advanced on one merged clock.
+
+    load() reads the data sets concurrently. The merged clock is the earliest current time of
+    any venue that is not done; step() processes the timeframe of every venue at that time, on
+    separate threads when more than one venue is due, so venues with coinciding timestamps move
+    together and the others wait for their turn. Currency and product symbols are interned in
+    the process-wide SymbolTable, so they are shared by every venue.
+*/
+class VenueSet
+{
+    public:
+        VenueSet(unsigned threads = 0);
+        ~VenueSet();
+        VenueSet(const VenueSet &) = delete;
+        VenueSet & operator=(const VenueSet &) = delete;
+        std::size_t load(const std::vector<std::string> & paths);
+        void setTickLimit(std::size_t maxTicks);
+        std::size_t getVenueCount() const;
+        Venue & getVenue(std::size_t index);
+        std::string getCurrentTime() const;
+        bool isDone() const;
+        VenueStepStats step();
+    private:
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)> & job);
+        void runJobs();
+        void workerLoop();
+        std::vector<Venue> venues;
+        std::vector<std::size_t> due;
+        std::vector<TickStats> dueStats;
+        std::size_t maxTicks = 0;
+        std::vector<std::thread> workers;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::condition_variable finished;
+        std::uint64_t generation = 0;
+        unsigned active = 0;
+        bool stopping = false;
+        const std::function<void(std::size_t)> * job = nullptr;
+        std::size_t jobCount = 0;
+        std::atomic<std::size_t> nextJob{0};
+        std::exception_ptr error;
+};
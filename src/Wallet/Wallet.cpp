@@ -27,19 +27,24 @@
  *  Includes
  ***********************************************/
 #include "Wallet.h"
-#include "CsvReader.h"
+#include "../Log/Logger.h"
 /** @cond STDINCLUDES */
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <string>
 /** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define WALLET_HOLD_EPSILON 1e-12 /**< Hold remainder treated as fully used. */
 
 /**
  * @brief Constructor for Wallet class.
  */
 Wallet::Wallet()
+: nPresent(0)
 {
-    
 }
 
 /**
@@ -51,16 +56,7 @@ void Wallet::insertCurrency(std::string type, double amount)
 {
     if(amount >= 0)
     {
-        // std::cout << "Wallet::insertCurrency - Adding " << amount << " of " << type << " to wallet." << std::endl;
-        if(0 != this->currencies.count(type))
-        {
-            this->currencies[type] += 0;
-        }
-        else
-        {
-            // std::cout << "   Wallet::insertCurrency - Adding new currency to wallet" << std::endl;
-            this->currencies[type] = amount;
-        }
+        this->slot(SymbolTable::instance().currency(type)) += amount;
     }
     else
     {
@@ -79,16 +75,16 @@ bool Wallet::removeCurrency(std::string type, double amount)
 {
     try
     {
-        if(this->containsCurrency(type,amount))
+        CurrencyId id = SymbolTable::instance().findCurrency(type);
+        if(this->containsCurrency(id,amount))
         {
-            this->currencies[type] -= amount;
+            this->balances[id] -= amount;
             return true;
         }
     }
     catch(const std::exception & e)
     {
-        std::cout << "Wallet::removeCurrency - Exception while removing currency." << std::endl;
-        std::cout << e.what() << std::endl;
+        MRX_LOG_WARN("Wallet::removeCurrency - Exception while removing currency: {}", e.what());
     }
     return false;
 }
@@ -101,17 +97,164 @@ bool Wallet::removeCurrency(std::string type, double amount)
  *         FALSE if currency DNE in wallet in specified amount.
  */
 bool Wallet::containsCurrency(std::string type, double amount)
+{
+    return this->containsCurrency(SymbolTable::instance().findCurrency(type),amount);
+}
+
+/**
+ * @brief Determines whether currency exists in wallet in the specified amount, not counting held funds.
+ * @param id Interned currency id. Unknown ids (e.g. SYMBOL_INVALID_ID) are never contained.
+ * @param amount Amount of currency to be found.
+ */
+bool Wallet::containsCurrency(CurrencyId id, double amount) const
 {
     if(amount < 0)
     {
         throw std::runtime_error(std::string("Wallet::containsCurrency - Received negative currency amount."));
     }
+    return (id < present.size()) && present[id] && (balances[id] - reserved[id] >= amount);
+}
 
-    if(this->currencies.count(type) > 0) //We have this type of currency
+/**
+ * @brief Balance of a currency, 0 if the wallet does not hold it. Includes held funds.
+ */
+double Wallet::getBalance(CurrencyId id) const
+{
+    return (id < balances.size()) ? balances[id] : 0.0;
+}
+
+/**
+ * @brief Part of a balance not held by open orders.
+ */
+double Wallet::getAvailable(CurrencyId id) const
+{
+    return (id < balances.size()) ? balances[id] - reserved[id] : 0.0;
+}
+
+/**
+ * @brief Part of a balance held by open orders.
+ */
+double Wallet::getReserved(CurrencyId id) const
+{
+    return (id < reserved.size()) ? reserved[id] : 0.0;
+}
+
+/**
+ * @brief Holds the funds an ask or bid may spend: the base amount of an ask, amount x price of quote for a bid.
+ * @param order Order being entered.
+ * @return Id of the new hold, to be stored in the order's orderId. ORDER_ID_NONE if the available
+ *         balance is insufficient or the order type is not an ask or bid.
+ */
+OrderId Wallet::reserve(const OrderBookEntry & order)
+{
+    ProductPair pair = SymbolTable::instance().product(order._product);
+    Hold hold{0, true, 0, 0.0, 1.0};
+    if(OrderBookType::ask == order._OrderType)
     {
-        if(this->currencies[type] >= amount) return true; //Return true if we have at least the specified amount
+        hold.currency  = pair.base;
+        hold.remaining = order._amount;
     }
-    return false;
+    else if(OrderBookType::bid == order._OrderType)
+    {
+        hold.currency  = pair.quote;
+        hold.remaining = order._amount * order._price;
+        hold.perUnit   = order._price;
+    }
+    else return ORDER_ID_NONE;
+
+    if(!this->containsCurrency(hold.currency,hold.remaining)) return ORDER_ID_NONE;
+    this->slot(hold.currency);
+    reserved[hold.currency] += hold.remaining;
+    std::uint32_t index;
+    if(freeHolds.empty())
+    {
+        index = (std::uint32_t)holds.size();
+        holds.push_back(hold);
+    }
+    else
+    {
+        index = freeHolds.back();
+        freeHolds.pop_back();
+        hold.generation = holds[index].generation;
+        holds[index]    = hold;
+    }
+    OrderId id = ((OrderId)hold.generation << 32) | ((OrderId)index + 1);
+    openHolds.push_back(id);
+    return id;
+}
+
+/**
+ * @brief Finds the open hold of an order id.
+ * @param index Receives the hold's slot.
+ * @return FALSE if the id never had a hold, or its hold was released (the slot may hold a newer order).
+ */
+bool Wallet::findHold(OrderId id, std::size_t & index) const
+{
+    std::size_t low = (std::size_t)(id & 0xFFFFFFFFu);
+    if((0 == low) || (low > holds.size())) return false;
+    const Hold & h = holds[low - 1];
+    if(!h.open || (h.generation != (std::uint32_t)(id >> 32))) return false;
+    index = low - 1;
+    return true;
+}
+
+/**
+ * @brief Releases whatever an order still holds, e.g. when it is cancelled or expires.
+ * @return TRUE if the order had an open hold.
+ */
+bool Wallet::release(OrderId id)
+{
+    std::size_t index;
+    if(!this->findHold(id, index)) return false;
+    Hold & h = holds[index];
+    reserved[h.currency] -= h.remaining;
+    if(reserved[h.currency] < WALLET_HOLD_EPSILON) reserved[h.currency] = 0.0;
+    h.remaining = 0.0;
+    h.open      = false;
+    h.generation++;
+    freeHolds.push_back((std::uint32_t)index);
+    return true;
+}
+
+/**
+ * @brief Releases every open hold, e.g. when the timeframe the orders were entered in has been matched.
+ * @return Number of holds released.
+ */
+std::size_t Wallet::releaseAll()
+{
+    std::size_t n = 0;
+    for(OrderId id : openHolds)
+    {
+        if(this->release(id)) n++;
+    }
+    openHolds.clear();
+    return n;
+}
+
+/**
+ * @brief Number of orders that still hold funds.
+ */
+std::size_t Wallet::getOpenHoldCount() const
+{
+    std::size_t n = 0;
+    std::size_t index;
+    for(OrderId id : openHolds) n += this->findHold(id, index) ? 1 : 0;
+    return n;
+}
+
+/**
+ * @brief Turns the part of a hold covering a fill into spent funds.
+ * @param filled Base amount filled.
+ */
+void Wallet::consumeHold(OrderId id, double filled)
+{
+    std::size_t index;
+    if(!this->findHold(id, index)) return;
+    Hold & h = holds[index];
+    double used = std::min(h.remaining, filled * h.perUnit);
+    h.remaining -= used;
+    reserved[h.currency] -= used;
+    if(h.remaining <= WALLET_HOLD_EPSILON) this->release(id);
 }
 
 /**
@@ -121,11 +264,15 @@ std::string Wallet::toString()
 {
     std::string s;
 
-    for(std::pair <std::string, double> pair : this->currencies)
+    SymbolTable & symbols = SymbolTable::instance();
+    for(std::pair <std::string, double> pair : this->getBalances())
     {
         std::string currency = pair.first;
         double amount        = pair.second;
-        s += currency + " : " + std::to_string(amount) + "\n";
+        s += currency + " : " + std::to_string(amount);
+        double held = this->getReserved(symbols.findCurrency(currency));
+        if(held > 0.0) s += " (" + std::to_string(held) + " held)";
+        s += "\n";
     }
     return s;
 }
@@ -155,32 +302,19 @@ std::ostream & operator << (std::ostream &os, Wallet & wallet)
  */
 bool Wallet::canFulfillOrder(const OrderBookEntry & order)
 {
-    //Split a string "ETH/BTC" into a vector ["ETH","BTC"]
-    std::vector <std::string> products = CsvReader::tokenise(order._product,'/');
-
-    //This is the product user has and needs to verify.
-    std::string tradeProd;
-
-    //Transaction amount
-    double amount = 0.0f; 
+    //Split a string "ETH/BTC" into its currencies {ETH, BTC}.
+    ProductPair pair = SymbolTable::instance().product(order._product);
 
     if(OrderBookType::ask == order._OrderType)
     {
-        amount = order._amount;
-        tradeProd = products[0];
+        return this->containsCurrency(pair.base,order._amount);
     }
-    else if(OrderBookType::bid == order._OrderType)
-    {
-        amount = order._amount * order._price; //Calculate how much of the product we need.
-        tradeProd = products[1];
-    }
-    else
+    if(OrderBookType::bid == order._OrderType)
     {
-        std::cout << "Wallet::canFulfillOrder - Warning: unsupported OBE order type." << std::endl;
-        return false;
+        return this->containsCurrency(pair.quote,order._amount * order._price); //Calculate how much of the product we need.
     }
-    std::cout << "Wallet::canFulfillOrder - checking wallet for " << amount << " " << tradeProd << std::endl;
-    return this->containsCurrency(tradeProd,amount);
+    MRX_LOG_WARN("Wallet::canFulfillOrder - Warning: unsupported OBE order type.");
+    return false;
 }
 
 /**
@@ -188,9 +322,61 @@ bool Wallet::canFulfillOrder(const OrderBookEntry & order)
  * 
  * @return value of wallet length
  */
-int Wallet::getWalletLen()
+int Wallet::getWalletLen() const
 {
-    return this->currencies.size();
+    return (int)this->nPresent;
+}
+
+/**
+ * @brief Get a copy of every currency balance held in the wallet.
+ */
+std::map<std::string, double> Wallet::getBalances() const
+{
+    std::map<std::string, double> out;
+    SymbolTable & symbols = SymbolTable::instance();
+    for(std::size_t id = 0; id < present.size(); id++)
+    {
+        if(present[id]) out[symbols.currencyName((CurrencyId)id)] = balances[id];
+    }
+    return out;
+}
+
+/**
+ * @brief Replace the wallet contents, e.g. with balances restored from a checkpoint. Every hold is dropped.
+ * @param balances Currency balances keyed by currency type.
+ */
+void Wallet::setBalances(const std::map<std::string, double> & balances)
+{
+    this->balances.clear();
+    this->reserved.clear();
+    this->present.clear();
+    this->nPresent = 0;
+    this->holds.clear();
+    this->freeHolds.clear();
+    this->openHolds.clear();
+    for(const std::pair<const std::string, double> & b : balances)
+    {
+        this->slot(SymbolTable::instance().currency(b.first)) = b.second;
+    }
+}
+
+/**
+ * @brief Balance of a currency, adding the currency to the wallet (at 0) if needed.
+ */
+double & Wallet::slot(CurrencyId id)
+{
+    if(id >= balances.size())
+    {
+        balances.resize(id + 1, 0.0);
+        reserved.resize(id + 1, 0.0);
+        present.resize(id + 1, 0);
+    }
+    if(!present[id])
+    {
+        present[id] = 1;
+        nPresent++;
+    }
+    return balances[id];
 }
 
 /**
@@ -203,35 +389,29 @@ int Wallet::getWalletLen()
  * 1. OBE type must be either "askSale" or "bidSale"
  * 2. Not currently intended to process non-user generated sales.
  * 
- * TODO: Should be updated to verify wallet can support sale.
- * @return string containing the earliest found timestamp. 
+ * The funds were held when the order was entered (see reserve()), so the sale is applied
+ * without re-checking the balance; the part of the order's hold it covers is consumed.
+ * @param sale Sale whose orderId names the user's order.
  */
-void Wallet::processSale(OrderBookEntry & sale)
+void Wallet::processSale(const OrderBookEntry & sale)
 {
-    std::vector<std::string> currs = CsvReader::tokenise(sale._product,'/');
+    ProductPair pair = SymbolTable::instance().product(sale._product);
     if(OrderBookType::asksale == sale._OrderType)
     {
-        double outGoingAmount = sale._amount;
-        double incomingAmount = sale._amount * sale._price;
-        std::string outGoingCurrency = currs[0];
-        std::string incomingCurrency = currs[1];
-
-        this->currencies[incomingCurrency] += incomingAmount;
-        this->currencies[outGoingCurrency] -= outGoingAmount;
+        //Selling base for quote.
+        this->slot(pair.quote) += sale._amount * sale._price;
+        this->slot(pair.base)  -= sale._amount;
     }
     else if(OrderBookType::bidsale == sale._OrderType)
     {
-        double outGoingAmount = sale._amount * sale._price;
-        double incomingAmount = sale._amount;
-        std::string outGoingCurrency = currs[1];
-        std::string incomingCurrency = currs[0];
-
-        this->currencies[incomingCurrency] += incomingAmount;
-        this->currencies[outGoingCurrency] -= outGoingAmount;
+        //Buying base with quote.
+        this->slot(pair.base)  += sale._amount;
+        this->slot(pair.quote) -= sale._amount * sale._price;
     }
     else
     {
-        std::cout << "Wallet::processSale - ERROR: attempting to process unsupported sale type." << std::endl;
+        MRX_LOG_ERROR("Wallet::processSale - ERROR: attempting to process unsupported sale type.");
         throw std::runtime_error(std::string("Wallet::processSale - attempting to process unsupported sale type."));
     }
-}
\ No newline at end of file
+    this->consumeHold(sale.orderId, sale._amount);
+}
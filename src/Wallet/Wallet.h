@@ -29,8 +29,10 @@
 /** @cond STDINCLUDES */
 #include <string>
 #include <map>
+#include <vector>
 #include <OrderBookLib.h>
 /** @endcond */
+#include "../OrderBookLib/SymbolTable.h"
 
 /********************************************//**
  *  Class Definitions
@@ -39,6 +41,17 @@
     @brief Class for currency exchange wallet.
 
     Serves as a wrapper for storing and handling currencies to be traded on the exchange.
+    Balances are kept in a dense array indexed by SymbolTable currency id, and products are
+    resolved to pre-split currency pairs, so pre-trade checks and settlement are indexed
+    loads and adds rather than string-keyed tree lookups.
+
+    Orders reserve the funds they may spend: reserve() places a hold and returns the order id,
+    a fill turns the matching part of the hold into the transfer, and release() gives back what
+    is left when the order is cancelled or expires. Each step is an O(1) indexed update, and
+    since held funds cannot be spent twice, processSale() needs no balance check. Released holds
+    are reused by later orders, so the hold table only grows to the most orders open at once;
+    the high 32 bits of an order id count the reuses of its slot, so a stale id never reaches
+    the order that took the slot over.
 */
 class Wallet
 {
@@ -47,11 +60,39 @@ class Wallet
         void insertCurrency(std::string type, double amount);
         bool removeCurrency(std::string type, double amount);
         bool containsCurrency(std::string type,double amount);
+        bool containsCurrency(CurrencyId id, double amount) const;
+        double getBalance(CurrencyId id) const;
+        double getAvailable(CurrencyId id) const;
+        double getReserved(CurrencyId id) const;
+        OrderId reserve(const OrderBookEntry & order);
+        bool release(OrderId id);
+        std::size_t releaseAll();
+        std::size_t getOpenHoldCount() const;
         std::string toString();
         bool canFulfillOrder(const OrderBookEntry & order);
         friend std::ostream & operator<<(std::ostream & os,Wallet & wallet);
-        void processSale(OrderBookEntry & sale);
-        int getWalletLen();
+        void processSale(const OrderBookEntry & sale);
+        int getWalletLen() const;
+        std::map<std::string, double> getBalances() const;
+        void setBalances(const std::map<std::string, double> & balances);
     private:
-        std::map<std::string, double> currencies;
+        /*! Funds reserved by one order. */
+        struct Hold
+        {
+            CurrencyId currency;
+            bool open;
+            std::uint32_t generation;   /**< Times the slot was released; the high half of its order id. */
+            double remaining;   /**< Amount still reserved. */
+            double perUnit;     /**< Reserved amount per unit of base filled: the bid price, or 1 for asks. */
+        };
+        double & slot(CurrencyId id);
+        bool findHold(OrderId id, std::size_t & index) const;
+        void consumeHold(OrderId id, double filled);
+        std::vector<double> balances;           /**< Indexed by currency id. */
+        std::vector<double> reserved;           /**< Held part of each balance, indexed by currency id. */
+        std::vector<unsigned char> present;     /**< Non-zero if the currency is in the wallet. */
+        std::size_t nPresent;
+        std::vector<Hold> holds;                /**< Indexed by the low half of the order id - 1. */
+        std::vector<std::uint32_t> freeHolds;   /**< Released slots of holds, reused by reserve(). */
+        std::vector<OrderId> openHolds;         /**< Orders that may still hold funds, released by releaseAll(). */
 };
\ No newline at end of file
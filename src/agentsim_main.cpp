@@ -0,0 +1,72 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file agentsim_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the agent-based order flow simulator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "AgentSimulator.h"
+#include "Logger.h"
+/** @cond STDINCLUDES */
+#include <exception>
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Runs simulated traders against a data set and prints order and fill rates.
+ * Returns 0 on success, 1 on bad arguments, 2 if the simulation could not run.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    std::ios::sync_with_stdio(false);
+
+    AgentSimOptions options;
+    if(!AgentSimulator::parseArgs(argc, argv, options))
+    {
+        AgentSimulator::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    int status = 0;
+    try
+    {
+        MerkelMain app{options.dataset};
+        app.setVerbose(false);
+        app.init(true);
+        AgentSimulator simulator{app, options};
+        AgentSimulator::printStats(std::cout, simulator.run());
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        status = 2;
+    }
+    Logger::instance().flush();
+    return status;
+}
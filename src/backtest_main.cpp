@@ -0,0 +1,72 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file backtest_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the backtest parameter sweep runner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "SweepRunner.h"
+/** @cond STDINCLUDES */
+#include <chrono>
+#include <exception>
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Backtests a grid of MeanReversionStrategy parameters over one data set and prints the best.
+ * Returns 0 on success, 1 on bad arguments, 2 if the sweep could not run.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    std::ios::sync_with_stdio(false);
+
+    SweepOptions options;
+    if(!SweepRunner::parseArgs(argc, argv, options))
+    {
+        SweepRunner::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        BacktestData data{options.dataset};
+        SweepRunner runner{data, options.threads};
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<BacktestResult> results = runner.run(SweepRunner::gridSize(options),
+                                                         SweepRunner::meanReversionGrid(options), options.backtest);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        SweepRunner::printResults(std::cout, options, results, seconds, runner.getThreadCount());
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file datagen_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the synthetic order data set generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "DataGenerator.h"
+/** @cond STDINCLUDES */
+#include <chrono>
+#include <exception>
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Writes a synthetic data set to the file named on the command line.
+ * Returns 0 on success, 1 on bad arguments, 2 if generation failed.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    DataGenOptions options;
+    std::string path;
+    if(!DataGenerator::parseArgs(argc, argv, options, path))
+    {
+        DataGenerator::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        DataGenerator generator{options};
+        std::size_t rows = generator.write(path);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Wrote " << rows << " rows to " << path << " in " << seconds << " s\n";
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file feedreader_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the sample market data feed reader.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "MarketDataFeed.h"
+/** @cond STDINCLUDES */
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define FEED_NAME_DEFAULT "merklerex"
+#define FEED_IDLE_SPINS   1000 /**< Empty polls before the reader starts sleeping between polls. */
+/********************************************//**
+ *  Local functions
+ ***********************************************/
+namespace
+{
+    std::atomic<bool> stopping{false};
+
+    void stopReading(int)
+    {
+        stopping = true;
+    }
+
+    const char * typeName(FeedMsgType type)
+    {
+        switch(type)
+        {
+            case FeedMsgType::clock:     return "clock";
+            case FeedMsgType::topOfBook: return "top";
+            case FeedMsgType::level:     return "level";
+            case FeedMsgType::trade:     return "trade";
+        }
+        return "unknown";
+    }
+
+    void printMessage(const MarketDataReader & reader, const FeedMessage & m)
+    {
+        std::cout << m.sequence << ' ' << typeName(m.type) << ' ' << m.timeMicros;
+        if(FeedMsgType::clock != m.type)
+        {
+            std::cout << ' ' << reader.getProductName(m.product) << ' ' << ((FeedSide::bid == m.side) ? "bid" : "ask")
+                      << ' ' << m.price << ' ' << m.amount;
+        }
+        if(FeedMsgType::topOfBook == m.type) std::cout << ' ' << m.askPrice << ' ' << m.askAmount;
+        std::cout << '\n';
+    }
+}
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Follows a market data feed and prints each message, then the number of messages read and lost.
+ * Returns 0, 1 on bad arguments, 2 if the feed cannot be opened.
+ *
+ * Options:
+ *    --feed <name>     Feed name given to MerkleRex --feed (default merklerex).
+ *    --from-start      Start at the oldest message still in the ring instead of the next one.
+ *    --count N         Stop after N messages.
+ *    --idle-ms N       Stop once no message arrived for N ms (default: run until Ctrl-C).
+ *    --quiet           Print only the summary.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    std::string name{FEED_NAME_DEFAULT};
+    bool fromStart = false;
+    bool quiet     = false;
+    unsigned long long count = 0;
+    unsigned long idleMs     = 0;
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        bool hasValue = (i + 1 < argc);
+        if(hasValue && ("--feed" == arg))         name   = argv[++i];
+        else if(hasValue && ("--count" == arg))   count  = std::strtoull(argv[++i], nullptr, 10);
+        else if(hasValue && ("--idle-ms" == arg)) idleMs = std::strtoul(argv[++i], nullptr, 10);
+        else if("--from-start" == arg)            fromStart = true;
+        else if("--quiet" == arg)                 quiet = true;
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--feed <name>] [--from-start] [--count N] [--idle-ms N] [--quiet]\n";
+            return 1;
+        }
+    }
+
+    MarketDataReader reader;
+    try
+    {
+        reader.open(name, fromStart);
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 2;
+    }
+    std::signal(SIGINT, stopReading);
+    std::signal(SIGTERM, stopReading);
+
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    Clock::time_point lastMessage = start;
+    unsigned spins = 0;
+    FeedMessage m;
+    while(!stopping && ((0 == count) || (reader.getReceived() < count)))
+    {
+        if(reader.next(m))
+        {
+            if(!quiet) printMessage(reader, m);
+            spins = 0;
+            if(0 != idleMs) lastMessage = Clock::now();
+            continue;
+        }
+        if(++spins < FEED_IDLE_SPINS) continue;
+        if((0 != idleMs) && (Clock::now() - lastMessage > std::chrono::milliseconds(idleMs))) break;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "Read " << reader.getReceived() << " messages, lost " << reader.getLost()
+              << ", in " << seconds << " s" << std::endl;
+    return 0;
+}
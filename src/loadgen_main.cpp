@@ -0,0 +1,64 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file loadgen_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the order-entry gateway load generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "GatewayLoadGen.h"
+/** @cond STDINCLUDES */
+#include <exception>
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Sends orders to a running gateway (MerkleRex --gateway) and prints the throughput and ack latency.
+ * Returns 0 on success, 1 on bad arguments, 2 if the run failed.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    LoadGenOptions options;
+    if(!GatewayLoadGen::parseArgs(argc, argv, options))
+    {
+        GatewayLoadGen::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        GatewayLoadGen generator{options};
+        GatewayLoadGen::printResult(std::cout, generator.run());
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -28,8 +28,17 @@
  *  Includes
  ***********************************************/
 #include "UserMenuIF.h"
+#include "MetricsExporter.h"
+#include "ScriptRunner.h"
+#include "OrderGateway.h"
+#include "MarketDataFeed.h"
+#include "Logger.h"
 /** @cond STDINCLUDES */
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <string>
 /** @endcond */
 /********************************************//**
  *  Defines
@@ -47,17 +56,187 @@
 /********************************************//**
  *  Local functions
  ***********************************************/
+namespace
+{
+    OrderGateway * runningGateway = nullptr;
+
+    void stopGateway(int)
+    {
+        if(nullptr != runningGateway) runningGateway->stop();
+    }
+
+    /**
+     * @brief Serves order-entry clients until SIGINT or SIGTERM. Returns 1 if the endpoint cannot be opened.
+     */
+    int runGateway(MerkelMain & app, const std::string & endpoint, unsigned tickMs)
+    {
+        OrderGateway gateway{app};
+        try
+        {
+            gateway.listen(endpoint);
+        }
+        catch(const std::exception &e)
+        {
+            std::cout << e.what() << std::endl;
+            return 1;
+        }
+        std::cout << "Gateway listening on " << endpoint << ", next timeframe every " << tickMs << " ms" << std::endl;
+        runningGateway = &gateway;
+        std::signal(SIGINT, stopGateway);
+        std::signal(SIGTERM, stopGateway);
+        gateway.run(tickMs);
+        runningGateway = nullptr;
+
+        const GatewayStats & stats = gateway.getStats();
+        std::cout << "Gateway stopped: " << stats.accepted << " connections, " << stats.messages << " requests, "
+                  << stats.rejected << " rejected, " << stats.fills << " fills" << std::endl;
+        return 0;
+    }
+}
 
 /***************************************************************************//**
- * Main(void)
+ * Main(int, char**)
  *
- * Present user with an interactive menu. Always returns 0
+ * Present user with an interactive menu, run a command script, or serve order-entry clients.
+ * Returns 0, or 1 if a script or gateway cannot be run.
  *
- * @param none Nothing yet
+ * Options:
+ *    --data <path>         Data set to load (default DataSets/OrderBook_Example.csv, see MerkleRex_DataGen).
+ *    --journal <path>      Journal user orders and fills to <path>, replaying it first if it exists.
+ *    --checkpoint <path>   Save checkpoints (menu option 7) to <path>.
+ *    --restore <path>      Resume from the checkpoint at <path>; later checkpoints are saved there too.
+ *    --latency <path>      Write latency histograms (menu option 8) to <path>.
+ *    --metrics <target>    Export Prometheus metrics to a file, or to a socket given as unix:<path>.
+ *    --metrics-interval ms Export interval (default 1000).
+ *    --log <path>          Write log output to <path> instead of the console.
+ *    --feed <name>         Publish book changes and trades to shared memory /dev/shm/<name>. @see MarketDataPublisher
+ *    --script <path>       Run the commands of a script (- for stdin) instead of the menu. @see ScriptRunner
+ *    --gateway <endpoint>  Serve binary order entry on unix:<path> or tcp:<port> instead of the menu. @see OrderGateway
+ *    --tick-ms ms          Gateway time between timeframes (default 1000, 0 never advances).
+ *
+ * @param argc Argument count
+ * @param argv Argument values
  ******************************************************************************/
-int main(void)
+int main(int argc, char ** argv)
 {
-    MerkelMain app{FNAME_DATA_NOMINAL};
-    app.init(false);
+    //The data set is loaded on construction, so find it before the other options are applied.
+    std::string dataset{FNAME_DATA_NOMINAL};
+    for(int i = 1; i + 1 < argc; i++)
+    {
+        if(std::string("--data") == argv[i]) dataset = argv[i + 1];
+    }
+
+    MarketDataPublisher feed;
+    MerkelMain app{dataset};
+    MetricsExporter exporter;
+    std::string metricsTarget;
+    unsigned metricsInterval = METRICS_INTERVAL_MS_DEFAULT;
+    std::string scriptPath;
+    std::string gatewayEndpoint;
+    unsigned tickMs = GW_TICK_MS_DEFAULT;
+    for(int i = 1; i < argc; i++)
+    {
+        std::string arg{argv[i]};
+        if(("--data" == arg) && (i + 1 < argc))
+        {
+            i++;
+        }
+        else if(("--journal" == arg) && (i + 1 < argc))
+        {
+            app.setJournal(argv[++i]);
+        }
+        else if(("--checkpoint" == arg) && (i + 1 < argc))
+        {
+            app.setCheckpoint(argv[++i],false);
+        }
+        else if(("--restore" == arg) && (i + 1 < argc))
+        {
+            app.setCheckpoint(argv[++i],true);
+        }
+        else if(("--latency" == arg) && (i + 1 < argc))
+        {
+            app.setLatencyDump(argv[++i]);
+        }
+        else if(("--metrics" == arg) && (i + 1 < argc))
+        {
+            metricsTarget = argv[++i];
+        }
+        else if(("--metrics-interval" == arg) && (i + 1 < argc))
+        {
+            metricsInterval = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if(("--log" == arg) && (i + 1 < argc))
+        {
+            if(!Logger::instance().open(argv[++i])) std::cout << "Warning: cannot open log file " << argv[i] << std::endl;
+        }
+        else if(("--feed" == arg) && (i + 1 < argc))
+        {
+            try
+            {
+                feed.open(argv[++i]);
+                app.setMarketData(&feed);
+            }
+            catch(const std::exception &e)
+            {
+                std::cout << "Warning: market data feed disabled. " << e.what() << std::endl;
+            }
+        }
+        else if(("--script" == arg) && (i + 1 < argc))
+        {
+            scriptPath = argv[++i];
+        }
+        else if(("--gateway" == arg) && (i + 1 < argc))
+        {
+            gatewayEndpoint = argv[++i];
+        }
+        else if(("--tick-ms" == arg) && (i + 1 < argc))
+        {
+            tickMs = (unsigned)std::strtoul(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            std::cout << "Usage: " << argv[0] << " [--data <path>] [--journal <path>] [--checkpoint <path> | --restore <path>]"
+                      << " [--latency <path>] [--metrics <path | unix:path>] [--metrics-interval ms] [--log <path>] [--feed <name>] [--script <path | ->]"
+                      << " [--gateway <unix:path | tcp:port>] [--tick-ms ms]" << std::endl;
+            return 0;
+        }
+    }
+    if(!metricsTarget.empty())
+    {
+        try
+        {
+            exporter.start(metricsTarget, metricsInterval);
+        }
+        catch(const std::exception &e)
+        {
+            std::cout << "Warning: metrics export disabled. " << e.what() << std::endl;
+        }
+    }
+    if(scriptPath.empty() && gatewayEndpoint.empty())
+    {
+        app.init(false);
+        return 0;
+    }
+
+    app.init(true);
+    if(MerkelState::READY != app.getCurrentState()) return 1;
+    if(!gatewayEndpoint.empty())
+    {
+        app.setVerbose(false);
+        return runGateway(app, gatewayEndpoint, tickMs);
+    }
+    std::ifstream file;
+    if("-" != scriptPath)
+    {
+        file.open(scriptPath, std::ios::binary);
+        if(!file)
+        {
+            std::cout << "Cannot open script " << scriptPath << std::endl;
+            return 1;
+        }
+    }
+    ScriptRunner runner{app};
+    ScriptStats stats = runner.run(("-" == scriptPath) ? std::cin : file);
+    ScriptRunner::printStats(std::cout, stats);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file perfgate_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the performance regression gate.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "PerfGate.h"
+/** @cond STDINCLUDES */
+#include <exception>
+#include <fstream>
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Measures the engine, writes the results as JSON and compares them with a baseline.
+ * Returns 0 if no metric regressed, 1 on bad arguments, 2 if measuring failed,
+ * 3 if at least one metric regressed.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    PerfGateOptions options;
+    if(!PerfGate::parseArgs(argc, argv, options))
+    {
+        PerfGate::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        std::vector<PerfMetric> results = PerfGate{options}.run();
+
+        std::string outPath = options.updateBaseline ? options.baselinePath : options.outPath;
+        std::ofstream out{outPath};
+        PerfGate::writeJson(out, results);
+        if(!out) throw std::runtime_error("Cannot write " + outPath);
+        std::cout << "Results written to " << outPath << '\n';
+
+        if(options.updateBaseline || options.baselinePath.empty())
+        {
+            PerfGate::compare(results, results, std::cout);
+            return 0;
+        }
+
+        std::size_t regressions = PerfGate::compare(results, PerfGate::readJson(options.baselinePath), std::cout);
+        if(regressions > 0)
+        {
+            std::cout << regressions << " metric(s) regressed against " << options.baselinePath << '\n';
+            return 3;
+        }
+        std::cout << "No regressions against " << options.baselinePath << '\n';
+    }
+    catch(const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file replay_main.cpp
+ * @author Edward Martinez
+ * @brief Entry point for the headless batch replay runner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include "ReplayRunner.h"
+/** @cond STDINCLUDES */
+#include <iostream>
+/** @endcond */
+
+/***************************************************************************//**
+ * Main(int, char**)
+ *
+ * Replays the data sets named on the command line and prints throughput.
+ * Returns 0 on success, 1 on bad arguments, 2 if no data set could be replayed.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ ******************************************************************************/
+int main(int argc, char ** argv)
+{
+    std::ios::sync_with_stdio(false);
+
+    ReplayOptions options;
+    if(!ReplayRunner::parseArgs(argc, argv, options))
+    {
+        ReplayRunner::printUsage(std::cerr, argv[0]);
+        return 1;
+    }
+
+    ReplayRunner runner{options};
+    ReplayStats stats = runner.run();
+    ReplayRunner::printStats(std::cout, stats);
+    return (stats.datasets > 0) ? 0 : 2;
+}
@@ -0,0 +1,138 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file AgentSimTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the work-stealing pool and the agent simulator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Agents/AgentSimulator.h"
+#include "../src/DataGen/DataGenerator.h"
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define AGENT_TEST_FNAME "AgentSimTest.csv"
+
+/********************************************//**
+ *  Local functions
+ ***********************************************/
+namespace
+{
+    /*! Outcome of one simulation: totals and every agent balance. */
+    struct AgentRun
+    {
+        AgentSimStats stats;
+        std::vector<double> balances;
+    };
+
+    AgentRun simulate(std::uint64_t seed, unsigned threads)
+    {
+        AgentSimOptions opt;
+        opt.dataset      = AGENT_TEST_FNAME;
+        opt.marketMakers = 300;
+        opt.momentum     = 300;
+        opt.noise        = 600;
+        opt.seed         = seed;
+        opt.threads      = threads;
+        MerkelMain app{opt.dataset};
+        app.setVerbose(false);
+        app.init(true);
+        AgentSimulator sim{app, opt};
+
+        AgentRun run;
+        run.stats = sim.run();
+        std::size_t currencies = SymbolTable::instance().currencyCount();
+        for(std::size_t a = 0; a < app.getLedger().getAccountCount(); a++)
+        {
+            for(CurrencyId c = 0; c < currencies; c++) run.balances.push_back(app.getLedger().getBalance((AccountId)a, c));
+        }
+        return run;
+    }
+}
+
+/**
+ *  Check that every task of a batch runs exactly once, that idle workers steal, and that a
+ *  task's exception reaches the caller.
+ */
+TEST(AgentSimTests,TestCase_01)
+{
+    for(unsigned threads : {1u, 4u})
+    {
+        WorkStealingPool pool{threads};
+        EXPECT_THAT(pool.getThreadCount(),testing::Eq(threads));
+        for(std::size_t tasks : {0, 1, 7, 1000})
+        {
+            std::vector<std::atomic<int>> runs(tasks);
+            for(std::atomic<int> & r : runs) r = 0;
+            pool.run(tasks, [&](std::size_t task, unsigned worker)
+            {
+                EXPECT_THAT(worker,testing::Lt(threads));
+                //Uneven work: the first worker's block is much slower, so the others steal from it.
+                if(task < tasks / threads) for(volatile int spin = 0; spin < 20000; spin++) {}
+                runs[task]++;
+            });
+            for(std::atomic<int> & r : runs) EXPECT_THAT(r.load(),testing::Eq(1));
+        }
+        if(threads > 1)
+        {
+            EXPECT_THAT(pool.getSteals(),testing::Gt(0));
+        }
+        EXPECT_THROW(pool.run(10, [](std::size_t task, unsigned){ if(task == 5) throw std::runtime_error("task"); }),
+                     std::runtime_error);
+    }
+}
+
+/**
+ *  Check that a simulation depends on its seed only, not on the thread count, and that no
+ *  agent spends more than it holds.
+ */
+TEST(AgentSimTests,TestCase_02)
+{
+    DataGenOptions gen;
+    gen.frames = 100;
+    gen.ordersPerFrame = 30;
+    DataGenerator{gen}.write(std::string(AGENT_TEST_FNAME));
+
+    AgentRun single = simulate(7, 1);
+    AgentRun multi  = simulate(7, 3);
+    AgentRun other  = simulate(8, 3);
+    std::remove(AGENT_TEST_FNAME);
+
+    EXPECT_THAT(single.stats.agents,testing::Eq(1200));
+    EXPECT_THAT(single.stats.ticks,testing::Eq(100));
+    EXPECT_THAT(single.stats.generated,testing::Gt(100000));
+    EXPECT_THAT(single.stats.accepted,testing::Eq(single.stats.generated));
+    EXPECT_THAT(single.stats.fills,testing::Gt(0));
+
+    EXPECT_THAT(multi.stats.generated,testing::Eq(single.stats.generated));
+    EXPECT_THAT(multi.stats.fills,testing::Eq(single.stats.fills));
+    EXPECT_THAT(multi.balances,testing::Eq(single.balances));
+    EXPECT_THAT(other.balances,testing::Ne(single.balances));
+    for(double b : single.balances) EXPECT_THAT(b,testing::Ge(0.0));
+}
@@ -0,0 +1,163 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file AnalyticsTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for trade analytics (candles, rolling statistics).
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/OrderBookLib/OrderBookLib.h"
+#include "../src/Analytics/CandleBuilder.h"
+#include "../src/Analytics/RollingStats.h"
+#include <cmath>
+
+/********************************************//**
+ *  GTest Fixtures
+ ***********************************************/
+/**
+ * @brief Test fixture with a 1s/1m candle builder keeping two finished candles.
+ */
+class CandleTests : public testing::Test
+{
+    protected:
+
+    CandleTests()
+    : builder({CANDLE_MICROS_1S, CANDLE_MICROS_1M}, 2)
+    {
+    }
+    CandleBuilder builder;
+    std::string prod = "ETH/BTC";
+    std::int64_t t0 = OrderBookEntry::timestampToMicros("2020/03/17 17:01:24.000000");
+};
+
+/**
+ *  Check timestamp conversion against a known epoch value.
+ */
+TEST(TimestampTests,TestCase_01)
+{
+    EXPECT_THAT(OrderBookEntry::timestampToMicros("2020/03/17 17:01:24.884492"),testing::Eq(1584464484884492LL));
+    EXPECT_THAT(OrderBookEntry::timestampToMicros("1970/01/01 00:00:00"),testing::Eq(0));
+    EXPECT_THAT(OrderBookEntry::timestampToMicros("not a timestamp"),testing::Eq(-1));
+}
+
+/**
+ *  Check OHLCV of trades falling into a single bucket.
+ */
+TEST_F(CandleTests,TestCase_01)
+{
+    builder.onTrade(prod,t0,        0.020,1.0);
+    builder.onTrade(prod,t0 + 1000, 0.025,0.5);
+    builder.onTrade(prod,t0 + 2000, 0.015,0.5);
+    builder.onTrade(prod,t0 + 3000, 0.021,2.0);
+
+    const Candle * c = builder.getCurrent(prod,0);
+    ASSERT_THAT(c,testing::NotNull());
+    EXPECT_THAT(c->open,testing::Eq(0.020));
+    EXPECT_THAT(c->high,testing::Eq(0.025));
+    EXPECT_THAT(c->low,testing::Eq(0.015));
+    EXPECT_THAT(c->close,testing::Eq(0.021));
+    EXPECT_THAT(c->volume,testing::Eq(4.0));
+    EXPECT_THAT(c->trades,testing::Eq(4));
+}
+
+/**
+ *  Check that a trade in a later bucket finishes the open candle of the finer resolution only.
+ */
+TEST_F(CandleTests,TestCase_02)
+{
+    builder.onTrade(prod,t0,                    0.020,1.0);
+    builder.onTrade(prod,t0 + CANDLE_MICROS_1S, 0.030,1.0);
+
+    EXPECT_THAT(builder.getHistory(prod,0)->size(),testing::Eq(1));
+    EXPECT_THAT(builder.getHistory(prod,0)->newest().close,testing::Eq(0.020));
+    EXPECT_THAT(builder.getHistory(prod,1)->size(),testing::Eq(0));
+    EXPECT_THAT(builder.getCurrent(prod,1)->trades,testing::Eq(2));
+}
+
+/**
+ *  Check that the history ring keeps only the newest candles.
+ */
+TEST_F(CandleTests,TestCase_03)
+{
+    for(int i = 0; i < 5; i++)
+    {
+        builder.onTrade(prod,t0 + i * CANDLE_MICROS_1S,0.01 * (i + 1),1.0);
+    }
+    const CandleRing * ring = builder.getHistory(prod,0);
+    EXPECT_THAT(ring->size(),testing::Eq(2));
+    EXPECT_THAT(ring->at(0).open,testing::DoubleEq(0.03));
+    EXPECT_THAT(ring->at(1).open,testing::DoubleEq(0.04));
+}
+
+/**
+ *  Check that sales are bucketed using their timestamp string.
+ */
+TEST_F(CandleTests,TestCase_04)
+{
+    OrderBookEntry sale{"2020/03/17 17:01:24.884492",prod,OrderBookType::asksale,0.02,1.5};
+    builder.onSale(sale);
+    EXPECT_THAT(builder.getCurrent(prod,1)->start,testing::Eq(1584464460000000LL));
+    EXPECT_THAT(builder.getCurrent("DOGE/BTC",1),testing::IsNull());
+}
+
+/**
+ *  Check VWAP, TWAP and volatility over a window that still holds every trade.
+ */
+TEST(RollingStatsTests,TestCase_01)
+{
+    RollingStats stats({CANDLE_MICROS_1M});
+    std::int64_t t0 = OrderBookEntry::timestampToMicros("2020/03/17 17:01:00.000000");
+    stats.onTrade("ETH/BTC",t0,                       1.0,1.0);
+    stats.onTrade("ETH/BTC",t0 + 10 * CANDLE_MICROS_1S,2.0,3.0);
+    stats.onTrade("ETH/BTC",t0 + 40 * CANDLE_MICROS_1S,4.0,1.0);
+
+    RollingSnapshot rs;
+    ASSERT_THAT(stats.get("ETH/BTC",0,rs),true);
+    EXPECT_THAT(rs.trades,testing::Eq(3));
+    EXPECT_THAT(rs.vwap,testing::DoubleEq((1.0 + 6.0 + 4.0) / 5.0));
+    EXPECT_THAT(rs.twap,testing::DoubleEq((1.0 * 10 + 2.0 * 30) / 40.0));
+    EXPECT_THAT(rs.volatility,testing::DoubleNear(0.0,1e-12)); //Both returns are ln(2).
+}
+
+/**
+ *  Check that trades older than the window are evicted from every sum.
+ */
+TEST(RollingStatsTests,TestCase_02)
+{
+    RollingStats stats({CANDLE_MICROS_1M});
+    std::int64_t t0 = OrderBookEntry::timestampToMicros("2020/03/17 17:01:00.000000");
+    stats.onTrade("ETH/BTC",t0,                        8.0,10.0);
+    stats.onTrade("ETH/BTC",t0 + 70 * CANDLE_MICROS_1S, 1.0,1.0);
+    stats.onTrade("ETH/BTC",t0 + 80 * CANDLE_MICROS_1S, 2.0,1.0);
+    stats.onTrade("ETH/BTC",t0 + 90 * CANDLE_MICROS_1S, 1.0,1.0);
+
+    RollingSnapshot rs;
+    ASSERT_THAT(stats.get("ETH/BTC",0,rs),true);
+    EXPECT_THAT(rs.trades,testing::Eq(3));
+    EXPECT_THAT(rs.volume,testing::DoubleEq(3.0));
+    EXPECT_THAT(rs.vwap,testing::DoubleEq(4.0 / 3.0));
+    EXPECT_THAT(rs.twap,testing::DoubleEq(1.5));
+    EXPECT_THAT(rs.volatility,testing::DoubleNear(std::log(2.0) * std::sqrt(2.0),1e-9));
+    EXPECT_THAT(stats.get("DOGE/BTC",0,rs),false);
+}
@@ -0,0 +1,158 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file BacktestTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the strategy backtester and parameter sweeps.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Backtest/SweepRunner.h"
+#include "../src/DataGen/DataGenerator.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+#include <cstdio>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define BACKTEST_TEST_FNAME "BacktestTest.csv"
+
+/********************************************//**
+ *  Local functions
+ ***********************************************/
+namespace
+{
+    /*! Crosses the spread on every product each tick, alternating sides, and records what it sent. */
+    class ScriptedStrategy : public Strategy
+    {
+        public:
+            std::vector<std::vector<OrderBookEntry>> sent;  /**< Orders per tick. */
+            std::size_t fills = 0;
+            void onTick(const BookView & book, const std::string & timestamp) override
+            {
+                sent.emplace_back();
+                for(std::size_t p = 0; p < book.getProducts().size(); p++)
+                {
+                    const BookTop & top = book.getTop(p);
+                    bool buy = (0 == (sent.size() + p) % 2);
+                    double price = buy ? top.ask : top.bid;
+                    if(price <= 0.0) continue;
+                    OrderId id = buy ? this->bid(p, price, 0.5) : this->ask(p, price, 0.5);
+                    if(ORDER_ID_NONE == id) continue;
+                    sent.back().emplace_back(timestamp, book.getProducts()[p], buy ? OrderBookType::bid : OrderBookType::ask, price, 0.5);
+                }
+            }
+            void onFill(const OrderBookEntry &) override
+            {
+                fills++;
+            }
+    };
+}
+
+/**
+ *  Check that a backtest ends with the same wallet and fills as sending the strategy's orders
+ *  through MerkelMain, and that the book view shows each timeframe's best prices.
+ */
+TEST(BacktestTests,TestCase_01)
+{
+    DataGenOptions gen;
+    gen.frames = 200;
+    gen.ordersPerFrame = 30;
+    DataGenerator{gen}.write(std::string(BACKTEST_TEST_FNAME));
+
+    BacktestData data{std::string(BACKTEST_TEST_FNAME)};
+    ScriptedStrategy strategy;
+    Backtester backtest{data, strategy};
+    BacktestResult result = backtest.run();
+    EXPECT_THAT(result.ticks,testing::Eq(200));
+    EXPECT_THAT(result.fills,testing::Eq(strategy.fills));
+    EXPECT_THAT(result.fills,testing::Gt(0));
+    EXPECT_THAT(result.equity,testing::Gt(0.0));
+
+    MerkelMain app{BACKTEST_TEST_FNAME};
+    app.setVerbose(false);
+    app.init(true);
+    std::size_t fills = 0;
+    app.setFillListener([&fills](const OrderBookEntry &){ fills++; });
+    OrderBook book = app.getOrders();
+    for(std::size_t f = 0; f < data.getFrameCount(); f++)
+    {
+        EXPECT_THAT(data.getFrame(f).timestamp,testing::Eq(app.getCurrentTime()));
+        for(std::size_t p = 0; p < data.getProducts().size(); p++)
+        {
+            OrderBookDepth depth;
+            ASSERT_TRUE(book.getBookAt(data.getProducts()[p], app.getCurrentTime(), depth));
+            EXPECT_THAT(data.getTops(f)[p].ask,testing::Eq(depth.asks.empty() ? 0.0 : depth.asks.front()._price));
+            EXPECT_THAT(data.getTops(f)[p].bid,testing::Eq(depth.bids.empty() ? 0.0 : depth.bids.front()._price));
+        }
+        for(OrderBookEntry & order : strategy.sent[f]) EXPECT_THAT(app.submitOrder(order),testing::Ne(ORDER_ID_NONE));
+        app.processNext();
+    }
+    std::remove(BACKTEST_TEST_FNAME);
+
+    EXPECT_THAT(fills,testing::Eq(result.fills));
+    EXPECT_THAT(app.getWallet().getBalances(),testing::Eq(result.balances));
+}
+
+/**
+ *  Check that a sweep returns every combination's own result, the same as running it alone,
+ *  whatever the thread count.
+ */
+TEST(BacktestTests,TestCase_02)
+{
+    DataGenOptions gen;
+    gen.frames = 300;
+    gen.ordersPerFrame = 30;
+    DataGenerator{gen}.write(std::string(BACKTEST_TEST_FNAME));
+    BacktestData data{std::string(BACKTEST_TEST_FNAME)};
+    std::remove(BACKTEST_TEST_FNAME);
+
+    SweepOptions grid;
+    grid.edges  = {0.0005, 0.001, 0.002};
+    grid.alphas = {0.05, 0.2};
+    grid.sizes  = {0.1, 1.0};
+    ASSERT_THAT(SweepRunner::gridSize(grid),testing::Eq(12));
+    StrategyFactory factory = SweepRunner::meanReversionGrid(grid);
+
+    std::vector<BacktestResult> single = SweepRunner{data, 1}.run(SweepRunner::gridSize(grid), factory);
+    std::vector<BacktestResult> multi  = SweepRunner{data, 4}.run(SweepRunner::gridSize(grid), factory);
+    ASSERT_THAT(single.size(),testing::Eq(12));
+    ASSERT_THAT(multi.size(),testing::Eq(12));
+
+    std::size_t fills = 0;
+    for(std::size_t c = 0; c < single.size(); c++)
+    {
+        std::unique_ptr<Strategy> strategy = factory(c);
+        BacktestResult alone = Backtester{data, *strategy}.run();
+        EXPECT_THAT(single[c].fills,testing::Eq(alone.fills));
+        EXPECT_THAT(single[c].balances,testing::Eq(alone.balances));
+        EXPECT_THAT(multi[c].fills,testing::Eq(alone.fills));
+        EXPECT_THAT(multi[c].balances,testing::Eq(alone.balances));
+        EXPECT_THAT(multi[c].equity,testing::Eq(alone.equity));
+        EXPECT_THAT(static_cast<MeanReversionStrategy &>(*strategy).getFillCount(),testing::Eq(alone.fills));
+        fills += alone.fills;
+    }
+    EXPECT_THAT(fills,testing::Gt(0));
+    EXPECT_THAT(single[0].balances,testing::Ne(single[11].balances));
+}
@@ -0,0 +1,302 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file CheckpointTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for Checkpoint save/restore.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdio>
+#include "../src/OrderBookLib/OrderBookLib.h"
+#include "../src/OrderBookLib/OrderBook.h"
+#include "../src/Checkpoint/Checkpoint.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define TESTCASE_03_FNAME "DataSets/MatchTest_03.csv"
+/********************************************//**
+ *  Local Functions
+ ***********************************************/
+/**
+ * @brief Flattens a snapshot back into a list of entries in timestamp order.
+ */
+static std::vector<OrderBookEntry> flatten(const OrderBookSnapshot & snap)
+{
+    std::vector<OrderBookEntry> entries;
+    for(const OrderBookFrame & frame : *snap)
+    {
+        entries.insert(entries.end(),frame.orders.begin(),frame.orders.end());
+    }
+    return entries;
+}
+/********************************************//**
+ *  GTest Fixtures
+ ***********************************************/
+/**
+ * @brief Test fixture holding a loaded orderbook and a scratch checkpoint path.
+ */
+class CheckpointTests : public testing::Test
+{
+    protected:
+
+    CheckpointTests()
+    {
+        path = testing::TempDir() + "MerkleRex_CheckpointTest.ckpt";
+        OrderBookEntry userBid{book.getEarliestTime(),"ETH/BTC",OrderBookType::bid,0.03,0.1};
+        userBid.username = "simuser";
+        userBid.orderId  = 42;
+        book.insertOrder(userBid);
+        OrderBookEntry agentAsk{book.getEarliestTime(),"ETH/BTC",OrderBookType::ask,0.05,0.2};
+        agentAsk.username = "agent";
+        agentAsk.account  = 7;
+        book.insertOrder(agentAsk);
+    }
+    ~CheckpointTests()
+    {
+        std::remove(path.c_str());
+    }
+    std::string path;
+    OrderBook book{TESTCASE_03_FNAME};
+};
+
+/**
+ *  Check that orders, wallet balances and time survive a round trip.
+ */
+TEST_F(CheckpointTests,TestCase_01)
+{
+    CheckpointState saved;
+    saved.currentTime = book.getEarliestTime();
+    saved.orders      = book.snapshot();
+    saved.balances["BTC"] = 9.5;
+    saved.balances["ETH"] = 0.25;
+    Checkpoint::write(path,saved);
+
+    std::vector<OrderBookEntry> orders;
+    CheckpointState restored = Checkpoint::read(path,orders);
+    std::vector<OrderBookEntry> expected = flatten(saved.orders);
+
+    EXPECT_THAT(restored.currentTime,testing::Eq(saved.currentTime));
+    EXPECT_THAT(restored.balances,testing::Eq(saved.balances));
+    ASSERT_THAT(orders.size(),testing::Eq(expected.size()));
+    for(std::size_t i = 0; i < orders.size(); i++)
+    {
+        EXPECT_THAT(orders[i]._timestamp,testing::Eq(expected[i]._timestamp));
+        EXPECT_THAT(orders[i]._product,testing::Eq(expected[i]._product));
+        EXPECT_THAT(orders[i]._OrderType,testing::Eq(expected[i]._OrderType));
+        EXPECT_THAT(orders[i]._price,testing::Eq(expected[i]._price));
+        EXPECT_THAT(orders[i]._amount,testing::Eq(expected[i]._amount));
+        EXPECT_THAT(orders[i].username,testing::Eq(expected[i].username));
+        EXPECT_THAT(orders[i].account,testing::Eq(expected[i].account));
+        EXPECT_THAT(orders[i].orderId,testing::Eq(expected[i].orderId));
+    }
+    EXPECT_THAT(orders.back().account,testing::Eq(7));
+    EXPECT_THAT(orders[orders.size() - 2].orderId,testing::Eq(42));
+}
+
+/**
+ *  Check that a snapshot is unaffected by orders inserted after it was taken.
+ */
+TEST_F(CheckpointTests,TestCase_02)
+{
+    OrderBookSnapshot snap = book.snapshot();
+    std::size_t nBefore = flatten(snap).size();
+
+    OrderBookEntry ask{book.getEarliestTime(),"ETH/BTC",OrderBookType::ask,0.02,1.0};
+    book.insertOrder(ask);
+
+    EXPECT_THAT(flatten(snap).size(),testing::Eq(nBefore));
+    EXPECT_THAT(book.getOrderCount(),testing::Eq(nBefore + 1));
+}
+
+/**
+ *  Check that the background writer produces a readable checkpoint.
+ */
+TEST_F(CheckpointTests,TestCase_03)
+{
+    CheckpointState saved;
+    saved.currentTime = book.getEarliestTime();
+    saved.orders      = book.snapshot();
+
+    CheckpointWriter writer;
+    writer.start(path,saved);
+    writer.wait();
+    EXPECT_THAT(writer.lastWriteOk(),true);
+
+    std::vector<OrderBookEntry> orders;
+    Checkpoint::read(path,orders);
+    EXPECT_THAT(orders.size(),testing::Eq(book.getOrderCount()));
+}
+
+/**
+ *  Check that a write after a snapshot or a book copy duplicates only the frame it touches,
+ *  and that the copies stay independent.
+ */
+TEST_F(CheckpointTests,TestCase_04)
+{
+    OrderBookEntry later{"2099/01/01 00:00:00.000000","ETH/BTC",OrderBookType::bid,0.01,1.0};
+    book.insertOrder(later);
+    OrderBookSnapshot snap = book.snapshot();
+    OrderBook copy = book;
+    ASSERT_THAT(snap->size(),testing::Gt(1));
+    std::string first = snap->front().timestamp;
+    std::size_t nFirst = snap->front().orders.size();
+
+    OrderBookEntry ask{first,"ETH/BTC",OrderBookType::ask,0.02,1.0};
+    book.insertOrder(ask);
+
+    EXPECT_THAT(snap->front().orders.size(),testing::Eq(nFirst));
+    EXPECT_THAT(book.getOrderCount(first),testing::Eq(nFirst + 1));
+    EXPECT_THAT(copy.getOrderCount(first),testing::Eq(nFirst));
+    EXPECT_THAT(book.getFrame(first),testing::Ne(&snap->front()));
+    EXPECT_THAT(copy.getFrame(first),testing::Eq(&snap->front()));
+    for(std::size_t i = 1; i < snap->size(); i++)
+    {
+        EXPECT_THAT(book.getFrame((*snap)[i].timestamp),testing::Eq(&(*snap)[i]));
+    }
+
+    copy.insertOrder(ask);
+    EXPECT_THAT(copy.getOrderCount(first),testing::Eq(nFirst + 1));
+    EXPECT_THAT(copy.getFrame(first),testing::Ne(book.getFrame(first)));
+    EXPECT_THAT(snap->front().orders.size(),testing::Eq(nFirst));
+}
+
+/**
+ *  Check that a corrupt order count is rejected before anything is allocated for it.
+ */
+TEST_F(CheckpointTests,TestCase_05)
+{
+    CheckpointState saved;
+    saved.currentTime = "t";
+    Checkpoint::write(path,saved);
+
+    //magic, current time, three empty tables and no balances come before the order count.
+    long countAt = 8 + (2 + 1) + 3 * 4 + 4;
+    std::FILE * f = std::fopen(path.c_str(),"r+b");
+    ASSERT_THAT(f,testing::NotNull());
+    //A count whose size in bytes wraps around to 1, followed by a record's worth of bytes.
+    std::uint64_t huge = 37;
+    for(int i = 0; i < 6; i++) huge *= 2 - 37 * huge;
+    char tail[37] = {0};
+    std::fseek(f,countAt,SEEK_SET);
+    std::fwrite(&huge,sizeof(huge),1,f);
+    std::fwrite(tail,sizeof(tail),1,f);
+    std::fclose(f);
+
+    std::vector<OrderBookEntry> orders;
+    EXPECT_THROW(Checkpoint::read(path,orders),std::runtime_error);
+    EXPECT_THAT(orders.capacity(),testing::Eq(0));
+}
+
+/**
+ *  Check that a failed background write keeps its error, and that MerkelMain reports it on the
+ *  next save and at shutdown.
+ */
+TEST_F(CheckpointTests,TestCase_06)
+{
+    std::string badPath = testing::TempDir() + "no_such_dir/MerkleRex_CheckpointTest.ckpt";
+    CheckpointState saved;
+    saved.currentTime = book.getEarliestTime();
+    saved.orders      = book.snapshot();
+
+    CheckpointWriter writer;
+    writer.start(badPath,saved);
+    writer.wait();
+    EXPECT_THAT(writer.lastWriteOk(),testing::Eq(false));
+    EXPECT_THAT(writer.lastError(),testing::HasSubstr("Failed to open"));
+    writer.start(path,saved);
+    writer.wait();
+    EXPECT_THAT(writer.lastWriteOk(),testing::Eq(true));
+    EXPECT_THAT(writer.lastError(),testing::IsEmpty());
+
+    testing::internal::CaptureStdout();
+    {
+        MerkelMain app{TESTCASE_03_FNAME};
+        app.setVerbose(false);
+        app.setCheckpoint(badPath,false);
+        app.init(true);
+        app.saveCheckpoint();
+        app.saveCheckpoint();   //Reports the first failure.
+    }                           //Reports the second one.
+    std::string out = testing::internal::GetCapturedStdout();
+    std::size_t first = out.find("failed to save checkpoint");
+    ASSERT_THAT(first,testing::Ne(std::string::npos));
+    EXPECT_THAT(out.find("failed to save checkpoint",first + 1),testing::Ne(std::string::npos));
+}
+
+/**
+ *  Check that restoring a checkpoint with a journal replays only the records written after
+ *  the checkpoint, including a cancel of an order the checkpoint holds, and keeps journaling.
+ */
+TEST_F(CheckpointTests,TestCase_07)
+{
+    std::string journalPath = testing::TempDir() + "MerkleRex_CheckpointTest.journal";
+    std::remove(journalPath.c_str());
+    CurrencyId btc = SymbolTable::instance().currency("BTC");
+    std::string time;
+    std::size_t baseCount;
+    {
+        MerkelMain app{TESTCASE_03_FNAME};
+        app.setVerbose(false);
+        app.setJournal(journalPath);
+        app.setCheckpoint(path,false);
+        app.init(true);
+        time      = app.getCurrentTime();
+        baseCount = app.getOrders().getOrderCount(time);
+        OrderBookEntry first{"","ETH/BTC",OrderBookType::bid,0.01,1.0};
+        OrderId firstId = app.submitOrder(first);
+        ASSERT_THAT(firstId,testing::Ne(ORDER_ID_NONE));
+        app.saveCheckpoint();
+        OrderBookEntry second{"","ETH/BTC",OrderBookType::bid,0.01,2.0};
+        ASSERT_THAT(app.submitOrder(second),testing::Ne(ORDER_ID_NONE));
+        ASSERT_TRUE(app.cancelUserOrder(firstId));
+        app.commitJournal();
+    }
+
+    testing::internal::CaptureStdout();
+    MerkelMain app{TESTCASE_03_FNAME};
+    app.setVerbose(false);
+    app.setJournal(journalPath);
+    app.setCheckpoint(path,true);
+    app.init(true);
+    std::string out = testing::internal::GetCapturedStdout();
+    EXPECT_THAT(out,testing::HasSubstr("Restored checkpoint"));
+    EXPECT_THAT(out,testing::Not(testing::HasSubstr("Warning")));
+    EXPECT_THAT(app.getCurrentTime(),testing::Eq(time));
+    EXPECT_THAT(app.getOrders().getOrderCount(time),testing::Eq(baseCount + 1));
+    EXPECT_THAT(app.getWallet().getReserved(btc),testing::DoubleEq(0.02));
+
+    FILE * f = std::fopen(journalPath.c_str(),"rb");
+    ASSERT_THAT(f,testing::NotNull());
+    std::fseek(f,0,SEEK_END);
+    long before = std::ftell(f);
+    OrderBookEntry third{"","ETH/BTC",OrderBookType::bid,0.01,1.0};
+    ASSERT_THAT(app.submitOrder(third),testing::Ne(ORDER_ID_NONE));
+    app.commitJournal();
+    std::fseek(f,0,SEEK_END);
+    EXPECT_THAT(std::ftell(f),testing::Gt(before));
+    std::fclose(f);
+    std::remove(journalPath.c_str());
+}
@@ -0,0 +1,82 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file DataGenTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the synthetic data set generator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/DataGen/DataGenerator.h"
+#include "../src/OrderBookLib/OrderBook.h"
+#include <cstdio>
+#include <sstream>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define DATAGEN_TEST_FNAME "DataGenTest.csv"
+
+/**
+ *  Check that the output does not depend on the number of threads.
+ */
+TEST(DataGenTests,TestCase_01)
+{
+    DataGenOptions opt;
+    opt.frames = 1000;
+    opt.ordersPerFrame = 10;
+    opt.threads = 1;
+    std::ostringstream single;
+    EXPECT_THAT(DataGenerator{opt}.write(single),testing::Eq(10000));
+
+    opt.threads = 3;
+    std::ostringstream multi;
+    DataGenerator{opt}.write(multi);
+    EXPECT_THAT(multi.str(),testing::Eq(single.str()));
+
+    opt.seed = 2;
+    std::ostringstream other;
+    DataGenerator{opt}.write(other);
+    EXPECT_THAT(other.str(),testing::Ne(single.str()));
+}
+
+/**
+ *  Check that CsvReader loads every row and that timeframes and products come out as configured.
+ */
+TEST(DataGenTests,TestCase_02)
+{
+    DataGenOptions opt;
+    opt.products = 5;
+    opt.frames = 300;
+    opt.ordersPerFrame = 20;
+    opt.start = "2020/12/31 23:59:59";
+    DataGenerator{opt}.write(std::string(DATAGEN_TEST_FNAME));
+
+    OrderBook book{DATAGEN_TEST_FNAME};
+    std::remove(DATAGEN_TEST_FNAME);
+    EXPECT_THAT(book.getOrderCount(),testing::Eq(6000));
+    EXPECT_THAT(book.getKnownProducts().size(),testing::Eq(5));
+    EXPECT_THAT(book.getEarliestTime(),testing::Eq("2020/12/31 23:59:59.000000"));
+    EXPECT_THAT(book.getNextTime(book.getEarliestTime()),testing::Eq("2021/01/01 00:00:00.000000"));
+    EXPECT_THAT(book.getOrderCount("2021/01/01 00:00:00.000000"),testing::Eq(20));
+}
@@ -0,0 +1,149 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file GatewayTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the order-entry gateway.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Gateway/OrderGateway.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+#include <algorithm>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define GATEWAY_TEST_FNAME "DataSets/MatchTest_01.csv"
+#define GATEWAY_TEST_ENDPOINT "unix:/tmp/merklerex_gateway_test.sock"
+/********************************************//**
+ *  Local functions
+ ***********************************************/
+namespace
+{
+    void sendOrder(int fd, GatewaySide side, const char * product, double price, double amount, std::uint64_t tag)
+    {
+        GatewayNewOrder req;
+        std::memset(&req, 0, sizeof(req));
+        req.header.length = sizeof(req);
+        req.header.type   = GatewayMsgType::newOrder;
+        req.side          = side;
+        req.clientTag     = tag;
+        req.price         = price;
+        req.amount        = amount;
+        std::memcpy(req.product, product, std::min(std::strlen(product), (std::size_t)GW_PRODUCT_BYTES));
+        ASSERT_EQ(::send(fd, &req, sizeof(req), 0), (ssize_t)sizeof(req));
+    }
+
+    void sendCancel(int fd, OrderId id, std::uint64_t tag)
+    {
+        GatewayCancel req;
+        std::memset(&req, 0, sizeof(req));
+        req.header.length = sizeof(req);
+        req.header.type   = GatewayMsgType::cancel;
+        req.clientTag     = tag;
+        req.orderId       = id;
+        ASSERT_EQ(::send(fd, &req, sizeof(req), 0), (ssize_t)sizeof(req));
+    }
+
+    /** Reads one whole message the gateway has already sent. */
+    template<typename T>
+    T receive(int fd)
+    {
+        T msg;
+        std::memset(&msg, 0, sizeof(msg));
+        std::size_t got = 0;
+        while(got < sizeof(msg))
+        {
+            ssize_t n = ::recv(fd, reinterpret_cast<char *>(&msg) + got, sizeof(msg) - got, MSG_DONTWAIT);
+            if(n <= 0) break;
+            got += (std::size_t)n;
+        }
+        return msg;
+    }
+}
+
+/**
+ *  Orders and cancels are acked in request order, and fills go back to the connection that entered the order.
+ */
+TEST(GatewayTests,TestCase_01)
+{
+    MerkelMain sim{GATEWAY_TEST_FNAME};
+    sim.init(true);
+    sim.setVerbose(false);
+    OrderGateway gateway{sim};
+    gateway.listen(GATEWAY_TEST_ENDPOINT);
+    int client = OrderGateway::connect(GATEWAY_TEST_ENDPOINT);
+    int other  = OrderGateway::connect(GATEWAY_TEST_ENDPOINT);
+
+    sendOrder(client, GatewaySide::bid, "ETH/BTC", 0.03, 2, 11);
+    sendOrder(client, GatewaySide::bid, "ETH/BTC", 1000, 1, 12);
+    sendOrder(client, GatewaySide::bid, "DOGE", 1, 1, 13);
+    sendOrder(client, GatewaySide::bid, "ETH/BTC", 0.01, 1, 14);
+    std::size_t handled = 0;
+    for(int i = 0; (i < 10) && (handled < 4); i++) handled += gateway.poll(100);
+    EXPECT_THAT(handled,testing::Eq(4));
+    EXPECT_THAT(gateway.getConnectionCount(),testing::Eq(2));
+
+    GatewayAck a1 = receive<GatewayAck>(client);
+    GatewayAck a2 = receive<GatewayAck>(client);
+    GatewayAck a3 = receive<GatewayAck>(client);
+    GatewayAck a4 = receive<GatewayAck>(client);
+    EXPECT_THAT(a1.header.type,testing::Eq(GatewayMsgType::ack));
+    EXPECT_THAT(a1.status,testing::Eq(GatewayStatus::accepted));
+    EXPECT_THAT(a1.clientTag,testing::Eq(11));
+    EXPECT_THAT(a1.orderId,testing::Ne(ORDER_ID_NONE));
+    EXPECT_THAT(a2.status,testing::Eq(GatewayStatus::noFunds));
+    EXPECT_THAT(a3.status,testing::Eq(GatewayStatus::invalid));
+    EXPECT_THAT(a4.status,testing::Eq(GatewayStatus::accepted));
+
+    //Only the owning connection may cancel an order.
+    sendCancel(other, a4.orderId, 21);
+    sendCancel(client, a4.orderId, 22);
+    for(int i = 0; (i < 10) && (handled < 6); i++) handled += gateway.poll(100);
+    EXPECT_THAT(receive<GatewayAck>(other).status,testing::Eq(GatewayStatus::unknownOrder));
+    GatewayAck cancelled = receive<GatewayAck>(client);
+    EXPECT_THAT(cancelled.status,testing::Eq(GatewayStatus::cancelled));
+    EXPECT_THAT(cancelled.orderId,testing::Eq(a4.orderId));
+    EXPECT_THAT(sim.getWallet().getOpenHoldCount(),testing::Eq(1));
+
+    gateway.advance();
+    GatewayFill fill = receive<GatewayFill>(client);
+    EXPECT_THAT(fill.header.type,testing::Eq(GatewayMsgType::fill));
+    EXPECT_THAT(fill.orderId,testing::Eq(a1.orderId));
+    EXPECT_THAT(fill.side,testing::Eq(GatewaySide::bid));
+    EXPECT_THAT(fill.amount,testing::Gt(0.0));
+    EXPECT_THAT(gateway.getStats().fills,testing::Ge(1));
+    EXPECT_THAT(receive<GatewayHeader>(other).length,testing::Eq(0));
+
+    //A malformed message drops only the connection that sent it.
+    GatewayHeader bad{7, GatewayMsgType::ack, 0};
+    ASSERT_EQ(::send(other, &bad, sizeof(bad), 0), (ssize_t)sizeof(bad));
+    for(int i = 0; (i < 10) && (gateway.getConnectionCount() > 1); i++) gateway.poll(100);
+    EXPECT_THAT(gateway.getConnectionCount(),testing::Eq(1));
+    EXPECT_THAT(gateway.getStats().dropped,testing::Eq(1));
+    ::close(client);
+    ::close(other);
+}
@@ -0,0 +1,228 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file JournalTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the write-ahead Journal.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "../src/OrderBookLib/OrderBookLib.h"
+#include "../src/OrderBookLib/OrderBook.h"
+#include "../src/Wallet/Wallet.h"
+#include "../src/Journal/Journal.h"
+
+/********************************************//**
+ *  GTest Fixtures
+ ***********************************************/
+/**
+ * @brief Test fixture that writes a small journal: one user bid, its fill and a clock advance.
+ */
+class JournalTests : public testing::Test
+{
+    protected:
+
+    JournalTests()
+    {
+        path = testing::TempDir() + "MerkleRex_JournalTest.journal";
+        std::remove(path.c_str());
+
+        OrderBookEntry bid{time0,"ETH/BTC",OrderBookType::bid,0.02,1.0};
+        bid.username = "simuser";
+        OrderBookEntry sale{time0,"ETH/BTC",OrderBookType::bidsale,0.02,1.0};
+        sale.username = "simuser";
+
+        Journal journal;
+        journal.open(path,0);
+        journal.appendOrder(bid);
+        journal.appendFill(sale);
+        journal.appendTime(time1);
+        journal.commit();
+    }
+    ~JournalTests()
+    {
+        std::remove(path.c_str());
+    }
+    std::string path;
+    std::string time0 = "2020/03/17 17:01:24.884492";
+    std::string time1 = "2020/03/17 17:01:30.099017";
+};
+
+/**
+ *  Check that every record is replayed into orderbook, wallet and clock.
+ */
+TEST_F(JournalTests,TestCase_01)
+{
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+    wallet.insertCurrency("BTC",1.0);
+
+    JournalRecoveryStats stats = Journal::recover(path,book,wallet,currentTime);
+
+    EXPECT_THAT(stats.nOrders,testing::Eq(1));
+    EXPECT_THAT(stats.nFills,testing::Eq(1));
+    EXPECT_THAT(stats.tornTail,false);
+    EXPECT_THAT(currentTime,testing::Eq(time1));
+    EXPECT_THAT(book.getOrders(OrderBookType::bid,"ETH/BTC",time0).size(),testing::Eq(1));
+    EXPECT_THAT(wallet.containsCurrency("ETH",1.0),true);
+    EXPECT_THAT(wallet.containsCurrency("BTC",0.98),true);
+}
+
+/**
+ *  Check that a torn record at the end of the file is detected and skipped.
+ */
+TEST_F(JournalTests,TestCase_02)
+{
+    {
+        std::ofstream f{path,std::ios::binary | std::ios::app};
+        f.write("\x20\x00\x00\x00\x01\x02",6); //Header of a record that never made it to disk.
+    }
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+
+    JournalRecoveryStats stats = Journal::recover(path,book,wallet,currentTime);
+
+    EXPECT_THAT(stats.tornTail,true);
+    EXPECT_THAT(stats.nOrders,testing::Eq(1));
+    EXPECT_THAT(currentTime,testing::Eq(time1));
+}
+
+/**
+ *  Check that a missing journal is treated as empty.
+ */
+TEST_F(JournalTests,TestCase_03)
+{
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+
+    JournalRecoveryStats stats = Journal::recover(path + ".missing",book,wallet,currentTime);
+
+    EXPECT_THAT(stats.validBytes,testing::Eq(0));
+    EXPECT_THAT(currentTime,testing::Eq(time0));
+}
+
+/**
+ *  Check that holds are re-created on recovery and that cancelled orders are dropped and released.
+ */
+TEST_F(JournalTests,TestCase_04)
+{
+    OrderBookEntry ask{time1,"ETH/BTC",OrderBookType::ask,0.03,0.5};
+    ask.username = "simuser";
+    ask.orderId  = 2;
+    OrderBookEntry bid{time1,"ETH/BTC",OrderBookType::bid,0.02,10.0};
+    bid.username = "simuser";
+    bid.orderId  = 3;
+    {
+        Journal journal;
+        journal.open(path,SIZE_MAX);
+        journal.appendOrder(ask);
+        journal.appendOrder(bid);
+        journal.appendCancel(time1,2);
+        journal.commit();
+    }
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+    wallet.insertCurrency("BTC",1.0);
+
+    JournalRecoveryStats stats = Journal::recover(path,book,wallet,currentTime);
+
+    EXPECT_THAT(stats.nOrders,testing::Eq(3));
+    EXPECT_THAT(stats.nCancels,testing::Eq(1));
+    EXPECT_THAT(book.getOrders(OrderBookType::ask,"ETH/BTC",time1).size(),testing::Eq(0));
+    EXPECT_THAT(wallet.getOpenHoldCount(),testing::Eq(1));
+    EXPECT_THAT(wallet.getReserved(SymbolTable::instance().currency("BTC")),testing::DoubleEq(0.2));
+    EXPECT_THAT(wallet.getReserved(SymbolTable::instance().currency("ETH")),testing::DoubleEq(0.0));
+}
+
+/**
+ *  Check that an agent order recovers with its ledger account and without a wallet hold.
+ */
+TEST_F(JournalTests,TestCase_05)
+{
+    OrderBookEntry ask{time1,"ETH/BTC",OrderBookType::ask,0.03,0.5};
+    ask.username = "agent";
+    ask.account  = 7;
+    {
+        Journal journal;
+        journal.open(path,SIZE_MAX);
+        journal.appendOrder(ask);
+        journal.commit();
+    }
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+    wallet.insertCurrency("BTC",1.0);
+
+    JournalRecoveryStats stats = Journal::recover(path,book,wallet,currentTime);
+
+    EXPECT_THAT(stats.nOrders,testing::Eq(2));
+    std::vector<OrderBookEntry> asks = book.getOrders(OrderBookType::ask,"ETH/BTC",time1);
+    ASSERT_THAT(asks.size(),testing::Eq(1));
+    EXPECT_THAT(asks[0].username,testing::Eq("agent"));
+    EXPECT_THAT(asks[0].account,testing::Eq(7));
+    EXPECT_THAT(asks[0].orderId,testing::Eq(ORDER_ID_NONE));
+    EXPECT_THAT(wallet.getOpenHoldCount(),testing::Eq(0));
+    std::vector<OrderBookEntry> bids = book.getOrders(OrderBookType::bid,"ETH/BTC",time0);
+    ASSERT_THAT(bids.size(),testing::Eq(1));
+    EXPECT_THAT(bids[0].account,testing::Eq(ACCOUNT_NONE));
+}
+
+/**
+ *  Check that an intact record of an unknown type is skipped without truncating what follows.
+ */
+TEST_F(JournalTests,TestCase_06)
+{
+    {
+        unsigned char record[] = {3,0,0,0, 0,0,0,0, 0x7f, 'a','b','c'};
+        std::uint32_t crc = Journal::crc32(record + 8, 4);
+        std::memcpy(record + 4, &crc, sizeof(crc));
+        std::ofstream f{path,std::ios::binary | std::ios::app};
+        f.write(reinterpret_cast<const char *>(record),sizeof(record));
+    }
+    std::string time2 = "2020/03/17 17:01:35.000000";
+    {
+        Journal journal;
+        journal.open(path,SIZE_MAX);
+        journal.appendTime(time2);
+        journal.commit();
+    }
+    OrderBook book;
+    Wallet wallet;
+    std::string currentTime = time0;
+
+    JournalRecoveryStats stats = Journal::recover(path,book,wallet,currentTime);
+
+    std::ifstream f{path,std::ios::binary | std::ios::ate};
+    EXPECT_THAT(stats.nSkipped,testing::Eq(1));
+    EXPECT_THAT(stats.nTimes,testing::Eq(2));
+    EXPECT_THAT(stats.tornTail,false);
+    EXPECT_THAT(stats.validBytes,testing::Eq((std::size_t)f.tellg()));
+    EXPECT_THAT(currentTime,testing::Eq(time2));
+}
@@ -0,0 +1,66 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LatencyTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the latency histograms.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Metrics/LatencyHistogram.h"
+#include <thread>
+
+/**
+ *  Check percentiles stay within the bucket precision over a wide value range.
+ */
+TEST(LatencyTests,TestCase_01)
+{
+    LatencyHistogram h;
+    for(std::uint64_t v = 1; v <= 100000; v++) h.record(v);
+
+    EXPECT_THAT(h.count(),testing::Eq(100000));
+    EXPECT_THAT(h.max(),testing::Eq(100000));
+    EXPECT_THAT((double)h.percentile(50.0),testing::DoubleNear(50000.0,50000.0 * 0.04));
+    EXPECT_THAT((double)h.percentile(99.0),testing::DoubleNear(99000.0,99000.0 * 0.04));
+    EXPECT_THAT(h.percentile(100.0),testing::Eq(100000));
+    EXPECT_THAT(LatencyHistogram::bucketOf(UINT64_MAX),testing::Eq(LATENCY_BUCKETS - 1));
+    EXPECT_THAT(LatencyHistogram::bucketUpper(LATENCY_BUCKETS - 1),testing::Eq(UINT64_MAX));
+}
+
+/**
+ *  Check that samples recorded on other threads are merged, including after those threads exit.
+ */
+TEST(LatencyTests,TestCase_02)
+{
+    LatencyRegistry & reg = LatencyRegistry::instance();
+    reg.reset();
+    std::thread a([](){ for(int i = 0; i < 1000; i++) LatencyRegistry::record(LatencyOp::tick, 10); });
+    std::thread b([](){ for(int i = 0; i < 500; i++)  LatencyRegistry::record(LatencyOp::tick, 5000); });
+    a.join();
+    b.join();
+
+    LatencyHistogram h = reg.merged(LatencyOp::tick);
+    EXPECT_THAT(h.count(),testing::Eq(1500));
+    EXPECT_THAT(h.percentile(50.0),testing::Eq(10));
+    EXPECT_THAT(h.max(),testing::Eq(5000));
+}
@@ -0,0 +1,250 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LedgerTest.cpp
+ * @author Edward Martinez
+ * @brief Unit tests for the multi-account ledger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/OrderBookLib/OrderBook.h"
+#include "../src/Ledger/Ledger.h"
+#include "../src/Ledger/SettlementBatch.h"
+#include "../src/Ledger/ConcurrentLedger.h"
+/** @cond STDINCLUDES */
+#include <random>
+#include <thread>
+/** @endcond */
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LEDGER_TEST_TIME "2020/03/17 17:01:24.884492"
+#define LEDGER_STRESS_THREADS 4
+#define LEDGER_STRESS_OPS 500000 /**< Transfers and fills per thread. */
+#define LEDGER_STRESS_ACCOUNTS 64
+
+/**
+ *  Fills from the matcher carry both accounts and settle buyer and seller.
+ */
+TEST(LedgerTests,TestCase_01)
+{
+    OrderBook book;
+    std::vector<OrderBookEntry> batch{
+        {LEDGER_TEST_TIME,"ETH/BTC",OrderBookType::ask,0.020,3.0},
+        {LEDGER_TEST_TIME,"ETH/BTC",OrderBookType::bid,0.030,2.0},
+        {LEDGER_TEST_TIME,"ETH/BTC",OrderBookType::bid,0.025,2.0}};
+    batch[0].account = 7;
+    batch[1].account = 2;
+    batch[2].account = ACCOUNT_NONE;
+    book.insertOrders(batch);
+
+    std::vector<OrderBookEntry> sales = book.matchAsksToBids("ETH/BTC",LEDGER_TEST_TIME);
+    ASSERT_THAT(sales.size(),testing::Eq(2));
+    EXPECT_THAT(sales[0].buyer,testing::Eq(2u));
+    EXPECT_THAT(sales[0].seller,testing::Eq(7u));
+    EXPECT_THAT(sales[1].buyer,testing::Eq(ACCOUNT_NONE));
+
+    Ledger ledger;
+    ledger.openAccounts(8);
+    EXPECT_THAT(ledger.settleAll(sales),testing::Eq(2));
+    SymbolTable & symbols = SymbolTable::instance();
+    CurrencyId eth = symbols.currency("ETH");
+    CurrencyId btc = symbols.currency("BTC");
+    EXPECT_THAT(ledger.getAccountCount(),testing::Eq(8));
+    EXPECT_THAT(ledger.getBalance(2,eth),testing::DoubleEq(2.0));
+    EXPECT_THAT(ledger.getBalance(2,btc),testing::DoubleEq(-0.04));
+    EXPECT_THAT(ledger.getBalance(7,eth),testing::DoubleEq(-3.0));
+    EXPECT_THAT(ledger.getBalance(7,btc),testing::DoubleEq(0.06));
+    EXPECT_THAT(ledger.getBalance(3,eth),testing::DoubleEq(0.0));
+}
+
+/**
+ *  New currencies widen every row without losing balances; deposits and withdrawals are checked.
+ */
+TEST(LedgerTests,TestCase_02)
+{
+    Ledger ledger;
+    AccountId first = ledger.openAccounts(3);
+    EXPECT_THAT(first,testing::Eq(0u));
+
+    SymbolTable & symbols = SymbolTable::instance();
+    CurrencyId btc = symbols.currency("BTC");
+    ledger.deposit(1,btc,5.0);
+    for(std::size_t i = 0; i < 2 * LEDGER_MIN_CURRENCIES; i++) symbols.currency("LDG" + std::to_string(i));
+    CurrencyId last = symbols.currency("LDG" + std::to_string(2 * LEDGER_MIN_CURRENCIES - 1));
+    ledger.deposit(2,last,1.5);
+
+    EXPECT_THAT(ledger.getCurrencyCount(),testing::Ge((std::size_t)last + 1));
+    EXPECT_THAT(ledger.getBalance(1,btc),testing::DoubleEq(5.0));
+    EXPECT_THAT(ledger.getBalance(2,last),testing::DoubleEq(1.5));
+    EXPECT_THAT(ledger.withdraw(1,btc,6.0),false);
+    EXPECT_THAT(ledger.withdraw(1,btc,2.0),true);
+    EXPECT_THAT(ledger.getTotal(btc),testing::DoubleEq(3.0));
+    EXPECT_THROW(ledger.deposit(0,btc,-1.0),std::runtime_error);
+
+    OrderBookEntry bid{LEDGER_TEST_TIME,"ETH/BTC",OrderBookType::bid,0.5,6.0};
+    bid.account = 1;
+    EXPECT_THAT(ledger.canFulfillOrder(bid),true);
+    bid.account = 0;
+    EXPECT_THAT(ledger.canFulfillOrder(bid),false);
+}
+
+/**
+ *  Netted settlement of a batch gives the same balances as settling every fill, with one update per position.
+ */
+TEST(LedgerTests,TestCase_03)
+{
+    SymbolTable & symbols = SymbolTable::instance();
+    ProductPair ethBtc  = symbols.product("ETH/BTC");
+    ProductPair dogeBtc = symbols.product("DOGE/BTC");
+
+    Ledger direct, netted;
+    direct.openAccounts(6);
+    netted.openAccounts(6);
+    SettlementBatch batch;
+    for(std::size_t i = 0; i < 1000; i++)
+    {
+        ProductPair pair = (i % 3) ? ethBtc : dogeBtc;
+        AccountId buyer  = (AccountId)(i % 4);
+        AccountId seller = (i % 5) ? (AccountId)(4 + i % 2) : ACCOUNT_NONE;
+        double price = 0.01 + 0.001 * (double)(i % 7);
+        direct.settle(pair, buyer, seller, price, 1.0);
+        batch.add(pair, buyer, seller, price, 1.0);
+    }
+    EXPECT_THAT(batch.getFillCount(),testing::Eq(1000));
+    EXPECT_THAT(batch.getPositionCount(),testing::Eq(4 * 3 + 2 * 3));
+    EXPECT_THAT(batch.apply(netted),testing::Eq(18));
+    EXPECT_THAT(batch.getPositionCount(),testing::Eq(0));
+
+    for(AccountId a = 0; a < 6; a++)
+    {
+        for(CurrencyId c : {ethBtc.base, ethBtc.quote, dogeBtc.base})
+        {
+            EXPECT_THAT(netted.getBalance(a,c),testing::DoubleNear(direct.getBalance(a,c),1e-9));
+        }
+    }
+}
+
+/**
+ *  Large batches applied over several threads match a single-threaded apply.
+ */
+TEST(LedgerTests,TestCase_04)
+{
+    ProductPair pair = SymbolTable::instance().product("ETH/BTC");
+    Ledger serial, parallel;
+    serial.openAccounts(2 * SETTLEMENT_PARALLEL_MIN + 1);
+    parallel.openAccounts(2 * SETTLEMENT_PARALLEL_MIN + 1);
+    SettlementBatch a, b;
+    for(AccountId i = 0; i < 2 * SETTLEMENT_PARALLEL_MIN; i++)
+    {
+        a.add(pair, i, i + 1, 0.5, 2.0);
+        b.add(pair, i, i + 1, 0.5, 2.0);
+    }
+    a.apply(serial, 1);
+    b.apply(parallel, 4);
+    ASSERT_THAT(parallel.getAccountCount(),testing::Eq(serial.getAccountCount()));
+    for(AccountId i = 0; i < serial.getAccountCount(); i += 997)
+    {
+        EXPECT_THAT(parallel.getBalance(i,pair.base),testing::DoubleEq(serial.getBalance(i,pair.base)));
+        EXPECT_THAT(parallel.getBalance(i,pair.quote),testing::DoubleEq(serial.getBalance(i,pair.quote)));
+    }
+    EXPECT_THAT(parallel.getTotal(pair.base),testing::DoubleEq(0.0));
+}
+
+/**
+ *  Millions of concurrent transfers and fills leave the total of every currency unchanged.
+ *  Amounts are whole numbers so the sums are exact in double.
+ */
+TEST(LedgerTests,TestCase_05)
+{
+    ProductPair pair = SymbolTable::instance().product("ETH/BTC");
+    std::size_t currencies = (std::size_t)std::max(pair.base, pair.quote) + 1;
+    ConcurrentLedger ledger(LEDGER_STRESS_ACCOUNTS, currencies);
+    for(AccountId a = 0; a < LEDGER_STRESS_ACCOUNTS; a++)
+    {
+        ledger.deposit(a,pair.base,1000.0);
+        ledger.deposit(a,pair.quote,1000.0);
+    }
+
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> moved{0};
+    for(unsigned t = 0; t < LEDGER_STRESS_THREADS; t++)
+    {
+        workers.emplace_back([&ledger, &moved, pair, t]()
+        {
+            std::mt19937 rng(t + 1);
+            std::size_t ok = 0;
+            for(std::size_t i = 0; i < LEDGER_STRESS_OPS; i++)
+            {
+                AccountId from = (AccountId)(rng() % LEDGER_STRESS_ACCOUNTS);
+                AccountId to   = (AccountId)(rng() % LEDGER_STRESS_ACCOUNTS);
+                double amount  = (double)(1 + rng() % 5);
+                if(i % 4)
+                {
+                    ok += ledger.transfer(from, to, (i % 2) ? pair.base : pair.quote, amount) ? 1 : 0;
+                }
+                else
+                {
+                    ledger.settle(pair, to, from, 2.0, amount);
+                    ok++;
+                }
+            }
+            moved += ok;
+        });
+    }
+    for(std::thread & w : workers) w.join();
+
+    EXPECT_THAT(moved.load(),testing::Gt((std::size_t)LEDGER_STRESS_THREADS * LEDGER_STRESS_OPS / 2));
+    EXPECT_THAT(ledger.getTotal(pair.base),testing::Eq(1000.0 * LEDGER_STRESS_ACCOUNTS));
+    EXPECT_THAT(ledger.getTotal(pair.quote),testing::Eq(1000.0 * LEDGER_STRESS_ACCOUNTS));
+    EXPECT_THROW(ledger.deposit(LEDGER_STRESS_ACCOUNTS,pair.base,1.0),std::runtime_error);
+}
+
+/**
+ *  Account ids outside AccountId or the opened accounts are refused, by the csv parser and by the
+ *  ledger, without growing the balance table.
+ */
+TEST(LedgerTests,TestCase_06)
+{
+    std::vector<std::string> row{LEDGER_TEST_TIME,"ETH/BTC","bid","0.02","1.0","42"};
+    EXPECT_THAT(OrderBookEntry::stringsToOBE(row).account,testing::Eq(42u));
+    for(const char * bad : {"4294967295","99999999999","-1","12x"})
+    {
+        row[5] = bad;
+        EXPECT_THROW(OrderBookEntry::stringsToOBE(row),std::exception);
+    }
+
+    ProductPair pair = SymbolTable::instance().product("ETH/BTC");
+    Ledger ledger;
+    ledger.openAccounts(2);
+    EXPECT_THROW(ledger.deposit(2,pair.base,1.0),std::runtime_error);
+    EXPECT_THROW(ledger.withdraw(2,pair.base,0.0),std::runtime_error);
+    EXPECT_THROW(ledger.settle(pair,1,ACCOUNT_ID_MAX,0.5,1.0),std::runtime_error);
+    SettlementBatch batch;
+    batch.add(pair,0,5,0.5,1.0);
+    EXPECT_THROW(batch.apply(ledger),std::runtime_error);
+    EXPECT_THAT(ledger.getAccountCount(),testing::Eq(2));
+    EXPECT_THAT(ledger.getMemoryBytes(),testing::Lt(1024));
+    EXPECT_THAT(ledger.getBalance(0,pair.base),testing::DoubleEq(0.0));
+    EXPECT_THAT(ledger.getBalance(1,pair.base),testing::DoubleEq(0.0));
+}
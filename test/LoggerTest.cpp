@@ -0,0 +1,160 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file LoggerTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the asynchronous logger.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Log/Logger.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <thread>
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define LOGGER_TEST_THREADS 4
+#define LOGGER_TEST_RECORDS (3 * LOG_RING_RECORDS) /**< Per thread; more than a ring holds, so writers must wait. */
+
+/**
+ *  Arguments are captured by value and substituted in order; strings are copied and truncated.
+ */
+TEST(LoggerTests,TestCase_01)
+{
+    std::ostringstream os;
+    Logger & logger = Logger::instance();
+    logger.setSink(&os);
+    {
+        std::string product = "ETH/BTC";
+        MRX_LOG_INFO("Matching {} at {} x {} ({}, {})", product, 0.25, 4u, -3, true);
+        product = "changed";
+    }
+    MRX_LOG_WARN("Too many: {} {} {} {} {} {} {}", 1, 2, 3, 4, 5, 6, 7);
+    MRX_LOG_ERROR("Long: {}", std::string(200, 'x'));
+    MRX_LOG_DEBUG("Compiled out at the default level: {}", 1);
+    logger.flush();
+    logger.setSink(nullptr);
+
+    std::string expected = "Matching ETH/BTC at 0.25 x 4 (-3, true)\n"
+                           "Too many: 1 2 3 4 5 6 {}\n"
+                           "Long: " + std::string(LOG_TEXT_BYTES - 1, 'x') + "\n";
+    if(MRX_LOG_LEVEL <= LOG_LEVEL_DEBUG) expected += "Compiled out at the default level: 1\n";
+    EXPECT_THAT(os.str(),testing::Eq(expected));
+}
+
+/**
+ *  Records from several threads all arrive, each thread's in order, even when the rings fill up.
+ */
+TEST(LoggerTests,TestCase_02)
+{
+    std::ostringstream os;
+    Logger & logger = Logger::instance();
+    logger.setSink(&os);
+    std::uint64_t before = logger.getRecordCount();
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < LOGGER_TEST_THREADS; t++)
+    {
+        threads.emplace_back([t]()
+        {
+            for(int i = 0; i < LOGGER_TEST_RECORDS; i++) MRX_LOG_INFO("{} {}", t, i);
+        });
+    }
+    for(std::thread & th : threads) th.join();
+    logger.flush();
+    logger.setSink(nullptr);
+
+    EXPECT_THAT(logger.getRecordCount() - before,testing::Eq((std::uint64_t)LOGGER_TEST_THREADS * LOGGER_TEST_RECORDS));
+    std::istringstream in{os.str()};
+    std::vector<int> next(LOGGER_TEST_THREADS, 0);
+    int t, i;
+    std::size_t lines = 0;
+    while(in >> t >> i)
+    {
+        ASSERT_THAT(t,testing::Lt(LOGGER_TEST_THREADS));
+        EXPECT_THAT(i,testing::Eq(next[t]));
+        next[t] = i + 1;
+        lines++;
+    }
+    EXPECT_THAT(lines,testing::Eq((std::size_t)LOGGER_TEST_THREADS * LOGGER_TEST_RECORDS));
+}
+
+/**
+ *  Doubles are written exactly as printf "%g" writes them, including values that round up to
+ *  the next power of ten and values outside the plain notation range.
+ */
+TEST(LoggerTests,TestCase_03)
+{
+    std::vector<double> values{0.0, -0.0, 0.25, -3.5, 1e-4, 9.99995e-5, 0.0001234565, 9.999985, 99999.95,
+                               999999.4, 999999.5, 1e6, 123456789.0, 1e-300, NAN, INFINITY};
+    std::mt19937_64 rng{7};
+    std::uniform_real_distribution<double> exponent{-6.0, 7.0};
+    for(int i = 0; i < 100000; i++) values.push_back(((i % 2) ? -1.0 : 1.0) * std::pow(10.0, exponent(rng)));
+    for(int i = 0; i < 100000; i++) values.push_back((double)(rng() % 100000000) / std::pow(10.0, (double)(rng() % 10)));
+
+    LogRecord r{};
+    r.format   = "{}";
+    r.nArgs    = 1;
+    r.kinds[0] = LogArgKind::f64;
+    for(double v : values)
+    {
+        char expected[32];
+        std::snprintf(expected, sizeof(expected), "%g", v);
+        r.args[0].f = v;
+        ASSERT_THAT(Logger::format(r),testing::Eq(std::string(expected))) << "value " << v;
+    }
+}
+
+/**
+ *  A thread logs into one ring whatever the argument types, and threads that exited leave their
+ *  rings to later threads.
+ */
+TEST(LoggerTests,TestCase_04)
+{
+    std::ostringstream os;
+    Logger & logger = Logger::instance();
+    logger.setSink(&os);
+    std::size_t before = logger.getRingCount();
+    for(int t = 0; t < 2 * LOGGER_TEST_THREADS; t++)
+    {
+        std::thread([t]()
+        {
+            MRX_LOG_INFO("{}", t);
+            MRX_LOG_INFO("{} {}", t, 0.5);
+            MRX_LOG_INFO("{} {} {}", t, "text", std::string("more"));
+        }).join();
+    }
+    logger.flush();
+    logger.setSink(nullptr);
+
+    EXPECT_THAT(logger.getRingCount(),testing::Le(before + 1));
+    std::string expected;
+    for(int t = 0; t < 2 * LOGGER_TEST_THREADS; t++)
+    {
+        expected += std::to_string(t) + "\n" + std::to_string(t) + " 0.5\n" + std::to_string(t) + " text more\n";
+    }
+    EXPECT_THAT(os.str(),testing::Eq(expected));
+}
@@ -0,0 +1,122 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MarketDataTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the shared-memory market data feed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/MarketData/MarketDataFeed.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+#include <thread>
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define FEED_TEST_FNAME "DataSets/MatchTest_01.csv"
+#define FEED_TEST_NAME  "merklerex_feed_test"
+#define FEED_TEST_MESSAGES 2000000
+
+/**
+ *  A timeframe is published as a clock message, then per product its levels, top of book and trades.
+ */
+TEST(MarketDataTests,TestCase_01)
+{
+    MarketDataPublisher feed;
+    feed.open(FEED_TEST_NAME);
+    MarketDataReader reader;
+    reader.open(FEED_TEST_NAME);
+    MerkelMain sim{FEED_TEST_FNAME};
+    sim.init(true);
+    sim.setVerbose(false);
+    sim.setMarketData(&feed);
+    TickStats tick = sim.processNext();
+
+    FeedMessage m;
+    std::size_t counts[5] = {0, 0, 0, 0, 0};
+    std::uint64_t sequence = 0;
+    double bestBid = 0.0;
+    double bestAsk = 0.0;
+    while(reader.next(m))
+    {
+        EXPECT_THAT(m.sequence,testing::Eq(sequence++));
+        counts[(std::size_t)m.type]++;
+        if(FeedMsgType::clock == m.type) continue;
+        EXPECT_THAT(reader.getProductName(m.product),testing::Eq("ETH/BTC"));
+        if((FeedMsgType::level == m.type) && (FeedSide::bid == m.side)) bestBid = std::max(bestBid, m.price);
+        if(FeedMsgType::level == m.type && (FeedSide::ask == m.side) && ((0.0 == bestAsk) || (m.price < bestAsk))) bestAsk = m.price;
+        if(FeedMsgType::topOfBook == m.type)
+        {
+            EXPECT_THAT(m.price,testing::DoubleEq(bestBid));
+            EXPECT_THAT(m.askPrice,testing::DoubleEq(bestAsk));
+        }
+    }
+    EXPECT_THAT(counts[(std::size_t)FeedMsgType::clock],testing::Eq(1));
+    EXPECT_THAT(counts[(std::size_t)FeedMsgType::topOfBook],testing::Eq(1));
+    EXPECT_THAT(counts[(std::size_t)FeedMsgType::level],testing::Gt(0));
+    EXPECT_THAT(counts[(std::size_t)FeedMsgType::trade],testing::Eq(tick.sales));
+    EXPECT_THAT(reader.getLost(),testing::Eq(0));
+    EXPECT_THAT(reader.getReceived(),testing::Eq(feed.getPublished()));
+}
+
+/**
+ *  A reader racing the writer gets every message intact or counts it as lost, never a torn one.
+ */
+TEST(MarketDataTests,TestCase_02)
+{
+    MarketDataPublisher feed;
+    feed.open(FEED_TEST_NAME, 1024);
+    MarketDataReader reader;
+    reader.open(FEED_TEST_NAME);
+
+    std::thread writer([&feed]()
+    {
+        for(std::int64_t i = 0; i < FEED_TEST_MESSAGES; i++)
+        {
+            FeedMessage m{};
+            m.type       = FeedMsgType::trade;
+            m.timeMicros = i;
+            m.price      = (double)i;
+            m.amount     = (double)(2 * i);
+            m.askPrice   = (double)(3 * i);
+            feed.publish(m);
+        }
+    });
+    FeedMessage m;
+    bool intact = true;
+    bool ordered = true;
+    std::uint64_t last = 0;
+    while(reader.getReceived() + reader.getLost() < FEED_TEST_MESSAGES)
+    {
+        if(!reader.next(m)) continue;
+        intact  = intact && ((std::int64_t)m.sequence == m.timeMicros) && (m.price == (double)m.timeMicros)
+                  && (m.amount == (double)(2 * m.timeMicros)) && (m.askPrice == (double)(3 * m.timeMicros));
+        ordered = ordered && ((reader.getReceived() == 1) || (m.sequence > last));
+        last = m.sequence;
+    }
+    writer.join();
+    EXPECT_TRUE(intact);
+    EXPECT_TRUE(ordered);
+    EXPECT_THAT(reader.getReceived() + reader.getLost(),testing::Eq(FEED_TEST_MESSAGES));
+    EXPECT_THAT(reader.getPosition(),testing::Eq(FEED_TEST_MESSAGES));
+}
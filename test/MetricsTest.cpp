@@ -0,0 +1,88 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file MetricsTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the metrics registry and exporter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Metrics/MetricsRegistry.h"
+#include "../src/Metrics/MetricsExporter.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define METRICS_TEST_FNAME "DataSets/MatchTest_03.csv"
+#define METRICS_TEST_OUT   "MetricsTest.prom"
+
+/**
+ *  Check Prometheus text rendering, label escaping and that re-registering returns the same series.
+ */
+TEST(MetricsTests,TestCase_01)
+{
+    MetricsRegistry & reg = MetricsRegistry::instance();
+    MetricsCounter & c = reg.counter("mrx_test_events_total","Test events.");
+    c.inc(3);
+    reg.counter("mrx_test_events_total","Test events.").inc();
+    reg.gauge("mrx_test_level","Test level.",MetricsRegistry::label("product","A\"B")).set(1.5);
+
+    std::ostringstream os;
+    reg.render(os);
+    std::string text = os.str();
+    EXPECT_THAT(text,testing::HasSubstr("# TYPE mrx_test_events_total counter\nmrx_test_events_total 4\n"));
+    EXPECT_THAT(text,testing::HasSubstr("mrx_test_level{product=\"A\\\"B\"} 1.5\n"));
+    EXPECT_THROW(reg.gauge("mrx_test_events_total","Test events."),std::runtime_error);
+}
+
+/**
+ *  Check that a replayed timeframe updates the engine metrics and that the exporter writes them to a file.
+ */
+TEST(MetricsTests,TestCase_02)
+{
+    MetricsCounter & fills = MetricsRegistry::instance().counter("mrx_fills_total","");
+    std::uint64_t before = fills.get();
+
+    MerkelMain sim{METRICS_TEST_FNAME};
+    sim.setVerbose(false);
+    sim.init(true);
+    TickStats tick = sim.processNext();
+    EXPECT_THAT(fills.get() - before,testing::Eq(tick.sales));
+
+    std::remove(METRICS_TEST_OUT);
+    {
+        MetricsExporter exporter;
+        exporter.start(METRICS_TEST_OUT,60000);
+        exporter.stop();
+    }
+    std::ifstream in{METRICS_TEST_OUT};
+    std::stringstream content;
+    content << in.rdbuf();
+    EXPECT_THAT(content.str(),testing::HasSubstr("mrx_resting_orders{product=\"ETH/BTC\"}"));
+    EXPECT_THAT(content.str(),testing::HasSubstr("# TYPE mrx_ticks_total counter"));
+    std::remove(METRICS_TEST_OUT);
+}
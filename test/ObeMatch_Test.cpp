@@ -120,3 +120,84 @@ TEST_F(MatchingTest,TestCase_05)
     EXPECT_THAT(TC04_sales[0]._price,testing::Eq(0.021873)); //Verify that first sale made (highest bid) is the expected amount
 }
 
+
+/**
+ *  Check that the book at a time between timeframes is the one of the preceding timeframe.
+ */
+TEST(OrderBookTests,TestCase_01)
+{
+    OrderBook book;
+    std::vector<OrderBookEntry> batch{
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::ask,0.030,1.0},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::ask,0.020,1.0},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.010,1.0},
+        {"2020/03/17 17:01:24.884492","DOGE/BTC",OrderBookType::bid,0.001,1.0},
+        {"2020/03/17 17:01:30.000000","ETH/BTC",OrderBookType::bid,0.015,1.0}};
+    book.insertOrders(batch);
+
+    OrderBookDepth depth;
+    ASSERT_THAT(book.getBookAt("ETH/BTC","2020/03/17 17:01:29.000000",depth),true);
+    EXPECT_THAT(depth.timestamp,testing::Eq("2020/03/17 17:01:24.884492"));
+    ASSERT_THAT(depth.asks.size(),testing::Eq(2));
+    EXPECT_THAT(depth.asks[0]._price,testing::Eq(0.020));
+    EXPECT_THAT(depth.bids.size(),testing::Eq(1));
+
+    ASSERT_THAT(book.getBookAt("ETH/BTC","2020/03/18 00:00:00.000000",depth),true);
+    EXPECT_THAT(depth.timestamp,testing::Eq("2020/03/17 17:01:30.000000"));
+    EXPECT_THAT(depth.asks.size(),testing::Eq(0));
+    EXPECT_THAT(book.getBookAt("ETH/BTC","2020/03/17 17:00:00.000000",depth),false);
+}
+
+/**
+ *  Pro-rata shares one ask among crossing bids by size; midpoint fills price between ask and bid.
+ */
+TEST(MatchPolicyTests,TestCase_01)
+{
+    typedef MatchPolicy<FloatPrice, ProRataRule, MidpointFill, TrackOwners> ProRataMid;
+    OrderBook book;
+    std::vector<OrderBookEntry> batch{
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::ask,0.020,4.0},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.030,6.0},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.022,2.0},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.010,8.0}};
+    batch[2].username = "simuser";
+    book.insertOrders(batch);
+
+    std::vector<OrderBookEntry> sales = book.matchAsksToBidsWith<ProRataMid>("ETH/BTC","2020/03/17 17:01:24.884492");
+    ASSERT_THAT(sales.size(),testing::Eq(2));
+    EXPECT_THAT(sales[0]._amount,testing::DoubleEq(3.0));
+    EXPECT_THAT(sales[0]._price,testing::DoubleEq(0.025));
+    EXPECT_THAT(sales[1]._amount,testing::DoubleEq(1.0));
+    EXPECT_THAT(sales[1]._price,testing::DoubleEq(0.021));
+    EXPECT_THAT(sales[1]._OrderType,testing::Eq(OrderBookType::bidsale));
+
+    //Default policy: the highest bid takes the whole ask at the ask price.
+    sales = book.matchAsksToBids("ETH/BTC","2020/03/17 17:01:24.884492");
+    ASSERT_THAT(sales.size(),testing::Eq(1));
+    EXPECT_THAT(sales[0]._amount,testing::DoubleEq(4.0));
+    EXPECT_THAT(sales[0]._price,testing::DoubleEq(0.020));
+}
+
+/**
+ *  Fixed point pro-rata hands rounding leftovers to the highest bid and ignores owners when asked to.
+ */
+TEST(MatchPolicyTests,TestCase_02)
+{
+    typedef MatchPolicy<FixedPrice<100000000>, ProRataRule, AskPriceFill, IgnoreOwners> SatoshiProRata;
+    OrderBook book;
+    std::vector<OrderBookEntry> batch{
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::ask,0.020,0.00000010},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.030,0.00000010},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.030,0.00000010},
+        {"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.030,0.00000010}};
+    batch[1].username = "simuser";
+    book.insertOrders(batch);
+
+    std::vector<OrderBookEntry> sales = book.matchAsksToBidsWith<SatoshiProRata>("ETH/BTC","2020/03/17 17:01:24.884492");
+    ASSERT_THAT(sales.size(),testing::Eq(3));
+    EXPECT_THAT(sales[0]._amount,testing::DoubleEq(0.00000004));
+    EXPECT_THAT(sales[1]._amount,testing::DoubleEq(0.00000003));
+    EXPECT_THAT(sales[2]._amount,testing::DoubleEq(0.00000003));
+    EXPECT_THAT(sales[0]._OrderType,testing::Eq(OrderBookType::ask));
+    EXPECT_THAT(sales[0]._price,testing::DoubleEq(0.020));
+}
@@ -0,0 +1,62 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file PerfGateTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the performance regression gate.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/PerfGate/PerfGate.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define PERFGATE_TEST_FNAME "PerfGateTest.json"
+
+/**
+ *  Check that results survive a JSON round trip and that only moves in the bad direction beyond tolerance regress.
+ */
+TEST(PerfGateTests,TestCase_01)
+{
+    std::vector<PerfMetric> baseline{{"orders_per_s", 1000.0, true, 0.2}, {"match_ns", 50.0, false, 0.2}};
+    {
+        std::ofstream out{PERFGATE_TEST_FNAME};
+        PerfGate::writeJson(out, baseline);
+    }
+    std::vector<PerfMetric> read = PerfGate::readJson(PERFGATE_TEST_FNAME);
+    std::remove(PERFGATE_TEST_FNAME);
+    ASSERT_THAT(read.size(),testing::Eq(2));
+    EXPECT_THAT(read[1].name,testing::Eq("match_ns"));
+    EXPECT_THAT(read[1].higherIsBetter,testing::Eq(false));
+    EXPECT_THAT(read[0].tolerance,testing::DoubleEq(0.2));
+
+    std::ostringstream report;
+    std::vector<PerfMetric> faster{{"orders_per_s", 2000.0, true, 0.2}, {"match_ns", 45.0, false, 0.2}};
+    EXPECT_THAT(PerfGate::compare(faster, read, report),testing::Eq(0));
+    std::vector<PerfMetric> slower{{"orders_per_s", 700.0, true, 0.2}, {"match_ns", 59.0, false, 0.2}};
+    EXPECT_THAT(PerfGate::compare(slower, read, report),testing::Eq(1));
+}
@@ -0,0 +1,119 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file ScriptTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for the command script runner.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Replay/ScriptRunner.h"
+#include "../src/UserMenuIF/UserMenuIF.h"
+#include <sstream>
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define SCRIPT_TEST_FNAME "DataSets/MatchTest_01.csv"
+#define SCRIPT_TEST_ORDERS 100000 /**< Enough orders for the script to span several blocks. */
+
+/**
+ *  Each command runs through the user entry path; malformed, unfunded and unknown commands are counted, not fatal.
+ */
+TEST(ScriptTests,TestCase_01)
+{
+    MerkelMain sim{SCRIPT_TEST_FNAME};
+    sim.init(true);
+    std::istringstream script{"# user orders\n"
+                              "bid ETH/BTC,0.03,2\n"
+                              "bid ETH/BTC,1000,1\n"
+                              "ask ETH/BTC,0.5,1\n"
+                              "bid DOGE,1,1\n"
+                              "bid ETH/BTC,abc,1\n"
+                              "  bid ETH/BTC, 0.01 ,1\r\n"
+                              "\n"
+                              "cancel 2\n"
+                              "cancel 99\n"
+                              "frobnicate\n"
+                              "next"};
+    ScriptRunner runner{sim};
+    ScriptStats stats = runner.run(script);
+
+    EXPECT_THAT(stats.lines,testing::Eq(10));
+    EXPECT_THAT(stats.unknown,testing::Eq(1));
+    EXPECT_THAT(stats.count[(std::size_t)ScriptCommand::bid],testing::Eq(5));
+    EXPECT_THAT(stats.rejected[(std::size_t)ScriptCommand::bid],testing::Eq(3));
+    EXPECT_THAT(stats.rejected[(std::size_t)ScriptCommand::ask],testing::Eq(1));
+    EXPECT_THAT(stats.count[(std::size_t)ScriptCommand::cancel],testing::Eq(2));
+    EXPECT_THAT(stats.rejected[(std::size_t)ScriptCommand::cancel],testing::Eq(1));
+    EXPECT_THAT(stats.count[(std::size_t)ScriptCommand::next],testing::Eq(1));
+
+    const Wallet & wallet = sim.getWallet();
+    EXPECT_THAT(wallet.getOpenHoldCount(),testing::Eq(0));
+    EXPECT_THAT(wallet.getBalance(SymbolTable::instance().currency("ETH")),testing::Gt(0.0));
+}
+
+/**
+ *  Lines split across read blocks are joined, and every order reaches the book.
+ */
+TEST(ScriptTests,TestCase_02)
+{
+    MerkelMain sim{SCRIPT_TEST_FNAME};
+    sim.init(true);
+    std::string text;
+    for(int i = 0; i < SCRIPT_TEST_ORDERS; i++) text += "bid ETH/BTC,0.00001,1.0000000000\n";
+    ASSERT_THAT(text.size(),testing::Gt((std::size_t)SCRIPT_BLOCK_BYTES));
+    std::istringstream script{text};
+    std::string time = sim.getCurrentTime();
+    std::size_t before = sim.getOrders().getOrderCount(time);
+
+    ScriptRunner runner{sim};
+    ScriptStats stats = runner.run(script);
+
+    EXPECT_THAT(stats.bytes,testing::Eq(text.size()));
+    EXPECT_THAT(stats.count[(std::size_t)ScriptCommand::bid],testing::Eq(SCRIPT_TEST_ORDERS));
+    EXPECT_THAT(stats.rejected[(std::size_t)ScriptCommand::bid],testing::Eq(0));
+    EXPECT_THAT(sim.getOrders().getOrderCount(time) - before,testing::Eq(SCRIPT_TEST_ORDERS));
+}
+
+/**
+ *  Cancel takes whole 64-bit order ids, including ids of reused holds, and nothing else.
+ */
+TEST(ScriptTests,TestCase_03)
+{
+    MerkelMain sim{SCRIPT_TEST_FNAME};
+    sim.init(true);
+    std::istringstream script{"bid ETH/BTC,0.03,2\n"
+                              "cancel 1\n"
+                              "bid ETH/BTC,0.03,2\n"          //Reuses the hold: id 2^32 + 1.
+                              "cancel 4294967297x\n"
+                              "cancel -4294967297\n"
+                              "cancel 1.0\n"
+                              "cancel 18446744073709551616\n"
+                              "cancel 4294967297 \n"};
+    ScriptRunner runner{sim};
+    ScriptStats stats = runner.run(script);
+
+    EXPECT_THAT(stats.count[(std::size_t)ScriptCommand::cancel],testing::Eq(6));
+    EXPECT_THAT(stats.rejected[(std::size_t)ScriptCommand::cancel],testing::Eq(4));
+    EXPECT_THAT(sim.getWallet().getOpenHoldCount(),testing::Eq(0));
+}
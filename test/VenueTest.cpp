@@ -0,0 +1,109 @@
+/*
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/**
+ * @file VenueTest.cpp
+ * @author Edward Martinez
+ * @brief Unit test case definition for venues replayed on a merged clock.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+/********************************************//**
+ *  Includes
+ ***********************************************/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../src/Venue/VenueSet.h"
+#include "../src/DataGen/DataGenerator.h"
+#include <cstdio>
+#include <set>
+
+/********************************************//**
+ *  Defines
+ ***********************************************/
+#define VENUE_TEST_FNAME_A "VenueTest_A.csv"
+#define VENUE_TEST_FNAME_B "VenueTest_B.csv"
+#define VENUE_TEST_FNAME_C "VenueTest_C.csv"
+
+/**
+ *  Check that venues step on the merged clock, coinciding venues together, with the same
+ *  sales as replaying each data set on its own.
+ */
+TEST(VenueTests,TestCase_01)
+{
+    DataGenOptions opt;
+    opt.frames = 50;
+    opt.ordersPerFrame = 20;
+    DataGenerator{opt}.write(std::string(VENUE_TEST_FNAME_A));
+    opt.seed = 2;
+    DataGenerator{opt}.write(std::string(VENUE_TEST_FNAME_C));
+    opt.frames = 40;
+    opt.intervalMs = 1500;
+    DataGenerator{opt}.write(std::string(VENUE_TEST_FNAME_B));
+    std::vector<std::string> paths{VENUE_TEST_FNAME_A, VENUE_TEST_FNAME_B, "DataSets/Missing.csv", VENUE_TEST_FNAME_C};
+
+    //Expected: every distinct timestamp once, and the sales of standalone replays.
+    std::set<std::string> timestamps;
+    std::size_t sales = 0;
+    for(const char * path : {VENUE_TEST_FNAME_A, VENUE_TEST_FNAME_B, VENUE_TEST_FNAME_C})
+    {
+        MerkelMain app{path};
+        app.setVerbose(false);
+        app.init(true);
+        std::string previous;
+        do
+        {
+            previous = app.getCurrentTime();
+            timestamps.insert(previous);
+            sales += app.processNext().sales;
+        } while(app.getCurrentTime() > previous);
+    }
+
+    for(unsigned threads : {1u, 3u})
+    {
+        VenueSet venues{threads};
+        EXPECT_THAT(venues.load(paths),testing::Eq(3));
+        EXPECT_THAT(venues.getVenue(1).name,testing::Eq(VENUE_TEST_FNAME_B));
+        EXPECT_THAT(venues.getCurrentTime(),testing::Eq(*timestamps.begin()));
+
+        std::size_t steps = 0;
+        std::size_t together = 0;
+        std::size_t venueSales = 0;
+        while(!venues.isDone())
+        {
+            std::string now = venues.getCurrentTime();
+            std::vector<std::size_t> before;
+            for(std::size_t i = 0; i < 3; i++) before.push_back(venues.getVenue(i).engine->getCurrentTime() == now);
+            VenueStepStats step = venues.step();
+            EXPECT_THAT(step.venues,testing::Eq(before[0] + before[1] + before[2]));
+            if(step.venues == 3) together++;
+            venueSales += step.sales;
+            steps++;
+        }
+        EXPECT_THAT(venues.step().venues,testing::Eq(0));
+        EXPECT_THAT(steps,testing::Eq(timestamps.size()));
+        EXPECT_THAT(together,testing::Gt(0));
+        EXPECT_THAT(venues.getVenue(0).ticks,testing::Eq(50));
+        EXPECT_THAT(venues.getVenue(1).ticks,testing::Eq(40));
+        EXPECT_THAT(venues.getVenue(2).ticks,testing::Eq(50));
+        EXPECT_THAT(venueSales,testing::Eq(sales));
+    }
+    std::remove(VENUE_TEST_FNAME_A);
+    std::remove(VENUE_TEST_FNAME_B);
+    std::remove(VENUE_TEST_FNAME_C);
+}
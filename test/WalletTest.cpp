@@ -143,4 +143,117 @@ TEST_F(WalletSubtractionTests,TestCase_05)
     double amountRem = amount + 1.0f;
     
     EXPECT_THAT(wallet02.removeCurrency(prod,amountRem),false);
-}
\ No newline at end of file
+}
+/**********************************************************
+ *  Currency id and settlement tests
+ **********************************************************/
+/**
+ *  Products are split once into interned base/quote ids; malformed products are rejected.
+ */
+TEST(WalletSymbolTests,TestCase_01)
+{
+    SymbolTable & symbols = SymbolTable::instance();
+    ProductPair pair = symbols.product("ETH/BTC");
+    EXPECT_THAT(pair.base,testing::Eq(symbols.currency("ETH")));
+    EXPECT_THAT(pair.quote,testing::Eq(symbols.currency("BTC")));
+    EXPECT_THAT(symbols.currencyName(pair.base),testing::Eq("ETH"));
+    EXPECT_THAT(symbols.findCurrency("NEVER_SEEN"),testing::Eq(SYMBOL_INVALID_ID));
+    EXPECT_THROW(symbols.product("ETHBTC"),std::runtime_error);
+}
+
+/**
+ *  Settling a bid sale and an ask sale moves both currencies of the pair.
+ */
+TEST(WalletSymbolTests,TestCase_02)
+{
+    Wallet wallet;
+    wallet.insertCurrency("BTC",10.0);
+    wallet.insertCurrency("BTC",2.0);
+
+    OrderBookEntry bid{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.5,20.0};
+    EXPECT_THAT(wallet.canFulfillOrder(bid),true);
+    bid._amount = 30.0;
+    EXPECT_THAT(wallet.canFulfillOrder(bid),false);
+
+    OrderBookEntry buy{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bidsale,0.5,4.0};
+    wallet.processSale(buy);
+    OrderBookEntry sell{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::asksale,1.0,1.0};
+    wallet.processSale(sell);
+
+    SymbolTable & symbols = SymbolTable::instance();
+    EXPECT_THAT(wallet.getBalance(symbols.currency("ETH")),testing::DoubleEq(3.0));
+    EXPECT_THAT(wallet.getBalance(symbols.currency("BTC")),testing::DoubleEq(11.0));
+    EXPECT_THAT(wallet.getWalletLen(),testing::Eq(2));
+    EXPECT_THAT(wallet.getBalances().begin()->first,testing::Eq("BTC"));
+}
+
+/**
+ *  Holds reduce the available balance, are consumed by fills and released on cancel or expiry.
+ */
+TEST(WalletHoldTests,TestCase_01)
+{
+    Wallet wallet;
+    wallet.insertCurrency("BTC",10.0);
+    CurrencyId btc = SymbolTable::instance().currency("BTC");
+
+    OrderBookEntry bid{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.5,12.0};
+    OrderId first = wallet.reserve(bid);
+    ASSERT_THAT(first,testing::Ne(ORDER_ID_NONE));
+    EXPECT_THAT(wallet.getAvailable(btc),testing::DoubleEq(4.0));
+    EXPECT_THAT(wallet.reserve(bid),testing::Eq(ORDER_ID_NONE)); //Same BTC cannot be spent twice.
+    EXPECT_THAT(wallet.canFulfillOrder(bid),false);
+
+    //Filled 4 ETH at an ask price of 0.25: 1 BTC spent, the 2 BTC held for those 4 ETH are released.
+    OrderBookEntry sale{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bidsale,0.25,4.0};
+    sale.orderId = first;
+    wallet.processSale(sale);
+    EXPECT_THAT(wallet.getBalance(btc),testing::DoubleEq(9.0));
+    EXPECT_THAT(wallet.getReserved(btc),testing::DoubleEq(4.0));
+
+    bid._amount = 4.0;
+    OrderId second = wallet.reserve(bid);
+    EXPECT_THAT(wallet.getAvailable(btc),testing::DoubleEq(3.0));
+    EXPECT_THAT(wallet.release(second),true);
+    EXPECT_THAT(wallet.release(second),false);
+    EXPECT_THAT(wallet.getOpenHoldCount(),testing::Eq(1));
+    EXPECT_THAT(wallet.releaseAll(),testing::Eq(1));
+    EXPECT_THAT(wallet.getReserved(btc),testing::DoubleEq(0.0));
+    EXPECT_THAT(wallet.getAvailable(btc),testing::DoubleEq(9.0));
+}
+
+/**
+ *  Released holds are reused by later orders, and the ids of released orders no longer reach them.
+ */
+TEST(WalletHoldTests,TestCase_02)
+{
+    Wallet wallet;
+    wallet.insertCurrency("BTC",10.0);
+    CurrencyId btc = SymbolTable::instance().currency("BTC");
+    OrderBookEntry bid{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bid,0.5,2.0};
+
+    OrderId first = wallet.reserve(bid);
+    OrderId kept  = wallet.reserve(bid);
+    EXPECT_THAT(wallet.release(first),true);
+    OrderId reused = wallet.reserve(bid);
+    EXPECT_THAT(reused & 0xFFFFFFFFu,testing::Eq(first & 0xFFFFFFFFu));
+    EXPECT_THAT(reused,testing::Ne(first));
+    EXPECT_THAT(wallet.release(first),false);   //Stale id: the slot now belongs to reused.
+    EXPECT_THAT(wallet.getReserved(btc),testing::DoubleEq(2.0));
+
+    OrderBookEntry sale{"2020/03/17 17:01:24.884492","ETH/BTC",OrderBookType::bidsale,0.5,2.0};
+    sale.orderId = first;
+    wallet.processSale(sale);                   //Spends the funds, but leaves reused's hold alone.
+    EXPECT_THAT(wallet.getReserved(btc),testing::DoubleEq(2.0));
+    EXPECT_THAT(wallet.getOpenHoldCount(),testing::Eq(2));
+
+    //A long run of orders, each released before the next, keeps cycling the same slots.
+    for(int i = 0; i < 1000; i++)
+    {
+        OrderId id = wallet.reserve(bid);
+        ASSERT_THAT(id & 0xFFFFFFFFu,testing::Le(3u));
+        EXPECT_THAT(wallet.release(id),true);
+    }
+    EXPECT_THAT(wallet.releaseAll(),testing::Eq(2));
+    EXPECT_THAT(wallet.release(kept),false);
+    EXPECT_THAT(wallet.getReserved(btc),testing::DoubleEq(0.0));
+}